@@ -65,47 +65,110 @@ void Camera::updateScreenForFOV() {
     screen.origin = center - screen.bottom_side * 0.5 - screen.left_side * 0.5;
 }
 
-Ray Camera::ray(double u, double v) const {
+Ray Camera::ray(double u, double v, double spread) const {
     Math::Point3D point = screen.pointAt(u, v);
     Math::Vector3D direction = (point - origin).normalize();
-    return Ray(origin, direction);
+    Ray result(origin, direction);
+
+    result.spread = spread;
+    return result;
+}
+
+double Camera::pixelSpread(int imageWidth) const {
+    Math::Point3D center = screen.pointAt(0.5, 0.5);
+    double distance = (center - origin).length();
+
+    if (imageWidth <= 1 || distance <= 0.0)
+        return 0.0;
+    return screen.bottom_side.length() / (imageWidth - 1) / distance;
 }
 
-Math::Vector3D Camera::supersampleRay(double u, double v, const Scene& scene, int samplesPerPixel) const {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    static std::uniform_real_distribution<double> dis(-0.5, 0.5);
-    int samplesPerAxis = static_cast<int>(std::sqrt(samplesPerPixel));
+namespace {
+
+double toDisplay(double channel) {
+    return std::sqrt(std::clamp(channel, 0.0, 1.0));
+}
+
+// Color through sample index of the pixel at (u, v), each of the samples covers its share of the pixel
+Math::Vector3D traceSample(const Camera &camera, const Scene &scene, double u, double v,
+Sampler &sampler, int index, int samplesPerPixel) {
     double pixelSizeU = 1.0 / std::max(1, scene.getImageWidth() - 1);
     double pixelSizeV = 1.0 / std::max(1, scene.getImageHeight() - 1);
-    Math::Vector3D accumulatedColor(Math::Coords{0.0, 0.0, 0.0});
-    if (samplesPerAxis > 1) {
-        for (int i = 0; i < samplesPerAxis; ++i) {
-            for (int j = 0; j < samplesPerAxis; ++j) {
-                double offsetU = (i + 0.5) / samplesPerAxis - 0.5;
-                double offsetV = (j + 0.5) / samplesPerAxis - 0.5;
-                double sampleU = u + offsetU * pixelSizeU;
-                double sampleV = v + offsetV * pixelSizeV;
-                Ray sampleRay = ray(sampleU, sampleV);
-                Math::Vector3D sampleColor = scene.computeColor(sampleRay);
-                accumulatedColor += sampleColor;
-            }
-        }
+    double spread = camera.pixelSpread(scene.getImageWidth()) / std::sqrt(std::max(1, samplesPerPixel));
+    sampler.startSample(index);
+    Math::Vector2D offset = sampler.get2D();
+    return scene.computeColor(camera.ray(u + (offset.U - 0.5) * pixelSizeU,
+        v + (offset.V - 0.5) * pixelSizeV, spread));
+}
+
+}  // namespace
+
+// The first samples of every pattern spread over both axes of the pixel
+int Camera::pilotCount(int samplesPerPixel) {
+    return samplesPerPixel >= 8 ? 4 : std::max(1, samplesPerPixel / 2);
+}
+
+void PixelSamples::add(const Math::Vector3D &color) {
+    Math::Vector3D display(Math::Coords{toDisplay(color.X), toDisplay(color.Y), toDisplay(color.Z)});
+    if (count == 0) {
+        lowest = display;
+        highest = display;
     } else {
-        for (int i = 0; i < samplesPerPixel; ++i) {
-            double offsetU = dis(gen);
-            double offsetV = dis(gen);
-            double sampleU = u + offsetU * pixelSizeU;
-            double sampleV = v + offsetV * pixelSizeV;
-            Ray sampleRay = ray(sampleU, sampleV);
-            Math::Vector3D sampleColor = scene.computeColor(sampleRay);
-            accumulatedColor += sampleColor;
-        }
+        lowest = Math::Vector3D(Math::Coords{std::min(lowest.X, display.X),
+            std::min(lowest.Y, display.Y), std::min(lowest.Z, display.Z)});
+        highest = Math::Vector3D(Math::Coords{std::max(highest.X, display.X),
+            std::max(highest.Y, display.Y), std::max(highest.Z, display.Z)});
     }
-    accumulatedColor.X /= samplesPerPixel;
-    accumulatedColor.Y /= samplesPerPixel;
-    accumulatedColor.Z /= samplesPerPixel;
-    return accumulatedColor;
+    sum += color;
+    count++;
+}
+
+Math::Vector3D PixelSamples::mean() const {
+    if (count == 0)
+        return Math::Vector3D(Math::Coords{0.0, 0.0, 0.0});
+    return sum * (1.0 / count);
+}
+
+double PixelSamples::contrast() const {
+    return std::max({highest.X - lowest.X, highest.Y - lowest.Y, highest.Z - lowest.Z});
+}
+
+double PixelSamples::contrastWith(const PixelSamples &other) const {
+    Math::Vector3D a = mean();
+    Math::Vector3D b = other.mean();
+    return std::max({std::abs(toDisplay(a.X) - toDisplay(b.X)),
+        std::abs(toDisplay(a.Y) - toDisplay(b.Y)), std::abs(toDisplay(a.Z) - toDisplay(b.Z))});
+}
+
+Math::Vector3D Camera::supersampleRay(double u, double v, const Scene& scene, int samplesPerPixel,
+Sampler &sampler) const {
+    Math::Vector3D accumulatedColor(Math::Coords{0.0, 0.0, 0.0});
+
+    samplesPerPixel = std::max(1, samplesPerPixel);
+    for (int i = 0; i < samplesPerPixel; ++i)
+        accumulatedColor += traceSample(*this, scene, u, v, sampler, i, samplesPerPixel);
+    return accumulatedColor * (1.0 / samplesPerPixel);
+}
+
+PixelSamples Camera::pilotSamples(double u, double v, const Scene& scene, int samplesPerPixel,
+Sampler &sampler) const {
+    PixelSamples pilot;
+    int count = std::min(std::max(1, samplesPerPixel), pilotCount(samplesPerPixel));
+
+    for (int i = 0; i < count; ++i)
+        pilot.add(traceSample(*this, scene, u, v, sampler, i, samplesPerPixel));
+    return pilot;
+}
+
+Math::Vector3D Camera::refineSamples(double u, double v, const Scene& scene,
+int samplesPerPixel, const PixelSamples &pilot, Sampler &sampler) const {
+    Math::Vector3D accumulatedColor = pilot.sum;
+
+    if (samplesPerPixel <= pilot.count)
+        return pilot.mean();
+    for (int i = pilot.count; i < samplesPerPixel; ++i)
+        accumulatedColor += traceSample(*this, scene, u, v, sampler, i, samplesPerPixel);
+    return accumulatedColor * (1.0 / samplesPerPixel);
 }
 
 void Camera::translate(const Math::Vector3D &translation) {
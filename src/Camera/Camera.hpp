@@ -11,18 +11,36 @@
 
 #include <memory>
 #include <cmath>
-#include <random>
 #include <libconfig.h++>
 
 #include "Math/Point3D/Point3D.hpp"
 #include "Ray/Ray.hpp"
 #include "Rectangle3D/Rectangle3D.hpp"
+#include "Sampler/Sampler.hpp"
 
 namespace RayTracer {
 // Forward declarations
 class Scene;
 class SupersamplingPostProcess;
 
+/**
+ * @brief Samples traced so far for one pixel of adaptive supersampling
+ */
+struct PixelSamples {
+    Math::Vector3D sum{Math::Coords{0.0, 0.0, 0.0}};
+    // Per channel extremes of the samples, in display space
+    Math::Vector3D lowest{Math::Coords{0.0, 0.0, 0.0}};
+    Math::Vector3D highest{Math::Coords{0.0, 0.0, 0.0}};
+    int count = 0;
+
+    void add(const Math::Vector3D &color);
+    Math::Vector3D mean() const;
+    // Largest channel spread between the samples, in display space
+    double contrast() const;
+    // Largest channel difference between the means of both pixels, in display space
+    double contrastWith(const PixelSamples &other) const;
+};
+
 class Camera {
  public:
     Math::Point3D origin;
@@ -38,7 +56,16 @@ class Camera {
     const Rectangle3D &screen, double fov = 90.0);
     void setFOV(double newFov);
     double getFOV() const;
-    Ray ray(double u, double v) const;
+    /**
+     * @brief Ray through (u, v) of the screen
+     * @param spread Cone angle the ray carries for texture filtering, see pixelSpread()
+     */
+    Ray ray(double u, double v, double spread = 0.0) const;
+
+    /**
+     * @brief Angle one pixel covers from the eye, for an image imageWidth pixels wide
+     */
+    double pixelSpread(int imageWidth) const;
 
     /**
      * @brief Generate multiple rays for supersampling and return the average color
@@ -47,9 +74,34 @@ class Camera {
      * @param v Base V coordinate (0.0 - 1.0)
      * @param scene The scene to render
      * @param samplesPerPixel Number of samples to take per pixel
+     * @param sampler Positions of the samples in the pixel, started on that pixel by the caller
      * @return Average color from all sample rays
      */
-    Math::Vector3D supersampleRay(double u, double v, const Scene& scene, int samplesPerPixel) const;
+    Math::Vector3D supersampleRay(double u, double v, const Scene& scene, int samplesPerPixel,
+        Sampler &sampler) const;
+
+    /**
+     * @brief First samples of adaptive supersampling, the first few of the
+     * sampler sequence
+     *
+     * A pixel whose pilot samples agree with each other and with its
+     * neighbours is done; refineSamples traces the rest of them otherwise.
+     */
+    PixelSamples pilotSamples(double u, double v, const Scene& scene, int samplesPerPixel,
+        Sampler &sampler) const;
+
+    /**
+     * @brief Samples pilotSamples traces before deciding whether the pixel
+     * needs all samplesPerPixel of them
+     */
+    static int pilotCount(int samplesPerPixel);
+
+    /**
+     * @brief Traces the samples pilotSamples skipped
+     * @return Average color of all the samples, as supersampleRay would return
+     */
+    Math::Vector3D refineSamples(double u, double v, const Scene& scene,
+        int samplesPerPixel, const PixelSamples &pilot, Sampler &sampler) const;
 
     void rotateX(double degrees);
     void rotateY(double degrees);
@@ -39,7 +39,7 @@ void InputManager::processInput(std::shared_ptr<Scene> scene, std::shared_ptr<Ca
     handleObjectSelection(scene, camera);
     handleObjectScrolling(scene, camera);
     if (_isDragging && _selectedPrimitive) {
-        handleObjectDragging(camera);
+        handleObjectDragging(scene, camera);
     }
 }
 
@@ -133,7 +133,7 @@ void InputManager::handleObjectSelection(std::shared_ptr<Scene> scene, std::shar
     _mouseWasPressed = mouseIsPressed;
 }
 
-void InputManager::handleObjectDragging(std::shared_ptr<Camera> camera) {
+void InputManager::handleObjectDragging(std::shared_ptr<Scene> scene, std::shared_ptr<Camera> camera) {
     auto currentMousePos = _eventsManager->getMousePos();
     int deltaX = currentMousePos.x - _dragStartPos.x;
     int deltaY = currentMousePos.y - _dragStartPos.y;
@@ -148,6 +148,7 @@ void InputManager::handleObjectDragging(std::shared_ptr<Camera> camera) {
 
         Math::Vector3D moveVec = rightDir * (deltaX * 0.01) + upDir * (-deltaY * 0.01);
         _selectedPrimitive->translate(moveVec);
+        scene->markChanged();
         _dragStartPos = {static_cast<int>(currentMousePos.x), static_cast<int>(currentMousePos.y)};
     }
 }
@@ -170,6 +171,8 @@ void InputManager::handleObjectScrolling(std::shared_ptr<Scene> scene, std::shar
 
             Math::Vector3D moveVec = viewDir * mouseOffset * 0.2;
             hit->primitive->translate(moveVec);
+            scene->markChanged();
+            _moving = true;
         }
     }
 }
@@ -35,7 +35,7 @@ class InputManager {
     void setupCameraCommands(std::shared_ptr<Camera> camera);
     void handleCameraMovement(std::shared_ptr<Camera> camera);
     void handleObjectSelection(std::shared_ptr<Scene> scene, std::shared_ptr<Camera> camera);
-    void handleObjectDragging(std::shared_ptr<Camera> camera);
+    void handleObjectDragging(std::shared_ptr<Scene> scene, std::shared_ptr<Camera> camera);
     void handleObjectScrolling(std::shared_ptr<Scene> scene, std::shared_ptr<Camera> camera);
 
     std::shared_ptr<IEventsManager> _eventsManager;
@@ -52,7 +52,7 @@ class InputManager {
 
     bool _isDragging;
     bool _moving = false;
-    std::shared_ptr<IPrimitive> _selectedPrimitive;
+    IPrimitive *_selectedPrimitive;
     sf::Vector2i _dragStartPos;
 
     std::vector<std::shared_ptr<ICommand>> _cameraCommands;
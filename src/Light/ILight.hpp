@@ -8,6 +8,7 @@
 
 #ifndef SRC_LIGHT_ILIGHT_HPP_
 #define SRC_LIGHT_ILIGHT_HPP_
+#include <limits>
 #include <memory>
 #include <libconfig.h++>
 #include "Math/Point3D/Point3D.hpp"
@@ -21,6 +22,12 @@ class ILight {
     virtual Math::Vector3D getLightDirection(
       const Math::Point3D &point) const = 0;
     virtual Math::Vector3D getLightColor() const = 0;
+    // How far the light is from point, where its shadow rays stop;
+    // infinite for lights without a position
+    virtual double getDistance(const Math::Point3D &point) const {
+        (void)point;
+        return std::numeric_limits<double>::infinity();
+    }
     virtual std::shared_ptr<ILight> clone() const = 0;
     virtual void getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) const = 0;
 };
@@ -23,6 +23,10 @@ Math::Vector3D LightDecorator::getLightColor() const {
     return wrappedLight->getLightColor();
 }
 
+double LightDecorator::getDistance(const Math::Point3D &point) const {
+    return wrappedLight->getDistance(point);
+}
+
 void LightDecorator::getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) const {
     wrappedLight->getLibConfigParams(setting);
 }
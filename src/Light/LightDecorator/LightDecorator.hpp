@@ -24,6 +24,7 @@ class LightDecorator : public ILight {
 
     Math::Vector3D getLightDirection(const Math::Point3D &point) const override;
     Math::Vector3D getLightColor() const override;
+    double getDistance(const Math::Point3D &point) const override;
     virtual std::shared_ptr<ILight> clone() const = 0;
     void getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) const override;
 };
@@ -20,6 +20,10 @@ Math::Vector3D PointLight::getLightDirection(const Math::Point3D &point) const {
     return direction.normalize();
 }
 
+double PointLight::getDistance(const Math::Point3D &point) const {
+    return (position - point).length();
+}
+
 Math::Vector3D PointLight::getLightColor(const Math::Point3D &point) const {
     Math::Vector3D distanceVector = position - point;
     double distance = distanceVector.length();
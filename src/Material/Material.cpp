@@ -35,16 +35,17 @@ Material::Material(const Math::Vector3D &colors,
       reflectivity(reflectivity), transparency(transparency),
       refractionIndex(refractionIndex), shininess(shininess) {}
 
-Math::Vector3D Material::getColorAt(const Math::Vector2D& uv) const {
+Math::Vector3D Material::getColorAt(const Math::Vector2D& uv, double footprint) const {
     if (texture) {
-        return texture->getColorAt(uv);
+        return texture->getFilteredColorAt(uv, footprint);
     }
     return color;
 }
 
-Math::Vector3D Material::getNormalAt(const Math::Vector2D& uv, const Math::Vector3D& originalNormal) const {
+Math::Vector3D Material::getNormalAt(const Math::Vector2D& uv, const Math::Vector3D& originalNormal,
+    double footprint) const {
     if (normalMap) {
-        Math::Vector3D normalFromMap = normalMap->getNormalAt(uv);
+        Math::Vector3D normalFromMap = normalMap->getNormalAt(uv, footprint);
         return transformNormalFromTangentSpace(normalFromMap, originalNormal);
     }
     return originalNormal;
@@ -57,16 +58,16 @@ double Material::getDisplacementAt(const Math::Vector2D& uv) const {
     return 0.0;
 }
 
-double Material::getSpecularAt(const Math::Vector2D& uv) const {
+double Material::getSpecularAt(const Math::Vector2D& uv, double footprint) const {
     if (specularMap) {
-        return specularMap->getSpecularAt(uv);
+        return specularMap->getSpecularAt(uv, footprint);
     }
     return 0.5;
 }
 
-double Material::getAmbientOcclusionAt(const Math::Vector2D& uv) const {
+double Material::getAmbientOcclusionAt(const Math::Vector2D& uv, double footprint) const {
     if (aoMap) {
-        return aoMap->getOcclusionAt(uv);
+        return aoMap->getOcclusionAt(uv, footprint);
     }
     return 1.0;
 }
@@ -168,4 +169,8 @@ bool Material::hasAmbientOcclusionMap() const {
     return aoMap != nullptr;
 }
 
+bool Material::hasShadingMaps() const {
+    return texture || normalMap || specularMap || aoMap;
+}
+
 }  // namespace RayTracer
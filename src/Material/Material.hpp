@@ -49,11 +49,13 @@ class Material {
         double refractionIndex = 1.0,
         double shininess = 10.0);
     virtual ~Material() = default;
-    Math::Vector3D getColorAt(const Math::Vector2D& uv) const;
-    Math::Vector3D getNormalAt(const Math::Vector2D& uv, const Math::Vector3D& originalNormal) const;
+    // footprint: width in UV units of what the lookup covers, mipmapped maps filter over it
+    Math::Vector3D getColorAt(const Math::Vector2D& uv, double footprint = 0.0) const;
+    Math::Vector3D getNormalAt(const Math::Vector2D& uv, const Math::Vector3D& originalNormal,
+        double footprint = 0.0) const;
     double getDisplacementAt(const Math::Vector2D& uv) const;
-    double getSpecularAt(const Math::Vector2D& uv) const;
-    double getAmbientOcclusionAt(const Math::Vector2D& uv) const;
+    double getSpecularAt(const Math::Vector2D& uv, double footprint = 0.0) const;
+    double getAmbientOcclusionAt(const Math::Vector2D& uv, double footprint = 0.0) const;
     Math::Vector3D transformNormalFromTangentSpace(
         const Math::Vector3D& normalFromMap,
         const Math::Vector3D& surfaceNormal) const;
@@ -72,6 +74,8 @@ class Material {
     bool hasDisplacementMap() const;
     bool hasSpecularMap() const;
     bool hasAmbientOcclusionMap() const;
+    // Whether shading samples an image, i.e. whether a ray footprint is worth computing
+    bool hasShadingMaps() const;
 };
 }  // namespace RayTracer
 
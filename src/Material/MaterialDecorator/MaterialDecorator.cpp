@@ -16,7 +16,7 @@ std::shared_ptr<Material> material)
 : PrimitiveDecorator(std::move(primitive)),
 overrideMaterial(std::move(material)) {}
 
-std::shared_ptr<Material> MaterialDecorator::getMaterial() const {
+const std::shared_ptr<Material> &MaterialDecorator::getMaterial() const {
     return overrideMaterial;
 }
 
@@ -22,7 +22,7 @@ class MaterialDecorator : public PrimitiveDecorator {
         std::shared_ptr<Material> material);
     ~MaterialDecorator() override = default;
 
-    std::shared_ptr<Material> getMaterial() const override;
+    const std::shared_ptr<Material> &getMaterial() const override;
     std::shared_ptr<IPrimitive> clone() const override;
     void getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) const override;
 };
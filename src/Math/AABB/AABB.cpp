@@ -0,0 +1,123 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** AABB implementation
+*/
+#include "Math/AABB/AABB.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Math {
+
+AABB::AABB()
+: min(Coords{std::numeric_limits<double>::infinity(),
+    std::numeric_limits<double>::infinity(),
+    std::numeric_limits<double>::infinity()}),
+  max(Coords{-std::numeric_limits<double>::infinity(),
+    -std::numeric_limits<double>::infinity(),
+    -std::numeric_limits<double>::infinity()}) {}
+
+AABB::AABB(const Point3D &min, const Point3D &max) : min(min), max(max) {}
+
+AABB AABB::infinite() {
+    const double inf = std::numeric_limits<double>::infinity();
+    return AABB(Point3D(Coords{-inf, -inf, -inf}), Point3D(Coords{inf, inf, inf}));
+}
+
+AABB AABB::fromSphere(const Point3D &center, double radius) {
+    return AABB(Point3D(Coords{center.X - radius, center.Y - radius, center.Z - radius}),
+        Point3D(Coords{center.X + radius, center.Y + radius, center.Z + radius}));
+}
+
+void AABB::expand(const Point3D &point) {
+    min.X = std::min(min.X, point.X);
+    min.Y = std::min(min.Y, point.Y);
+    min.Z = std::min(min.Z, point.Z);
+    max.X = std::max(max.X, point.X);
+    max.Y = std::max(max.Y, point.Y);
+    max.Z = std::max(max.Z, point.Z);
+}
+
+void AABB::expand(const AABB &other) {
+    if (other.isEmpty())
+        return;
+    expand(other.min);
+    expand(other.max);
+}
+
+AABB AABB::inflated(double margin) const {
+    if (isEmpty())
+        return *this;
+    return AABB(Point3D(Coords{min.X - margin, min.Y - margin, min.Z - margin}),
+        Point3D(Coords{max.X + margin, max.Y + margin, max.Z + margin}));
+}
+
+bool AABB::isEmpty() const {
+    return min.X > max.X || min.Y > max.Y || min.Z > max.Z;
+}
+
+bool AABB::isBounded() const {
+    return !isEmpty() && std::isfinite(min.X) && std::isfinite(min.Y)
+        && std::isfinite(min.Z) && std::isfinite(max.X)
+        && std::isfinite(max.Y) && std::isfinite(max.Z);
+}
+
+Point3D AABB::centroid() const {
+    return Point3D(Coords{(min.X + max.X) * 0.5, (min.Y + max.Y) * 0.5,
+        (min.Z + max.Z) * 0.5});
+}
+
+Vector3D AABB::extent() const {
+    if (isEmpty())
+        return Vector3D(Coords{0.0, 0.0, 0.0});
+    return max - min;
+}
+
+double AABB::surfaceArea() const {
+    Vector3D size = extent();
+    return 2.0 * (size.X * size.Y + size.Y * size.Z + size.Z * size.X);
+}
+
+int AABB::longestAxis() const {
+    Vector3D size = extent();
+    if (size.X >= size.Y && size.X >= size.Z)
+        return 0;
+    return size.Y >= size.Z ? 1 : 2;
+}
+
+Point3D AABB::corner(int index) const {
+    return Point3D(Coords{
+        (index & 1) ? max.X : min.X,
+        (index & 2) ? max.Y : min.Y,
+        (index & 4) ? max.Z : min.Z
+    });
+}
+
+bool AABB::intersect(const Point3D &origin, const Vector3D &invDirection,
+double tMin, double tMax, double &tEntry) const {
+    const double bounds[2][3] = {
+        {min.X, min.Y, min.Z},
+        {max.X, max.Y, max.Z}
+    };
+    const double o[3] = {origin.X, origin.Y, origin.Z};
+    const double inv[3] = {invDirection.X, invDirection.Y, invDirection.Z};
+
+    for (int axis = 0; axis < 3; axis++) {
+        double t0 = (bounds[0][axis] - o[axis]) * inv[axis];
+        double t1 = (bounds[1][axis] - o[axis]) * inv[axis];
+        if (inv[axis] < 0.0)
+            std::swap(t0, t1);
+        // NaN (0 * inf on a slab boundary) must not reject the box
+        tMin = t0 > tMin ? t0 : tMin;
+        tMax = t1 < tMax ? t1 : tMax;
+        if (tMax < tMin)
+            return false;
+    }
+    tEntry = tMin;
+    return true;
+}
+
+}  // namespace Math
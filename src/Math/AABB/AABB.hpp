@@ -0,0 +1,58 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** AABB
+*/
+
+#ifndef SRC_MATH_AABB_AABB_HPP_
+#define SRC_MATH_AABB_AABB_HPP_
+#include "Math/Point3D/Point3D.hpp"
+#include "Math/Vector3D/Vector3D.hpp"
+
+namespace Math {
+/**
+ * @brief Axis-aligned bounding box used by the acceleration structures
+ *
+ * A default constructed box is empty (min > max) so it can be grown with
+ * expand(). Unbounded primitives such as planes report infinite() bounds.
+ */
+class AABB {
+ public:
+    Point3D min;
+    Point3D max;
+
+    AABB();
+    AABB(const Point3D &min, const Point3D &max);
+
+    static AABB infinite();
+    static AABB fromSphere(const Point3D &center, double radius);
+
+    void expand(const Point3D &point);
+    void expand(const AABB &other);
+    AABB inflated(double margin) const;
+
+    bool isEmpty() const;
+    bool isBounded() const;
+    Point3D centroid() const;
+    Vector3D extent() const;
+    double surfaceArea() const;
+    int longestAxis() const;
+    Point3D corner(int index) const;
+
+    /**
+     * @brief Slab test against a ray given its precomputed inverse direction
+     * @param origin The ray origin
+     * @param invDirection 1 / direction, component-wise
+     * @param tMin Lower bound of the ray interval
+     * @param tMax Upper bound of the ray interval
+     * @param tEntry Set to the distance at which the ray enters the box
+     * @return True if the ray overlaps the box inside [tMin, tMax]
+     */
+    bool intersect(const Point3D &origin, const Vector3D &invDirection,
+        double tMin, double tMax, double &tEntry) const;
+};
+}  // namespace Math
+
+#endif  // SRC_MATH_AABB_AABB_HPP_
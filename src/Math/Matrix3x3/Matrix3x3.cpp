@@ -22,6 +22,15 @@ Vector3D Matrix3x3::operator*(const Vector3D& v) const {
     });
 }
 
+Matrix3x3 Matrix3x3::operator*(const Matrix3x3& other) const {
+    Matrix3x3 result;
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            result.m[i][j] = m[i][0] * other.m[0][j] + m[i][1] * other.m[1][j]
+                + m[i][2] * other.m[2][j];
+    return result;
+}
+
 Matrix3x3 Matrix3x3::transpose() const {
     Matrix3x3 result;
     for (int i = 0; i < 3; i++)
@@ -18,6 +18,7 @@ class Matrix3x3 {
     Matrix3x3(const Vector3D& row1, const Vector3D& row2, const Vector3D& row3);
 
     Vector3D operator*(const Vector3D& v) const;
+    Matrix3x3 operator*(const Matrix3x3& other) const;
     Matrix3x3 transpose() const;
 
     double m[3][3];
@@ -0,0 +1,59 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** Matrix3x4 affine transform implementation
+*/
+
+#include <stdexcept>
+#include "Math/Matrix3x4/Matrix3x4.hpp"
+
+namespace Math {
+
+Matrix3x4::Matrix3x4() : linear(), translation(Coords{0.0, 0.0, 0.0}) {}
+
+Matrix3x4::Matrix3x4(const Matrix3x3& linear, const Vector3D& translation)
+: linear(linear), translation(translation) {}
+
+Point3D Matrix3x4::operator*(const Point3D& p) const {
+    const double (&m)[3][3] = linear.m;
+    return Point3D(Coords{
+        m[0][0] * p.X + m[0][1] * p.Y + m[0][2] * p.Z + translation.X,
+        m[1][0] * p.X + m[1][1] * p.Y + m[1][2] * p.Z + translation.Y,
+        m[2][0] * p.X + m[2][1] * p.Y + m[2][2] * p.Z + translation.Z
+    });
+}
+
+Vector3D Matrix3x4::operator*(const Vector3D& v) const {
+    return linear * v;
+}
+
+Matrix3x4 Matrix3x4::operator*(const Matrix3x4& other) const {
+    return Matrix3x4(linear * other.linear, linear * other.translation + translation);
+}
+
+Matrix3x4 Matrix3x4::inverse() const {
+    const double (&m)[3][3] = linear.m;
+    double c00 = m[1][1] * m[2][2] - m[1][2] * m[2][1];
+    double c01 = m[1][2] * m[2][0] - m[1][0] * m[2][2];
+    double c02 = m[1][0] * m[2][1] - m[1][1] * m[2][0];
+    double det = m[0][0] * c00 + m[0][1] * c01 + m[0][2] * c02;
+    if (det == 0.0)
+        throw std::runtime_error("Cannot invert a singular transform");
+
+    double invDet = 1.0 / det;
+    Matrix3x3 inv;
+    inv.m[0][0] = c00 * invDet;
+    inv.m[1][0] = c01 * invDet;
+    inv.m[2][0] = c02 * invDet;
+    inv.m[0][1] = (m[0][2] * m[2][1] - m[0][1] * m[2][2]) * invDet;
+    inv.m[1][1] = (m[0][0] * m[2][2] - m[0][2] * m[2][0]) * invDet;
+    inv.m[2][1] = (m[0][1] * m[2][0] - m[0][0] * m[2][1]) * invDet;
+    inv.m[0][2] = (m[0][1] * m[1][2] - m[0][2] * m[1][1]) * invDet;
+    inv.m[1][2] = (m[0][2] * m[1][0] - m[0][0] * m[1][2]) * invDet;
+    inv.m[2][2] = (m[0][0] * m[1][1] - m[0][1] * m[1][0]) * invDet;
+    return Matrix3x4(inv, (inv * translation) * -1.0);
+}
+
+}  // namespace Math
@@ -0,0 +1,44 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** Matrix3x4 affine transform
+*/
+
+#ifndef SRC_MATH_MATRIX3X4_MATRIX3X4_HPP_
+#define SRC_MATH_MATRIX3X4_MATRIX3X4_HPP_
+
+#include "Math/Matrix3x3/Matrix3x3.hpp"
+#include "Math/Point3D/Point3D.hpp"
+#include "Math/Vector3D/Vector3D.hpp"
+
+namespace Math {
+
+/**
+ * @brief Affine transform: a linear part followed by a translation
+ */
+class Matrix3x4 {
+ public:
+    Matrix3x4();
+    Matrix3x4(const Matrix3x3& linear, const Vector3D& translation);
+
+    // Points get the translation, vectors only the linear part
+    Point3D operator*(const Point3D& p) const;
+    Vector3D operator*(const Vector3D& v) const;
+    // Applies other first, then this
+    Matrix3x4 operator*(const Matrix3x4& other) const;
+
+    /**
+     * @brief Inverts the transform
+     * @throw std::runtime_error if the linear part is singular
+     */
+    Matrix3x4 inverse() const;
+
+    Matrix3x3 linear;
+    Vector3D translation;
+};
+
+}  // namespace Math
+
+#endif  // SRC_MATH_MATRIX3X4_MATRIX3X4_HPP_
@@ -0,0 +1,171 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** Polynomial implementation
+*/
+#include <algorithm>
+#include <cmath>
+#include "Math/Polynomial/Polynomial.hpp"
+
+namespace Math {
+namespace Polynomial {
+
+namespace {
+
+const double EPSILON = 1e-9;
+const int POLISH_STEPS = 4;
+
+bool isZero(double x) {
+    return std::abs(x) < EPSILON;
+}
+
+double evaluateQuartic(const double coeffs[5], double x, double &derivative) {
+    double value = coeffs[0];
+    derivative = 0.0;
+    for (int i = 1; i < 5; i++) {
+        derivative = derivative * x + value;
+        value = value * x + coeffs[i];
+    }
+    return value;
+}
+
+}  // namespace
+
+int solveLinear(double a, double b, double roots[1]) {
+    if (a == 0.0)
+        return 0;
+    roots[0] = -b / a;
+    return 1;
+}
+
+int solveQuadratic(double a, double b, double c, double roots[2]) {
+    if (a == 0.0)
+        return solveLinear(b, c, roots);
+    double p = b / (2.0 * a);
+    double q = c / a;
+    double discriminant = p * p - q;
+
+    if (isZero(discriminant)) {
+        roots[0] = -p;
+        return 1;
+    }
+    if (discriminant < 0.0)
+        return 0;
+    // Avoids subtracting nearly equal values when one root is tiny
+    double sum = -p - std::copysign(std::sqrt(discriminant), p);
+    roots[0] = sum;
+    roots[1] = sum != 0.0 ? q / sum : -sum;
+    return 2;
+}
+
+int solveCubic(double a, double b, double c, double d, double roots[3]) {
+    if (a == 0.0)
+        return solveQuadratic(b, c, d, roots);
+    double A = b / a;
+    double B = c / a;
+    double C = d / a;
+
+    // Depressed cubic y^3 + 3py + 2q = 0 with x = y - A / 3
+    double squareA = A * A;
+    double p = (B - squareA / 3.0) / 3.0;
+    double q = (2.0 / 27.0 * A * squareA - A * B / 3.0 + C) / 2.0;
+    double cubeP = p * p * p;
+    double discriminant = q * q + cubeP;
+    int count = 0;
+
+    if (isZero(discriminant)) {
+        if (isZero(q)) {
+            roots[0] = 0.0;
+            count = 1;
+        } else {
+            double u = std::cbrt(-q);
+            roots[0] = 2.0 * u;
+            roots[1] = -u;
+            count = 2;
+        }
+    } else if (discriminant < 0.0) {
+        double phi = std::acos(std::clamp(-q / std::sqrt(-cubeP), -1.0, 1.0)) / 3.0;
+        double t = 2.0 * std::sqrt(-p);
+        roots[0] = t * std::cos(phi);
+        roots[1] = -t * std::cos(phi + M_PI / 3.0);
+        roots[2] = -t * std::cos(phi - M_PI / 3.0);
+        count = 3;
+    } else {
+        double sqrtDiscriminant = std::sqrt(discriminant);
+        roots[0] = std::cbrt(sqrtDiscriminant - q) - std::cbrt(sqrtDiscriminant + q);
+        count = 1;
+    }
+    for (int i = 0; i < count; i++)
+        roots[i] -= A / 3.0;
+    return count;
+}
+
+int solveQuartic(double a, double b, double c, double d, double e,
+double roots[4]) {
+    if (a == 0.0)
+        return solveCubic(b, c, d, e, roots);
+    double A = b / a;
+    double B = c / a;
+    double C = d / a;
+    double D = e / a;
+
+    // Depressed quartic y^4 + py^2 + qy + r = 0 with x = y - A / 4
+    double squareA = A * A;
+    double p = -3.0 / 8.0 * squareA + B;
+    double q = squareA * A / 8.0 - A * B / 2.0 + C;
+    double r = -3.0 / 256.0 * squareA * squareA + squareA * B / 16.0 - A * C / 4.0 + D;
+    int count = 0;
+
+    if (isZero(r)) {
+        count = solveCubic(1.0, 0.0, p, q, roots);
+        roots[count++] = 0.0;
+    } else {
+        double cubicRoots[3];
+        int cubicCount = solveCubic(1.0, -p / 2.0, -r, r * p / 2.0 - q * q / 8.0,
+            cubicRoots);
+        // The largest resolvent root keeps both square roots below real
+        double z = *std::max_element(cubicRoots, cubicRoots + cubicCount);
+        double u = z * z - r;
+        double v = 2.0 * z - p;
+
+        if (isZero(u))
+            u = 0.0;
+        else if (u > 0.0)
+            u = std::sqrt(u);
+        else
+            return 0;
+        if (isZero(v))
+            v = 0.0;
+        else if (v > 0.0)
+            v = std::sqrt(v);
+        else
+            return 0;
+        count = solveQuadratic(1.0, q < 0.0 ? -v : v, z - u, roots);
+        count += solveQuadratic(1.0, q < 0.0 ? v : -v, z + u, roots + count);
+    }
+
+    const double coeffs[5] = {1.0, A, B, C, D};
+    for (int i = 0; i < count; i++) {
+        double x = roots[i] - A / 4.0;
+        double derivative;
+        double value = evaluateQuartic(coeffs, x, derivative);
+        for (int step = 0; step < POLISH_STEPS && derivative != 0.0; step++) {
+            double next = x - value / derivative;
+            double nextDerivative;
+            double nextValue = evaluateQuartic(coeffs, next, nextDerivative);
+            // Near a double root the derivative vanishes, never walk uphill
+            if (std::abs(nextValue) >= std::abs(value))
+                break;
+            x = next;
+            value = nextValue;
+            derivative = nextDerivative;
+        }
+        roots[i] = x;
+    }
+    return count;
+}
+
+}  // namespace Polynomial
+}  // namespace Math
@@ -0,0 +1,37 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** Polynomial - real roots of low degree polynomials
+*/
+
+#ifndef SRC_MATH_POLYNOMIAL_POLYNOMIAL_HPP_
+#define SRC_MATH_POLYNOMIAL_POLYNOMIAL_HPP_
+
+namespace Math {
+
+/**
+ * @brief Closed-form real root solvers shared by the algebraic primitives
+ * Coefficients are given from the highest degree down, roots are written to
+ * the output array in no particular order and the count is returned.
+ * A vanishing leading coefficient falls back to the lower degree solver.
+ */
+namespace Polynomial {
+
+int solveLinear(double a, double b, double roots[1]);
+int solveQuadratic(double a, double b, double c, double roots[2]);
+int solveCubic(double a, double b, double c, double d, double roots[3]);
+
+/**
+ * @brief Ferrari's method through the largest root of the resolvent cubic,
+ * each root is then polished with Newton steps on the original quartic so
+ * double roots (grazing rays) are not lost to cancellation
+ */
+int solveQuartic(double a, double b, double c, double d, double e,
+    double roots[4]);
+
+}  // namespace Polynomial
+}  // namespace Math
+
+#endif  // SRC_MATH_POLYNOMIAL_POLYNOMIAL_HPP_
@@ -20,58 +20,85 @@ BlurPostProcess::BlurPostProcess(double radius)
     : radius(radius) {
 }
 
+namespace {
+
+// cumulative[i] sums the weights of offsets -half to i - half - 1
+std::vector<double> cumulativeWeights(const std::vector<double>& weights) {
+    std::vector<double> cumulative(weights.size() + 1, 0.0);
+    for (size_t i = 0; i < weights.size(); ++i)
+        cumulative[i + 1] = cumulative[i] + weights[i];
+    return cumulative;
+}
+
+}  // namespace
+
 std::vector<Math::Vector3D> BlurPostProcess::processFrameBuffer(
   const std::vector<Math::Vector3D>& frameBuffer,
   int width, int height) const {
-  std::vector<Math::Vector3D> result(frameBuffer.size());
-
-  int kernelSize = static_cast<int>(radius * 2 + 1);
-  double sigma = radius / 3.0;
-  double twoSigmaSquared = 2.0 * sigma * sigma;
-
-  for (int y = 0; y < height; ++y) {
-      for (int x = 0; x < width; ++x) {
-          int pixelIndex = y * width + x;
-
-          double sumR = 0.0;
-          double sumG = 0.0;
-          double sumB = 0.0;
-          double weightSum = 0.0;
-
-          for (int ky = -kernelSize/2; ky <= kernelSize/2; ++ky) {
-              for (int kx = -kernelSize/2; kx <= kernelSize/2; ++kx) {
-                  int sampleX = x + kx;
-                  int sampleY = y + ky;
+  std::vector<Math::Vector3D> frame = frameBuffer;
+  std::vector<Math::Vector3D> scratch;
 
-                  if (sampleX < 0 || sampleX >= width || sampleY < 0 || sampleY >= height) {
-                      continue;
-                  }
-
-                  double distance = kx*kx + ky*ky;
-
-                  double weight = std::exp(-distance / twoSigmaSquared);
+  processInPlace(frame, scratch, width, height, serialFor);
+  return frame;
+}
 
-                  int sampleIndex = sampleY * width + sampleX;
-                  const Math::Vector3D& sampleColor = frameBuffer[sampleIndex];
+void BlurPostProcess::processInPlace(std::vector<Math::Vector3D>& frame,
+  std::vector<Math::Vector3D>& scratch, int width, int height,
+  const ParallelFor& parallelFor) const {
+  int half = static_cast<int>(radius * 2 + 1) / 2;
+  if (half <= 0 || width <= 0 || height <= 0)
+      return;
 
-                  sumR += sampleColor.X * weight;
-                  sumG += sampleColor.Y * weight;
-                  sumB += sampleColor.Z * weight;
-                  weightSum += weight;
+  // weights[k + half] is the 1D weight of offset k, the 2D kernel is their product
+  double sigma = radius / 3.0;
+  double twoSigmaSquared = 2.0 * sigma * sigma;
+  std::vector<double> weights(2 * half + 1);
+  for (int k = -half; k <= half; ++k)
+      weights[k + half] = std::exp(-(k * k) / twoSigmaSquared);
+  std::vector<double> cumulative = cumulativeWeights(weights);
+
+  scratch.resize(frame.size());
+  forEachRowBand(parallelFor, height, [&](int firstRow, int endRow) {
+      for (int y = firstRow; y < endRow; ++y) {
+          const Math::Vector3D *row = frame.data() + y * width;
+          for (int x = 0; x < width; ++x) {
+              int first = std::max(-half, -x);
+              int last = std::min(half, width - 1 - x);
+              double sumR = 0.0;
+              double sumG = 0.0;
+              double sumB = 0.0;
+              for (int k = first; k <= last; ++k) {
+                  double weight = weights[k + half];
+                  sumR += row[x + k].X * weight;
+                  sumG += row[x + k].Y * weight;
+                  sumB += row[x + k].Z * weight;
               }
+              double inverse = 1.0 / (cumulative[last + half + 1] - cumulative[first + half]);
+              scratch[y * width + x] = Math::Vector3D(
+                  Math::Coords{sumR * inverse, sumG * inverse, sumB * inverse});
           }
-
-          if (weightSum > 0) {
-              result[pixelIndex] = Math::Vector3D(
-                  Math::Coords{sumR / weightSum, sumG / weightSum, sumB / weightSum}
-              );
-          } else {
-              result[pixelIndex] = frameBuffer[pixelIndex];
+      }
+  });
+  // Whole rows of the horizontal pass are accumulated at once, reading memory in order
+  forEachRowBand(parallelFor, height, [&](int firstRow, int endRow) {
+      for (int y = firstRow; y < endRow; ++y) {
+          int first = std::max(-half, -y);
+          int last = std::min(half, height - 1 - y);
+          double inverse = 1.0 / (cumulative[last + half + 1] - cumulative[first + half]);
+          Math::Vector3D *out = frame.data() + y * width;
+          for (int x = 0; x < width; ++x)
+              out[x] = Math::Vector3D(Math::Coords{0.0, 0.0, 0.0});
+          for (int k = first; k <= last; ++k) {
+              double weight = weights[k + half] * inverse;
+              const Math::Vector3D *in = scratch.data() + (y + k) * width;
+              for (int x = 0; x < width; ++x) {
+                  out[x].X += in[x].X * weight;
+                  out[x].Y += in[x].Y * weight;
+                  out[x].Z += in[x].Z * weight;
+              }
           }
       }
-  }
-
-  return result;
+  });
 }
 
 std::string BlurPostProcess::getTypeName() const {
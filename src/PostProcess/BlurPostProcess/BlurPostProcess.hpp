@@ -18,6 +18,13 @@
 
 namespace RayTracer {
 
+/**
+ * @brief Gaussian blur of the frame, sigma being a third of the radius
+ *
+ * The kernel is applied as a horizontal then a vertical pass, both over
+ * bands of rows in parallel. Near the borders the weights of the samples
+ * inside the frame are renormalized.
+ */
 class BlurPostProcess : public IPostProcess {
  private:
     double radius;
@@ -36,6 +43,9 @@ class BlurPostProcess : public IPostProcess {
     std::vector<Math::Vector3D> processFrameBuffer(
         const std::vector<Math::Vector3D>& frameBuffer,
         int width, int height) const override;
+    void processInPlace(std::vector<Math::Vector3D>& frame,
+        std::vector<Math::Vector3D>& scratch, int width, int height,
+        const ParallelFor& parallelFor) const override;
 
     /**
      * @brief Get a parameter value by name
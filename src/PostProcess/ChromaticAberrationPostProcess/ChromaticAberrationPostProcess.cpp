@@ -22,50 +22,54 @@ ChromaticAberrationPostProcess::ChromaticAberrationPostProcess(double strength)
 std::vector<Math::Vector3D> ChromaticAberrationPostProcess::processFrameBuffer(
     const std::vector<Math::Vector3D>& frameBuffer,
     int width, int height) const {
+    std::vector<Math::Vector3D> frame = frameBuffer;
+    std::vector<Math::Vector3D> scratch;
 
-    std::vector<Math::Vector3D> result(frameBuffer.size());
+    processInPlace(frame, scratch, width, height, serialFor);
+    return frame;
+}
 
+void ChromaticAberrationPostProcess::processInPlace(std::vector<Math::Vector3D>& frame,
+    std::vector<Math::Vector3D>& scratch, int width, int height,
+    const ParallelFor& parallelFor) const {
     double centerX = width / 2.0;
     double centerY = height / 2.0;
 
-    std::vector<Math::Vector3D> buffer = frameBuffer;
-
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
-            int pixelIndex = y * width + x;
+    // Pixels read their neighbours, so the result goes to scratch first
+    scratch.resize(frame.size());
+    forEachRowBand(parallelFor, height, [&](int firstRow, int endRow) {
+        for (int y = firstRow; y < endRow; ++y) {
+            for (int x = 0; x < width; ++x) {
+                int pixelIndex = y * width + x;
 
-            double dirX = (x - centerX) / centerX;
-            double dirY = (y - centerY) / centerY;
+                double dirX = (x - centerX) / centerX;
+                double dirY = (y - centerY) / centerY;
 
-            double distance = std::sqrt(dirX * dirX + dirY * dirY);
+                double distance = std::sqrt(dirX * dirX + dirY * dirY);
 
-            double offset = distance * strength;
+                double offset = distance * strength;
 
-            int redOffsetX = static_cast<int>(offset * dirX);
-            int redOffsetY = static_cast<int>(offset * dirY);
+                int redOffsetX = static_cast<int>(offset * dirX);
+                int redOffsetY = static_cast<int>(offset * dirY);
 
-            int blueOffsetX = -redOffsetX;
-            int blueOffsetY = -redOffsetY;
+                int blueOffsetX = -redOffsetX;
+                int blueOffsetY = -redOffsetY;
 
-            double r = 0.0, g = 0.0, b = 0.0;
+                int redX = std::clamp(x + redOffsetX, 0, width - 1);
+                int redY = std::clamp(y + redOffsetY, 0, height - 1);
+                double r = frame[redY * width + redX].X;
 
-            int redX = std::clamp(x + redOffsetX, 0, width - 1);
-            int redY = std::clamp(y + redOffsetY, 0, height - 1);
-            const Math::Vector3D& redSample = buffer[redY * width + redX];
-            r = redSample.X;
+                double g = frame[pixelIndex].Y;
 
-            g = buffer[pixelIndex].Y;
+                int blueX = std::clamp(x + blueOffsetX, 0, width - 1);
+                int blueY = std::clamp(y + blueOffsetY, 0, height - 1);
+                double b = frame[blueY * width + blueX].Z;
 
-            int blueX = std::clamp(x + blueOffsetX, 0, width - 1);
-            int blueY = std::clamp(y + blueOffsetY, 0, height - 1);
-            const Math::Vector3D& blueSample = buffer[blueY * width + blueX];
-            b = blueSample.Z;
-
-            result[pixelIndex] = Math::Vector3D(Math::Coords{r, g, b});
+                scratch[pixelIndex] = Math::Vector3D(Math::Coords{r, g, b});
+            }
         }
-    }
-
-    return result;
+    });
+    frame.swap(scratch);
 }
 
 std::string ChromaticAberrationPostProcess::getTypeName() const {
@@ -20,22 +20,32 @@ GrayscalePostProcess::GrayscalePostProcess(double intensity)
 std::vector<Math::Vector3D> GrayscalePostProcess::processFrameBuffer(
     const std::vector<Math::Vector3D>& frameBuffer,
     int width, int height) const {
+    std::vector<Math::Vector3D> frame = frameBuffer;
+    std::vector<Math::Vector3D> scratch;
 
-    std::vector<Math::Vector3D> result(frameBuffer.size());
+    processInPlace(frame, scratch, width, height, serialFor);
+    return frame;
+}
 
-    for (size_t i = 0; i < frameBuffer.size(); ++i) {
-        const Math::Vector3D& color = frameBuffer[i];
+void GrayscalePostProcess::processInPlace(std::vector<Math::Vector3D>& frame,
+    std::vector<Math::Vector3D>& scratch, int width, int height,
+    const ParallelFor& parallelFor) const {
+    (void)scratch;
+    forEachRowBand(parallelFor, height, [&](int firstRow, int endRow) {
+        processPixels(frame.data() + firstRow * width, (endRow - firstRow) * width);
+    });
+}
 
-        double grayValue = 0.299 * color.X + 0.587 * color.Y + 0.114 * color.Z;
+void GrayscalePostProcess::processPixels(Math::Vector3D* colors, int count) const {
+    for (int i = 0; i < count; ++i) {
+        Math::Vector3D& color = colors[i];
 
-        double r = color.X * (1.0 - intensity) + grayValue * intensity;
-        double g = color.Y * (1.0 - intensity) + grayValue * intensity;
-        double b = color.Z * (1.0 - intensity) + grayValue * intensity;
+        double grayValue = 0.299 * color.X + 0.587 * color.Y + 0.114 * color.Z;
 
-        result[i] = Math::Vector3D(Math::Coords{r, g, b});
+        color.X = color.X * (1.0 - intensity) + grayValue * intensity;
+        color.Y = color.Y * (1.0 - intensity) + grayValue * intensity;
+        color.Z = color.Z * (1.0 - intensity) + grayValue * intensity;
     }
-
-    return result;
 }
 
 std::string GrayscalePostProcess::getTypeName() const {
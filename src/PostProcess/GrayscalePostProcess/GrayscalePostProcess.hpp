@@ -26,6 +26,11 @@ class GrayscalePostProcess : public IPostProcess {
     std::vector<Math::Vector3D> processFrameBuffer(
         const std::vector<Math::Vector3D>& frameBuffer,
         int width, int height) const override;
+    void processInPlace(std::vector<Math::Vector3D>& frame,
+        std::vector<Math::Vector3D>& scratch, int width, int height,
+        const ParallelFor& parallelFor) const override;
+    bool isPerPixel() const override { return true; }
+    void processPixels(Math::Vector3D* colors, int count) const override;
 
     /**
      * @brief Get a parameter value by name
@@ -8,6 +8,8 @@
 
 #ifndef SRC_POSTPROCESS_IPOSTPROCESS_HPP_
     #define SRC_POSTPROCESS_IPOSTPROCESS_HPP_
+    #include <algorithm>
+    #include <functional>
     #include <memory>
     #include <vector>
     #include <optional>
@@ -17,6 +19,30 @@
 
 namespace RayTracer {
 
+/**
+ * @brief Runs task(0) to task(count - 1), possibly on several threads, and
+ * returns once they are all done
+ */
+using ParallelFor = std::function<void(int count, const std::function<void(int)> &task)>;
+
+inline void serialFor(int count, const std::function<void(int)> &task) {
+    for (int i = 0; i < count; ++i)
+        task(i);
+}
+
+/**
+ * @brief Splits rows [0, height) into bands and runs band(firstRow, endRow) on each
+ */
+inline void forEachRowBand(const ParallelFor &parallelFor, int height,
+    const std::function<void(int, int)> &band) {
+    constexpr int ROWS_PER_BAND = 16;
+    int bands = (height + ROWS_PER_BAND - 1) / ROWS_PER_BAND;
+    parallelFor(bands, [&](int index) {
+        int firstRow = index * ROWS_PER_BAND;
+        band(firstRow, std::min(height, firstRow + ROWS_PER_BAND));
+    });
+}
+
 class IPostProcess {
  public:
     virtual ~IPostProcess() = default;
@@ -25,6 +51,37 @@ class IPostProcess {
         const std::vector<Math::Vector3D>& frameBuffer,
         int width, int height) const = 0;
 
+    /**
+     * @brief Processes frame without allocating a new buffer per frame
+     * @param frame Input, and the output once the call returns
+     * @param scratch Buffer the effect may resize and overwrite, kept by the
+     * caller between frames
+     * @param parallelFor Runs independent parts of the work, e.g. row bands
+     */
+    virtual void processInPlace(std::vector<Math::Vector3D>& frame,
+        std::vector<Math::Vector3D>& scratch, int width, int height,
+        const ParallelFor& parallelFor) const {
+        (void)scratch;
+        (void)parallelFor;
+        frame = processFrameBuffer(frame, width, height);
+    }
+
+    /**
+     * @brief Whether each output pixel only depends on the same input pixel
+     *
+     * Consecutive per-pixel effects are fused into a single pass over the
+     * frame through processPixels, instead of one processInPlace pass each.
+     */
+    virtual bool isPerPixel() const { return false; }
+
+    /**
+     * @brief Applies a per-pixel effect to count consecutive colors
+     */
+    virtual void processPixels(Math::Vector3D* colors, int count) const {
+        (void)colors;
+        (void)count;
+    }
+
     virtual std::string getTypeName() const = 0;
 
     virtual double getParameter(const std::string& paramName) const = 0;
@@ -33,6 +90,51 @@ class IPostProcess {
     virtual void getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) const = 0;
 };
 
+/**
+ * @brief Applies effects to frame in order, in place
+ *
+ * Consecutive per-pixel effects run in one pass over small blocks, each
+ * block going through all of them while it is in cache; the others run
+ * processInPlace between those passes.
+ * @param output Called on each block of finished pixels, as output(firstIndex, count),
+ * in the same pass as the trailing per-pixel effects, or in a pass of its own
+ * when the chain ends with another effect
+ */
+inline void applyPostProcessChain(const std::vector<std::shared_ptr<IPostProcess>> &effects,
+    std::vector<Math::Vector3D> &frame, std::vector<Math::Vector3D> &scratch,
+    int width, int height, const ParallelFor &parallelFor,
+    const std::function<void(int, int)> &output = nullptr) {
+    // Small enough for a block to stay in L1 through the whole chain
+    constexpr int PIXELS_PER_BLOCK = 512;
+    size_t effectCount = effects.size();
+    size_t first = 0;
+
+    while (first < effectCount || output) {
+        if (first < effectCount && !effects[first]->isPerPixel()) {
+            effects[first]->processInPlace(frame, scratch, width, height, parallelFor);
+            ++first;
+            continue;
+        }
+        size_t end = first;
+        while (end < effectCount && effects[end]->isPerPixel())
+            ++end;
+        // The output joins the pass of the effects that end the chain
+        bool last = end == effectCount;
+        forEachRowBand(parallelFor, height, [&](int firstRow, int endRow) {
+            for (int index = firstRow * width; index < endRow * width; index += PIXELS_PER_BLOCK) {
+                int count = std::min(PIXELS_PER_BLOCK, endRow * width - index);
+                for (size_t i = first; i < end; ++i)
+                    effects[i]->processPixels(frame.data() + index, count);
+                if (last && output)
+                    output(index, count);
+            }
+        });
+        if (last)
+            return;
+        first = end;
+    }
+}
+
 }  // namespace RayTracer
 
 #endif  // SRC_POSTPROCESS_IPOSTPROCESS_HPP_
@@ -20,23 +20,30 @@ NegativePostProcess::NegativePostProcess(double intensity)
 std::vector<Math::Vector3D> NegativePostProcess::processFrameBuffer(
     const std::vector<Math::Vector3D>& frameBuffer,
     int width, int height) const {
+    std::vector<Math::Vector3D> frame = frameBuffer;
+    std::vector<Math::Vector3D> scratch;
 
-    std::vector<Math::Vector3D> result(frameBuffer.size());
-
-    for (size_t i = 0; i < frameBuffer.size(); ++i) {
-        const Math::Vector3D& color = frameBuffer[i];
+    processInPlace(frame, scratch, width, height, serialFor);
+    return frame;
+}
 
-        double r = 1.0 - color.X;
-        double g = 1.0 - color.Y;
-        double b = 1.0 - color.Z;
+void NegativePostProcess::processInPlace(std::vector<Math::Vector3D>& frame,
+    std::vector<Math::Vector3D>& scratch, int width, int height,
+    const ParallelFor& parallelFor) const {
+    (void)scratch;
+    forEachRowBand(parallelFor, height, [&](int firstRow, int endRow) {
+        processPixels(frame.data() + firstRow * width, (endRow - firstRow) * width);
+    });
+}
 
-        r = color.X * (1.0 - intensity) + r * intensity;
-        g = color.Y * (1.0 - intensity) + g * intensity;
-        b = color.Z * (1.0 - intensity) + b * intensity;
+void NegativePostProcess::processPixels(Math::Vector3D* colors, int count) const {
+    for (int i = 0; i < count; ++i) {
+        Math::Vector3D& color = colors[i];
 
-        result[i] = Math::Vector3D(Math::Coords{r, g, b});
+        color.X = color.X * (1.0 - intensity) + (1.0 - color.X) * intensity;
+        color.Y = color.Y * (1.0 - intensity) + (1.0 - color.Y) * intensity;
+        color.Z = color.Z * (1.0 - intensity) + (1.0 - color.Z) * intensity;
     }
-    return result;
 }
 
 std::string NegativePostProcess::getTypeName() const {
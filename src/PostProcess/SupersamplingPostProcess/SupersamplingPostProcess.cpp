@@ -16,8 +16,8 @@
 
 namespace RayTracer {
 
-SupersamplingPostProcess::SupersamplingPostProcess(int samplesPerPixel)
-    : samplesPerPixel(samplesPerPixel) {
+SupersamplingPostProcess::SupersamplingPostProcess(int samplesPerPixel, double threshold)
+    : samplesPerPixel(samplesPerPixel), threshold(std::max(0.0, threshold)) {
     if (samplesPerPixel < 1) {
         this->samplesPerPixel = 1;
     }
@@ -33,6 +33,16 @@ std::vector<Math::Vector3D> SupersamplingPostProcess::processFrameBuffer(
     return frameBuffer;
 }
 
+void SupersamplingPostProcess::processInPlace(std::vector<Math::Vector3D>& frame,
+    std::vector<Math::Vector3D>& scratch, int width, int height,
+    const ParallelFor& parallelFor) const {
+    (void)frame;
+    (void)scratch;
+    (void)width;
+    (void)height;
+    (void)parallelFor;
+}
+
 std::string SupersamplingPostProcess::getTypeName() const {
     return getTypeNameStatic();
 }
@@ -42,11 +52,12 @@ std::string SupersamplingPostProcess::getTypeNameStatic() {
 }
 
 std::shared_ptr<IPostProcess> SupersamplingPostProcess::clone() const {
-    return std::make_shared<SupersamplingPostProcess>(samplesPerPixel);
+    return std::make_shared<SupersamplingPostProcess>(samplesPerPixel, threshold);
 }
 
 void SupersamplingPostProcess::getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) const {
     setting->add("samplesPerPixel", libconfig::Setting::TypeInt) = samplesPerPixel;
+    setting->add("threshold", libconfig::Setting::TypeFloat) = threshold;
 }
 
 }  // namespace RayTracer
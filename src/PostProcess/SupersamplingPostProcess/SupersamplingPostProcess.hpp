@@ -24,15 +24,22 @@ namespace RayTracer {
  * This post-processor doesn't directly modify the framebuffer like other
  * post-processors. Instead, it works at the ray generation stage by generating
  * multiple rays per pixel and averaging the results.
+ * Sampling is adaptive: pixels whose first few samples differ by less than
+ * threshold, from each other and from their neighbours, stop there.
  */
 class SupersamplingPostProcess : public IPostProcess {
  private:
     int samplesPerPixel; // Number of samples per pixel (e.g., 4, 9, 16)
+    double threshold; // Display space contrast that triggers every sample, 0 always takes them all
     mutable std::vector<Math::Vector3D> imageBuffer;
     mutable std::mutex bufferMutex;
 
  public:
-    explicit SupersamplingPostProcess(int samplesPerPixel = 4);
+    // Under three 8 bit levels after gamma, where more samples barely change the pixel
+    static constexpr double DEFAULT_THRESHOLD = 0.01;
+
+    explicit SupersamplingPostProcess(int samplesPerPixel = 4,
+        double threshold = DEFAULT_THRESHOLD);
     ~SupersamplingPostProcess() override = default;
 
     /**
@@ -46,6 +53,9 @@ class SupersamplingPostProcess : public IPostProcess {
     std::vector<Math::Vector3D> processFrameBuffer(
         const std::vector<Math::Vector3D>& frameBuffer,
         int width, int height) const override;
+    void processInPlace(std::vector<Math::Vector3D>& frame,
+        std::vector<Math::Vector3D>& scratch, int width, int height,
+        const ParallelFor& parallelFor) const override;
 
     /**
      * @brief Get the number of samples per pixel used by the supersampling algorithm
@@ -54,6 +64,13 @@ class SupersamplingPostProcess : public IPostProcess {
      */
     int getSamplesPerPixel() const { return samplesPerPixel; }
 
+    /**
+     * @brief Get the contrast above which a pixel takes every sample
+     *
+     * @return The contrast threshold, in display space
+     */
+    double getThreshold() const { return threshold; }
+
     /**
      * @brief Get a parameter value by name
      *
@@ -64,6 +81,9 @@ class SupersamplingPostProcess : public IPostProcess {
         if (paramName == "samples") {
             return static_cast<double>(samplesPerPixel);
         }
+        if (paramName == "threshold") {
+            return threshold;
+        }
         return 0.0;
     }
 
@@ -31,7 +31,11 @@ std::shared_ptr<IPostProcess> SupersamplingPostProcessPlugin::createPostProcess(
     }
 
     int samplesPerPixel = static_cast<int>(params.at("samplesPerPixel"));
-    return std::make_shared<SupersamplingPostProcess>(samplesPerPixel);
+    double threshold = SupersamplingPostProcess::DEFAULT_THRESHOLD;
+    if (params.find("threshold") != params.end()) {
+        threshold = params.at("threshold");
+    }
+    return std::make_shared<SupersamplingPostProcess>(samplesPerPixel, threshold);
 }
 
 std::vector<std::string> SupersamplingPostProcessPlugin::getRequiredParameters() const {
@@ -45,7 +49,11 @@ std::shared_ptr<IPostProcess> SupersamplingPostProcessPlugin::createPostProcessF
     }
 
     int samplesPerPixel = static_cast<int>(setting["samplesPerPixel"]);
-    return std::make_shared<SupersamplingPostProcess>(samplesPerPixel);
+    double threshold = SupersamplingPostProcess::DEFAULT_THRESHOLD;
+    if (setting.exists("threshold")) {
+        threshold = static_cast<double>(setting["threshold"]);
+    }
+    return std::make_shared<SupersamplingPostProcess>(samplesPerPixel, threshold);
 }
 
 } // namespace RayTracer
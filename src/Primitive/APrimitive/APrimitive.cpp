@@ -15,7 +15,7 @@ APrimitive::APrimitive() : material(std::make_shared<Material>()) {}
 APrimitive::APrimitive(const std::shared_ptr<Material> &material)
 : material(material) {}
 
-std::shared_ptr<Material> APrimitive::getMaterial() const { return material; }
+const std::shared_ptr<Material> &APrimitive::getMaterial() const { return material; }
 
 void APrimitive::rotateX(double degrees) { rotationX += degrees; }
 
@@ -27,4 +27,6 @@ void APrimitive::setSourceFile(const std::string& source) { sourceFile = source;
 
 std::string APrimitive::getSourceFile() const { return sourceFile; }
 
+Math::AABB APrimitive::getBoundingBox() const { return Math::AABB::infinite(); }
+
 }  // namespace RayTracer
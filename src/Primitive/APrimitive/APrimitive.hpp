@@ -26,7 +26,7 @@ class APrimitive : public IPrimitive {
     explicit APrimitive(const std::shared_ptr<Material> &material);
     virtual ~APrimitive() = default;
 
-    std::shared_ptr<Material> getMaterial() const override;
+    const std::shared_ptr<Material> &getMaterial() const override;
     void rotateX(double degrees) override;
     void rotateY(double degrees) override;
     void rotateZ(double degrees) override;
@@ -43,6 +43,7 @@ class APrimitive : public IPrimitive {
         double tMin, double tMax) = 0;
 
     Math::Point3D getPosition() const override = 0;
+    Math::AABB getBoundingBox() const override;
 };
 }   // namespace RayTracer
 
@@ -0,0 +1,132 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** BVH implementation
+*/
+#include <memory>
+#include <vector>
+#include "Primitive/BVH/BVH.hpp"
+
+namespace RayTracer {
+
+void BVH::build(const std::vector<std::shared_ptr<IPrimitive>> &primitives) {
+    clear();
+    std::vector<std::shared_ptr<IPrimitive>> bounded;
+    std::vector<Math::AABB> bounds;
+
+    for (const auto &primitive : primitives) {
+        Math::AABB box = primitive->getBoundingBox();
+        if (box.isEmpty())
+            continue;
+        if (!box.isBounded()) {
+            _unbounded.push_back(primitive);
+            continue;
+        }
+        bounded.push_back(primitive);
+        bounds.push_back(box);
+    }
+    _tree.build(bounds);
+    _bounded.reserve(bounded.size());
+    for (int index : _tree.getOrder())
+        _bounded.push_back(bounded[index]);
+    _built = true;
+}
+
+void BVH::refit() {
+    _tree.refit([this](int slot) {
+        return _bounded[slot]->getBoundingBox();
+    });
+}
+
+void BVH::clear() {
+    _tree.clear();
+    _bounded.clear();
+    _unbounded.clear();
+    _built = false;
+}
+
+Math::AABB BVH::getBounds() const {
+    return _tree.getBounds();
+}
+
+std::optional<HitInfo> BVH::hit(const Ray &ray, double tMin,
+double tMax) const {
+    std::optional<HitInfo> closestHit;
+    double closest = tMax;
+
+    for (const auto &primitive : _unbounded) {
+        auto hit = primitive->hit(ray, tMin, closest);
+        if (hit) {
+            closest = hit->distance;
+            closestHit = hit;
+        }
+    }
+    _tree.traverse(ray, tMin, closest, false,
+        [this, &ray, &closestHit](int slot, double slotMin, double &slotMax) {
+            auto hit = _bounded[slot]->hit(ray, slotMin, slotMax);
+            if (!hit)
+                return false;
+            slotMax = hit->distance;
+            closestHit = hit;
+            return true;
+        });
+    return closestHit;
+}
+
+std::optional<ClosestHit> BVH::closestHit(const Ray &ray, double tMin,
+double tMax) const {
+    ClosestHit closest{tMax, nullptr};
+
+    for (const auto &primitive : _unbounded) {
+        auto distance = primitive->intersect(ray, tMin, closest.distance);
+        if (distance)
+            closest = {*distance, primitive.get()};
+    }
+    _tree.traverse(ray, tMin, closest.distance, false,
+        [this, &ray, &closest](int slot, double slotMin, double &slotMax) {
+            auto distance = _bounded[slot]->intersect(ray, slotMin, slotMax);
+            if (!distance)
+                return false;
+            slotMax = *distance;
+            closest.primitive = _bounded[slot].get();
+            return true;
+        });
+    if (!closest.primitive)
+        return std::nullopt;
+    return closest;
+}
+
+bool BVH::anyHit(const Ray &ray, double tMin, double tMax) const {
+    return findOccluder(ray, tMin, tMax) != nullptr;
+}
+
+IPrimitive *BVH::findOccluder(const Ray &ray, double tMin, double tMax) const {
+    IPrimitive *occluder = nullptr;
+
+    for (const auto &primitive : _unbounded) {
+        if (primitive->occluded(ray, tMin, tMax))
+            return primitive.get();
+    }
+    _tree.traverse(ray, tMin, tMax, true,
+        [this, &ray, &occluder](int slot, double slotMin, double &slotMax) {
+            if (!_bounded[slot]->occluded(ray, slotMin, slotMax))
+                return false;
+            occluder = _bounded[slot].get();
+            return true;
+        });
+    return occluder;
+}
+
+void BVH::hitPacket(const RayPacket &packet, double tMin,
+PacketHit &hits) const {
+    for (const auto &primitive : _unbounded)
+        primitive->hitPacket(packet, tMin, hits);
+    _tree.traversePacket(packet, tMin, hits.distance,
+        [this, &packet, tMin, &hits](int slot) {
+            _bounded[slot]->hitPacket(packet, tMin, hits);
+        });
+}
+
+}  // namespace RayTracer
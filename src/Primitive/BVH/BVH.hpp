@@ -0,0 +1,118 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** BVH
+*/
+
+#ifndef SRC_PRIMITIVE_BVH_BVH_HPP_
+    #define SRC_PRIMITIVE_BVH_BVH_HPP_
+    #include <memory>
+    #include <optional>
+    #include <vector>
+    #include "defs.hpp"
+    #include "Math/AABB/AABB.hpp"
+    #include "Primitive/BVH/BVHTree.hpp"
+    #include "Primitive/IPrimitive.hpp"
+    #include "Ray/Ray.hpp"
+    #include "Ray/RayPacket.hpp"
+
+namespace RayTracer {
+/**
+ * @brief Bounding volume hierarchy over a set of primitives
+ *
+ * Primitives reporting infinite bounds (planes, infinite cylinders...) can
+ * not be placed in the tree, they are kept aside and tested on every ray.
+ */
+class BVH {
+ public:
+    BVH() = default;
+
+    /**
+     * @brief Builds the hierarchy over the given primitives
+     * @param primitives The primitives to index
+     */
+    void build(const std::vector<std::shared_ptr<IPrimitive>> &primitives);
+
+    /**
+     * @brief Recomputes every node bounds after primitives moved, keeping the topology
+     */
+    void refit();
+
+    /**
+     * @brief Drops the hierarchy
+     */
+    void clear();
+
+    /**
+     * @brief Tells whether build() was called since the last clear()
+     * @return True if the hierarchy can be queried
+     */
+    bool isBuilt() const { return _built; }
+
+    /**
+     * @brief Gets the bounds of the bounded primitives
+     * @return The root bounds, empty if there is none
+     */
+    Math::AABB getBounds() const;
+
+    /**
+     * @brief Tells whether some primitives were kept out of the tree
+     * @return True if at least one primitive has infinite bounds
+     */
+    bool hasUnboundedPrimitives() const { return !_unbounded.empty(); }
+
+    /**
+     * @brief Finds the closest hit along a ray
+     * @param ray The ray to trace
+     * @param tMin The minimum accepted distance
+     * @param tMax The maximum accepted distance
+     * @return Information about the closest hit, if any
+     */
+    std::optional<HitInfo> hit(const Ray &ray, double tMin, double tMax) const;
+
+    /**
+     * @brief Finds the closest primitive along a ray without evaluating its surface
+     * @param ray The ray to trace
+     * @param tMin The minimum accepted distance
+     * @param tMax The maximum accepted distance
+     * @return The closest primitive and its distance, if any
+     */
+    std::optional<ClosestHit> closestHit(const Ray &ray, double tMin, double tMax) const;
+
+    /**
+     * @brief Checks if anything is hit along a ray, stopping at the first hit
+     * @param ray The ray to trace
+     * @param tMin The minimum accepted distance
+     * @param tMax The maximum accepted distance
+     * @return True if any primitive is hit in [tMin, tMax]
+     */
+    bool anyHit(const Ray &ray, double tMin, double tMax) const;
+
+    /**
+     * @brief Finds a primitive blocking a ray, stopping at the first one
+     * @param ray The ray to trace
+     * @param tMin The minimum accepted distance
+     * @param tMax The maximum accepted distance
+     * @return The first primitive found in [tMin, tMax], not the closest; nullptr if none
+     */
+    IPrimitive *findOccluder(const Ray &ray, double tMin, double tMax) const;
+
+    /**
+     * @brief Finds the closest primitive along every ray of a packet
+     * @param packet The rays to trace
+     * @param tMin The minimum accepted distance
+     * @param hits Per-lane closest distance and primitive, updated in place
+     */
+    void hitPacket(const RayPacket &packet, double tMin, PacketHit &hits) const;
+
+ private:
+    BVHTree _tree;
+    std::vector<std::shared_ptr<IPrimitive>> _bounded;
+    std::vector<std::shared_ptr<IPrimitive>> _unbounded;
+    bool _built = false;
+};
+}  // namespace RayTracer
+
+#endif  // SRC_PRIMITIVE_BVH_BVH_HPP_
@@ -0,0 +1,226 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** BVHTree implementation
+*/
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#endif
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include "Primitive/BVH/BVHTree.hpp"
+
+namespace RayTracer {
+
+namespace {
+double axisValue(const Math::Point3D &point, int axis) {
+    if (axis == 0)
+        return point.X;
+    return axis == 1 ? point.Y : point.Z;
+}
+}  // namespace
+
+void BVHTree::build(const std::vector<Math::AABB> &bounds) {
+    clear();
+    if (bounds.empty())
+        return;
+    _order.resize(bounds.size());
+    for (size_t i = 0; i < _order.size(); i++)
+        _order[i] = static_cast<int>(i);
+    _nodes.reserve(2 * bounds.size() / MAX_LEAF_SIZE + 1);
+    buildNode(bounds, 0, static_cast<int>(bounds.size()), 0);
+}
+
+void BVHTree::clear() {
+    _nodes.clear();
+    _order.clear();
+}
+
+Math::AABB BVHTree::getBounds() const {
+    if (_nodes.empty())
+        return Math::AABB();
+    return _nodes[0].bounds;
+}
+
+int BVHTree::buildNode(const std::vector<Math::AABB> &bounds, int first,
+int count, int depth) {
+    int nodeIndex = static_cast<int>(_nodes.size());
+    _nodes.emplace_back();
+
+    Math::AABB nodeBounds;
+    Math::AABB centroidBounds;
+    for (int i = first; i < first + count; i++) {
+        nodeBounds.expand(bounds[_order[i]]);
+        centroidBounds.expand(bounds[_order[i]].centroid());
+    }
+    _nodes[nodeIndex].bounds = nodeBounds;
+
+    int axis = centroidBounds.longestAxis();
+    double spread = axisValue(centroidBounds.max, axis)
+        - axisValue(centroidBounds.min, axis);
+    if (count <= MAX_LEAF_SIZE || depth >= MAX_DEPTH || spread <= 0.0) {
+        _nodes[nodeIndex].first = first;
+        _nodes[nodeIndex].count = count;
+        return nodeIndex;
+    }
+
+    int half = findSahSplit(bounds, first, count, nodeBounds,
+        centroidBounds, axis);
+    if (half == 0) {
+        _nodes[nodeIndex].first = first;
+        _nodes[nodeIndex].count = count;
+        return nodeIndex;
+    }
+    if (half < 0) {
+        half = count / 2;
+        std::nth_element(_order.begin() + first, _order.begin() + first + half,
+            _order.begin() + first + count, [&bounds, axis](int a, int b) {
+                return axisValue(bounds[a].centroid(), axis)
+                    < axisValue(bounds[b].centroid(), axis);
+            });
+    }
+
+    int left = buildNode(bounds, first, half, depth + 1);
+    int right = buildNode(bounds, first + half, count - half, depth + 1);
+    _nodes[nodeIndex].left = left;
+    _nodes[nodeIndex].right = right;
+    return nodeIndex;
+}
+
+/**
+ * @brief Partitions a node range along the cheapest binned SAH plane
+ * @return The size of the left half, 0 if a leaf is cheaper than any split,
+ * or -1 when binning could not separate the primitives
+ */
+int BVHTree::findSahSplit(const std::vector<Math::AABB> &bounds, int first,
+int count, const Math::AABB &nodeBounds, const Math::AABB &centroidBounds,
+int axis) {
+    struct Bin {
+        Math::AABB bounds;
+        int count = 0;
+    };
+    Bin bins[SAH_BINS];
+    double axisMin = axisValue(centroidBounds.min, axis);
+    double binScale = SAH_BINS / (axisValue(centroidBounds.max, axis) - axisMin);
+    auto binOf = [&bounds, axis, axisMin, binScale](int index) {
+        int bin = static_cast<int>(
+            (axisValue(bounds[index].centroid(), axis) - axisMin) * binScale);
+        return std::clamp(bin, 0, SAH_BINS - 1);
+    };
+
+    for (int i = first; i < first + count; i++) {
+        Bin &bin = bins[binOf(_order[i])];
+        bin.count++;
+        bin.bounds.expand(bounds[_order[i]]);
+    }
+
+    double rightArea[SAH_BINS];
+    int rightCount[SAH_BINS];
+    Math::AABB sweep;
+    int sweepCount = 0;
+    for (int b = SAH_BINS - 1; b > 0; b--) {
+        sweep.expand(bins[b].bounds);
+        sweepCount += bins[b].count;
+        rightArea[b] = sweep.surfaceArea();
+        rightCount[b] = sweepCount;
+    }
+
+    double bestCost = std::numeric_limits<double>::infinity();
+    int bestSplit = -1;
+    sweep = Math::AABB();
+    sweepCount = 0;
+    for (int b = 0; b < SAH_BINS - 1; b++) {
+        sweep.expand(bins[b].bounds);
+        sweepCount += bins[b].count;
+        if (sweepCount == 0 || rightCount[b + 1] == 0)
+            continue;
+        double cost = sweepCount * sweep.surfaceArea()
+            + rightCount[b + 1] * rightArea[b + 1];
+        if (cost < bestCost) {
+            bestCost = cost;
+            bestSplit = b;
+        }
+    }
+    if (bestSplit < 0)
+        return -1;
+
+    double nodeArea = nodeBounds.surfaceArea();
+    if (nodeArea > 0.0 && count <= MAX_SAH_LEAF_SIZE
+        && TRAVERSAL_COST + bestCost / nodeArea >= count)
+        return 0;
+
+    auto middle = std::partition(_order.begin() + first,
+        _order.begin() + first + count, [&binOf, bestSplit](int index) {
+            return binOf(index) <= bestSplit;
+        });
+    return static_cast<int>(middle - (_order.begin() + first));
+}
+
+int BVHTree::intersectPacket(const Math::AABB &box, const RayPacket &packet,
+double tMin, const double *tMax, double &nearestEntry) {
+    int mask = 0;
+    int lane = 0;
+    nearestEntry = std::numeric_limits<double>::infinity();
+
+#if defined(__AVX2__)
+    const __m256d minX = _mm256_set1_pd(box.min.X);
+    const __m256d minY = _mm256_set1_pd(box.min.Y);
+    const __m256d minZ = _mm256_set1_pd(box.min.Z);
+    const __m256d maxX = _mm256_set1_pd(box.max.X);
+    const __m256d maxY = _mm256_set1_pd(box.max.Y);
+    const __m256d maxZ = _mm256_set1_pd(box.max.Z);
+    const __m256d lowerBound = _mm256_set1_pd(tMin);
+
+    for (; lane + 4 <= packet.count; lane += 4) {
+        __m256d ox = _mm256_load_pd(packet.originX + lane);
+        __m256d oy = _mm256_load_pd(packet.originY + lane);
+        __m256d oz = _mm256_load_pd(packet.originZ + lane);
+        __m256d ix = _mm256_load_pd(packet.inverseX + lane);
+        __m256d iy = _mm256_load_pd(packet.inverseY + lane);
+        __m256d iz = _mm256_load_pd(packet.inverseZ + lane);
+        __m256d x0 = _mm256_mul_pd(_mm256_sub_pd(minX, ox), ix);
+        __m256d x1 = _mm256_mul_pd(_mm256_sub_pd(maxX, ox), ix);
+        __m256d y0 = _mm256_mul_pd(_mm256_sub_pd(minY, oy), iy);
+        __m256d y1 = _mm256_mul_pd(_mm256_sub_pd(maxY, oy), iy);
+        __m256d z0 = _mm256_mul_pd(_mm256_sub_pd(minZ, oz), iz);
+        __m256d z1 = _mm256_mul_pd(_mm256_sub_pd(maxZ, oz), iz);
+        __m256d entry = _mm256_max_pd(_mm256_max_pd(_mm256_min_pd(x0, x1),
+            _mm256_min_pd(y0, y1)), _mm256_max_pd(_mm256_min_pd(z0, z1), lowerBound));
+        __m256d exit = _mm256_min_pd(_mm256_min_pd(_mm256_max_pd(x0, x1),
+            _mm256_max_pd(y0, y1)), _mm256_min_pd(_mm256_max_pd(z0, z1),
+            _mm256_loadu_pd(tMax + lane)));
+        int hits = _mm256_movemask_pd(_mm256_cmp_pd(entry, exit, _CMP_LE_OQ));
+        if (hits == 0)
+            continue;
+        alignas(32) double entries[4];
+        _mm256_store_pd(entries, entry);
+        for (int i = 0; i < 4; i++) {
+            if (hits & (1 << i))
+                nearestEntry = std::min(nearestEntry, entries[i]);
+        }
+        mask |= hits << lane;
+    }
+#endif
+    for (; lane < packet.count; lane++) {
+        double x0 = (box.min.X - packet.originX[lane]) * packet.inverseX[lane];
+        double x1 = (box.max.X - packet.originX[lane]) * packet.inverseX[lane];
+        double y0 = (box.min.Y - packet.originY[lane]) * packet.inverseY[lane];
+        double y1 = (box.max.Y - packet.originY[lane]) * packet.inverseY[lane];
+        double z0 = (box.min.Z - packet.originZ[lane]) * packet.inverseZ[lane];
+        double z1 = (box.max.Z - packet.originZ[lane]) * packet.inverseZ[lane];
+        double entry = std::max(std::max(std::min(x0, x1), std::min(y0, y1)),
+            std::max(std::min(z0, z1), tMin));
+        double exit = std::min(std::min(std::max(x0, x1), std::max(y0, y1)),
+            std::min(std::max(z0, z1), tMax[lane]));
+        if (entry <= exit) {
+            mask |= 1 << lane;
+            nearestEntry = std::min(nearestEntry, entry);
+        }
+    }
+    return mask;
+}
+
+}  // namespace RayTracer
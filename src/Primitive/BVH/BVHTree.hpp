@@ -0,0 +1,226 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** BVHTree
+*/
+
+#ifndef SRC_PRIMITIVE_BVH_BVHTREE_HPP_
+    #define SRC_PRIMITIVE_BVH_BVHTREE_HPP_
+    #include <vector>
+    #include "Math/AABB/AABB.hpp"
+    #include "Ray/Ray.hpp"
+    #include "Ray/RayPacket.hpp"
+
+namespace RayTracer {
+/**
+ * @brief Node hierarchy over a list of bounding boxes
+ *
+ * The tree only knows about boxes: the scene BVH indexes primitives with it
+ * and meshes index their own triangles. Nodes are split with a binned
+ * surface area heuristic. Leaves reference contiguous slots, callers reorder
+ * their items with getOrder() after build() so slot i holds item getOrder()[i].
+ */
+class BVHTree {
+ public:
+    struct Node {
+        Math::AABB bounds;
+        int left = -1;
+        int right = -1;
+        int first = 0;
+        int count = 0;
+    };
+
+    BVHTree() = default;
+
+    /**
+     * @brief Builds the hierarchy over the given boxes
+     * @param bounds One bounded box per item
+     */
+    void build(const std::vector<Math::AABB> &bounds);
+
+    /**
+     * @brief Drops the hierarchy
+     */
+    void clear();
+
+    bool empty() const { return _nodes.empty(); }
+    const std::vector<int> &getOrder() const { return _order; }
+    const std::vector<Node> &getNodes() const { return _nodes; }
+
+    /**
+     * @brief Gets the bounds of every item
+     * @return The root bounds, empty if there is none
+     */
+    Math::AABB getBounds() const;
+
+    /**
+     * @brief Recomputes every node bounds, keeping the topology
+     * @param slotBounds Callable returning the current box of a slot
+     */
+    template <typename SlotBounds>
+    void refit(SlotBounds &&slotBounds) {
+        // Children are always stored after their parent
+        for (int i = static_cast<int>(_nodes.size()) - 1; i >= 0; i--) {
+            Node &node = _nodes[i];
+            Math::AABB nodeBounds;
+
+            if (node.count > 0) {
+                for (int j = node.first; j < node.first + node.count; j++)
+                    nodeBounds.expand(slotBounds(j));
+            } else {
+                nodeBounds.expand(_nodes[node.left].bounds);
+                nodeBounds.expand(_nodes[node.right].bounds);
+            }
+            node.bounds = nodeBounds;
+        }
+    }
+
+    /**
+     * @brief Walks the nodes overlapping a ray, nearest first
+     * @param ray The ray to trace
+     * @param tMin The minimum accepted distance
+     * @param closest The maximum accepted distance, shrunk by slotHit
+     * @param anyHit Stop at the first slot reporting a hit
+     * @param slotHit Callable (slot, tMin, closest&) -> bool testing one slot
+     * @return True if any slot reported a hit
+     */
+    template <typename SlotHit>
+    bool traverse(const Ray &ray, double tMin, double &closest, bool anyHit,
+    SlotHit &&slotHit) const {
+        if (_nodes.empty())
+            return false;
+        Math::Vector3D invDirection(Math::Coords{
+            1.0 / ray.direction.X,
+            1.0 / ray.direction.Y,
+            1.0 / ray.direction.Z
+        });
+        int stack[2 * MAX_DEPTH + 2];
+        int stackSize = 0;
+        double entry = 0.0;
+        bool found = false;
+
+        if (!_nodes[0].bounds.intersect(ray.origin, invDirection, tMin, closest, entry))
+            return false;
+        stack[stackSize++] = 0;
+        while (stackSize > 0) {
+            const Node &node = _nodes[stack[--stackSize]];
+
+            if (node.count > 0) {
+                for (int i = node.first; i < node.first + node.count; i++) {
+                    if (slotHit(i, tMin, closest)) {
+                        found = true;
+                        if (anyHit)
+                            return true;
+                    }
+                }
+                continue;
+            }
+            double leftEntry = 0.0;
+            double rightEntry = 0.0;
+            bool hitLeft = _nodes[node.left].bounds.intersect(ray.origin,
+                invDirection, tMin, closest, leftEntry);
+            bool hitRight = _nodes[node.right].bounds.intersect(ray.origin,
+                invDirection, tMin, closest, rightEntry);
+
+            // Push the farthest child first so the nearest one is visited next
+            if (hitLeft && hitRight) {
+                if (leftEntry < rightEntry) {
+                    stack[stackSize++] = node.right;
+                    stack[stackSize++] = node.left;
+                } else {
+                    stack[stackSize++] = node.left;
+                    stack[stackSize++] = node.right;
+                }
+            } else if (hitLeft) {
+                stack[stackSize++] = node.left;
+            } else if (hitRight) {
+                stack[stackSize++] = node.right;
+            }
+        }
+        return found;
+    }
+
+    /**
+     * @brief Slab test of a box against every lane of a packet
+     * @param box The box to test
+     * @param packet The rays
+     * @param tMin The minimum accepted distance
+     * @param tMax The maximum accepted distance of each lane
+     * @param nearestEntry Set to the smallest entry distance of the hit lanes
+     * @return Bit mask of the lanes entering the box
+     */
+    static int intersectPacket(const Math::AABB &box, const RayPacket &packet,
+        double tMin, const double *tMax, double &nearestEntry);
+
+    /**
+     * @brief Walks the nodes overlapping any ray of a packet, nearest first
+     * @param packet The rays to trace
+     * @param tMin The minimum accepted distance
+     * @param closest The maximum accepted distance of each lane, shrunk by slotHit
+     * @param slotHit Callable (slot) testing every lane against one slot
+     */
+    template <typename SlotHit>
+    void traversePacket(const RayPacket &packet, double tMin,
+    const double *closest, SlotHit &&slotHit) const {
+        if (_nodes.empty() || packet.count == 0)
+            return;
+        int stack[2 * MAX_DEPTH + 2];
+        int stackSize = 0;
+        double entry = 0.0;
+
+        if (!intersectPacket(_nodes[0].bounds, packet, tMin, closest, entry))
+            return;
+        stack[stackSize++] = 0;
+        while (stackSize > 0) {
+            const Node &node = _nodes[stack[--stackSize]];
+
+            if (node.count > 0) {
+                for (int i = node.first; i < node.first + node.count; i++)
+                    slotHit(i);
+                continue;
+            }
+            double leftEntry = 0.0;
+            double rightEntry = 0.0;
+            bool hitLeft = intersectPacket(_nodes[node.left].bounds, packet,
+                tMin, closest, leftEntry) != 0;
+            bool hitRight = intersectPacket(_nodes[node.right].bounds, packet,
+                tMin, closest, rightEntry) != 0;
+
+            if (hitLeft && hitRight) {
+                if (leftEntry < rightEntry) {
+                    stack[stackSize++] = node.right;
+                    stack[stackSize++] = node.left;
+                } else {
+                    stack[stackSize++] = node.left;
+                    stack[stackSize++] = node.right;
+                }
+            } else if (hitLeft) {
+                stack[stackSize++] = node.left;
+            } else if (hitRight) {
+                stack[stackSize++] = node.right;
+            }
+        }
+    }
+
+ private:
+    static constexpr int MAX_LEAF_SIZE = 4;
+    static constexpr int MAX_SAH_LEAF_SIZE = 8;
+    static constexpr int MAX_DEPTH = 64;
+    static constexpr int SAH_BINS = 12;
+    // Cost of visiting a node relative to intersecting one item
+    static constexpr double TRAVERSAL_COST = 1.0;
+
+    std::vector<Node> _nodes;
+    std::vector<int> _order;
+
+    int buildNode(const std::vector<Math::AABB> &bounds, int first, int count,
+        int depth);
+    int findSahSplit(const std::vector<Math::AABB> &bounds, int first,
+        int count, const Math::AABB &nodeBounds,
+        const Math::AABB &centroidBounds, int axis);
+};
+}  // namespace RayTracer
+
+#endif  // SRC_PRIMITIVE_BVH_BVHTREE_HPP_
@@ -28,52 +28,32 @@ void Box::translate(const Math::Vector3D &translation) {
 
 void Box::rotateX(double degrees) {
     rotationX += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateX("x", degrees);
     center = rotateX.applyToPoint(center);
 }
 
 void Box::rotateY(double degrees) {
     rotationY += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateY("y", degrees);
     center = rotateY.applyToPoint(center);
 }
 
 void Box::rotateZ(double degrees) {
     rotationZ += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateZ("z", degrees);
     center = rotateZ.applyToPoint(center);
 }
 
-std::shared_ptr<Material> Box::getMaterial() const {
+const std::shared_ptr<Material> &Box::getMaterial() const {
     return material;
 }
 
-std::optional<HitInfo> Box::hit(const Ray &ray,
+std::optional<double> Box::intersect(const Ray &ray,
 double tMin, double tMax) {
-    Ray transformedRay = ray;
-
-    if (rotationX != 0.0 || rotationY != 0.0 || rotationZ != 0.0) {
-        Math::Point3D newOrigin = ray.origin;
-        Math::Vector3D newDirection = ray.direction;
-
-        if (rotationZ != 0.0) {
-            RayTracer::Rotate rotateZ("z", -rotationZ);
-            newOrigin = rotateZ.applyToPoint(newOrigin);
-            newDirection = rotateZ.applyToVector(newDirection);
-        }
-        if (rotationY != 0.0) {
-            RayTracer::Rotate rotateY("y", -rotationY);
-            newOrigin = rotateY.applyToPoint(newOrigin);
-            newDirection = rotateY.applyToVector(newDirection);
-        }
-        if (rotationX != 0.0) {
-            RayTracer::Rotate rotateX("x", -rotationX);
-            newOrigin = rotateX.applyToPoint(newOrigin);
-            newDirection = rotateX.applyToVector(newDirection);
-        }
-
-        transformedRay = Ray(newOrigin, newDirection);
-    }
+    Ray transformedRay = transform.toObject(ray);
 
     Math::Point3D min_bound = center - dimensions;
     Math::Point3D max_bound = center + dimensions;
@@ -103,6 +83,18 @@ double tMin, double tMax) {
 
     if (t < tMin || t > tMax)
         return std::nullopt;
+    return t;
+}
+
+std::optional<HitInfo> Box::hit(const Ray &ray,
+double tMin, double tMax) {
+    std::optional<double> distance = intersect(ray, tMin, tMax);
+    if (!distance)
+        return std::nullopt;
+    Ray transformedRay = transform.toObject(ray);
+    Math::Point3D min_bound = center - dimensions;
+    Math::Point3D max_bound = center + dimensions;
+    double t = *distance;
 
     HitInfo info;
     info.distance = t;
@@ -132,20 +124,7 @@ double tMin, double tMax) {
         faceIndex = 5;
     }
 
-    if (rotationX != 0.0 || rotationY != 0.0 || rotationZ != 0.0) {
-        if (rotationX != 0.0) {
-            RayTracer::Rotate rotateX("x", rotationX);
-            normal = rotateX.applyToVector(normal);
-        }
-        if (rotationY != 0.0) {
-            RayTracer::Rotate rotateY("y", rotationY);
-            normal = rotateY.applyToVector(normal);
-        }
-        if (rotationZ != 0.0) {
-            RayTracer::Rotate rotateZ("z", rotationZ);
-            normal = rotateZ.applyToVector(normal);
-        }
-    }
+    normal = transform.normalToWorld(normal);
 
     double u = 0.0, v = 0.0;
     switch (faceIndex) {
@@ -179,7 +158,7 @@ double tMin, double tMax) {
     info.uv = Math::Vector2D(u, v);
     info.normal = normal.normalize();
     try {
-        info.primitive = std::static_pointer_cast<IPrimitive>(shared_from_this());
+        info.primitive = this;
     } catch (const std::exception& e) {
         std::cerr << "Error in Box::hit(): " << e.what() << std::endl;
         return std::nullopt;
@@ -187,11 +166,46 @@ double tMin, double tMax) {
     return info;
 }
 
+void Box::hitPacket(const RayPacket &packet, double tMin,
+PacketHit &hits) {
+    RayPacket rotated;
+    const RayPacket *transformed = &packet;
+    if (!transform.isIdentity()) {
+        rotated = transform.toObject(packet);
+        transformed = &rotated;
+    }
+    const RayPacket &local = *transformed;
+    Math::Point3D min_bound = center - dimensions;
+    Math::Point3D max_bound = center + dimensions;
+
+    for (int lane = 0; lane < local.count; lane++) {
+        double tx1 = (min_bound.X - local.originX[lane]) * local.inverseX[lane];
+        double tx2 = (max_bound.X - local.originX[lane]) * local.inverseX[lane];
+        double ty1 = (min_bound.Y - local.originY[lane]) * local.inverseY[lane];
+        double ty2 = (max_bound.Y - local.originY[lane]) * local.inverseY[lane];
+        double tz1 = (min_bound.Z - local.originZ[lane]) * local.inverseZ[lane];
+        double tz2 = (max_bound.Z - local.originZ[lane]) * local.inverseZ[lane];
+        double tmin = std::max(std::max(std::min(tx1, tx2),
+            std::min(ty1, ty2)), std::min(tz1, tz2));
+        double tmax = std::min(std::min(std::max(tx1, tx2),
+            std::max(ty1, ty2)), std::max(tz1, tz2));
+
+        if (tmax < 0 || tmin > tmax)
+            continue;
+        double t = (tmin > 0) ? tmin : tmax;
+        if (t < tMin || t > hits.distance[lane])
+            continue;
+        hits.distance[lane] = t;
+        hits.primitive[lane] = this;
+    }
+}
+
 std::shared_ptr<IPrimitive> Box::clone() const {
     auto copy = std::make_shared<Box>(center, dimensions, material);
     copy->rotationX = rotationX;
     copy->rotationY = rotationY;
     copy->rotationZ = rotationZ;
+    copy->transform = transform;
     copy->setSourceFile(sourceFile);
     return copy;
 }
@@ -230,4 +244,11 @@ void Box::getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) const
     mat.add("refractionIndex", libconfig::Setting::TypeFloat) = material->refractionIndex;
 }
 
+Math::AABB Box::getBoundingBox() const {
+    Math::AABB bounds;
+    bounds.expand(center - dimensions);
+    bounds.expand(center + dimensions);
+    return transform.boxToWorld(bounds);
+}
+
 }  // namespace RayTracer
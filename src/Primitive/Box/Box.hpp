@@ -8,18 +8,21 @@
 
 #ifndef SRC_PRIMITIVE_BOX_BOX_HPP_
     #define SRC_PRIMITIVE_BOX_BOX_HPP_
+    #include <algorithm>
     #include <string>
     #include <memory>
     #include "Primitive/IPrimitive.hpp"
     #include "Transformation/Rotate/Rotate.hpp"
+    #include "Transformation/ObjectTransform/ObjectTransform.hpp"
 
 namespace RayTracer {
-class Box : public IPrimitive, public std::enable_shared_from_this<Box> {
+class Box : public IPrimitive {
  private:
     std::shared_ptr<Material> material;
     double rotationX = 0.0;
     double rotationY = 0.0;
     double rotationZ = 0.0;
+    ObjectTransform transform;
     std::string sourceFile = "";
 
  public:
@@ -53,10 +56,21 @@ class Box : public IPrimitive, public std::enable_shared_from_this<Box> {
     void rotateZ(double degrees) override;
     std::optional<HitInfo> hit(const Ray &ray,
         double tMin, double tMax) override;
-    std::shared_ptr<Material> getMaterial() const override;
+    std::optional<double> intersect(const Ray &ray, double tMin,
+        double tMax) override;
+    void hitPacket(const RayPacket &packet, double tMin,
+        PacketHit &hits) override;
+    const std::shared_ptr<Material> &getMaterial() const override;
     std::shared_ptr<IPrimitive> clone() const override;
     void getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) const override;
+    // Each face maps its side to [0, 1], the shortest side is the densest
+    double getUVDensity(const HitInfo &hit) const override {
+        (void)hit;
+        double shortest = std::min({dimensions.X, dimensions.Y, dimensions.Z});
+        return shortest > 0.0 ? 1.0 / (2.0 * shortest) : 0.0;
+    }
     Math::Point3D getPosition() const override { return center; }
+    Math::AABB getBoundingBox() const override;
 };
 }  // namespace RayTracer
 
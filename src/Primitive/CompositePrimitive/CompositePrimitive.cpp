@@ -25,6 +25,8 @@ void CompositePrimitive::translate(const Math::Vector3D &translation) {
     for (auto &primitive : primitives) {
         primitive->translate(translation);
     }
+    if (bvh.isBuilt())
+        bvh.refit();
 }
 
 void CompositePrimitive::rotateX(double degrees) {
@@ -32,6 +34,8 @@ void CompositePrimitive::rotateX(double degrees) {
     for (auto &primitive : primitives) {
         primitive->rotateX(degrees);
     }
+    if (bvh.isBuilt())
+        bvh.refit();
 }
 
 void CompositePrimitive::rotateY(double degrees) {
@@ -39,6 +43,8 @@ void CompositePrimitive::rotateY(double degrees) {
     for (auto &primitive : primitives) {
         primitive->rotateY(degrees);
     }
+    if (bvh.isBuilt())
+        bvh.refit();
 }
 
 void CompositePrimitive::rotateZ(double degrees) {
@@ -46,10 +52,15 @@ void CompositePrimitive::rotateZ(double degrees) {
     for (auto &primitive : primitives) {
         primitive->rotateZ(degrees);
     }
+    if (bvh.isBuilt())
+        bvh.refit();
 }
 
 std::optional<HitInfo> CompositePrimitive::hit(const Ray &ray, double tMin,
 double tMax) {
+    if (bvh.isBuilt())
+        return bvh.hit(ray, tMin, tMax);
+
     std::optional<HitInfo> closestHit;
     double closest = tMax;
 
@@ -64,7 +75,70 @@ double tMax) {
     return closestHit;
 }
 
-std::shared_ptr<Material> CompositePrimitive::getMaterial() const {
+std::optional<double> CompositePrimitive::intersect(const Ray &ray, double tMin,
+double tMax) {
+    if (bvh.isBuilt()) {
+        auto closest = bvh.closestHit(ray, tMin, tMax);
+        if (!closest)
+            return std::nullopt;
+        return closest->distance;
+    }
+
+    std::optional<double> closest;
+    for (const auto &primitive : primitives) {
+        auto distance = primitive->intersect(ray, tMin, closest.value_or(tMax));
+        if (distance)
+            closest = distance;
+    }
+    return closest;
+}
+
+bool CompositePrimitive::occluded(const Ray &ray, double tMin, double tMax) {
+    if (bvh.isBuilt())
+        return bvh.anyHit(ray, tMin, tMax);
+    for (const auto &primitive : primitives) {
+        if (primitive->occluded(ray, tMin, tMax))
+            return true;
+    }
+    return false;
+}
+
+void CompositePrimitive::hitPacket(const RayPacket &packet, double tMin,
+PacketHit &hits) {
+    if (!bvh.isBuilt()) {
+        IPrimitive::hitPacket(packet, tMin, hits);
+        return;
+    }
+    // Children are reported as the composite, its hit() resolves the child
+    PacketHit childHits = hits;
+    bvh.hitPacket(packet, tMin, childHits);
+    for (int lane = 0; lane < packet.count; lane++) {
+        if (childHits.distance[lane] < hits.distance[lane]) {
+            hits.distance[lane] = childHits.distance[lane];
+            hits.primitive[lane] = this;
+        }
+    }
+}
+
+void CompositePrimitive::prepareView(const PrimaryView &view) {
+    for (const auto &primitive : primitives)
+        primitive->prepareView(view);
+}
+
+void CompositePrimitive::tessellateDisplacement() {
+    bool changed = false;
+
+    for (const auto &primitive : primitives) {
+        bool wasDisplaced = primitive->hasDisplacedGeometry();
+        primitive->tessellateDisplacement();
+        changed |= primitive->hasDisplacedGeometry() != wasDisplaced;
+    }
+    // Displaced children grew, their bounds are stale
+    if (changed && bvh.isBuilt())
+        finalize();
+}
+
+const std::shared_ptr<Material> &CompositePrimitive::getMaterial() const {
     return material;
 }
 
@@ -78,17 +152,21 @@ std::shared_ptr<IPrimitive> CompositePrimitive::clone() const {
     for (const auto &primitive : primitives) {
         copy->add(primitive->clone());
     }
+    if (bvh.isBuilt())
+        copy->finalize();
     return copy;
 }
 
 void CompositePrimitive::add(std::shared_ptr<IPrimitive> primitive) {
     primitives.push_back(std::move(primitive));
+    bvh.clear();
 }
 
 void CompositePrimitive::remove(std::shared_ptr<IPrimitive> primitive) {
     primitives.erase(
         std::remove(primitives.begin(), primitives.end(), primitive),
         primitives.end());
+    bvh.clear();
 }
 
 const std::vector<std::shared_ptr<IPrimitive>>&
@@ -96,6 +174,24 @@ CompositePrimitive::getPrimitives() const {
     return primitives;
 }
 
+void CompositePrimitive::finalize() {
+    bvh.build(primitives);
+}
+
+Math::AABB CompositePrimitive::getBoundingBox() const {
+    if (bvh.isBuilt()) {
+        if (bvh.hasUnboundedPrimitives())
+            return Math::AABB::infinite();
+        return bvh.getBounds();
+    }
+    Math::AABB bounds;
+
+    for (const auto &primitive : primitives) {
+        bounds.expand(primitive->getBoundingBox());
+    }
+    return bounds;
+}
+
 void CompositePrimitive::getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) const {
     if (!sourceFile.empty() && sourceFile.size() > 4 && sourceFile.substr(sourceFile.size() - 4) == ".obj")
         return;
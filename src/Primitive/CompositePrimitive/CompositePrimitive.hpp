@@ -13,11 +13,13 @@
     #include <memory>
     #include <libconfig.h++>
     #include "Primitive/IPrimitive.hpp"
+    #include "Primitive/BVH/BVH.hpp"
 
 namespace RayTracer {
-class CompositePrimitive : public IPrimitive, public std::enable_shared_from_this<CompositePrimitive> {
+class CompositePrimitive : public IPrimitive {
  private:
     std::vector<std::shared_ptr<IPrimitive>> primitives;
+    BVH bvh;
     std::shared_ptr<Material> material;
     double rotationX = 0.0;
     double rotationY = 0.0;
@@ -50,13 +52,26 @@ class CompositePrimitive : public IPrimitive, public std::enable_shared_from_thi
     void rotateZ(double degrees) override;
     std::optional<HitInfo> hit(const Ray &ray,
         double tMin, double tMax) override;
-    std::shared_ptr<Material> getMaterial() const override;
+    std::optional<double> intersect(const Ray &ray, double tMin,
+        double tMax) override;
+    bool occluded(const Ray &ray, double tMin, double tMax) override;
+    void hitPacket(const RayPacket &packet, double tMin,
+        PacketHit &hits) override;
+    void prepareView(const PrimaryView &view) override;
+    // Children report their own hits, each one displaces its geometry
+    void tessellateDisplacement() override;
+    const std::shared_ptr<Material> &getMaterial() const override;
     std::shared_ptr<IPrimitive> clone() const override;
     void getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) const override;
 
     void add(std::shared_ptr<IPrimitive> primitive);
     void remove(std::shared_ptr<IPrimitive> primitive);
     const std::vector<std::shared_ptr<IPrimitive>>& getPrimitives() const;
+    // Builds the hierarchy used by hit() once all children were added,
+    // add() and remove() drop it until the next call
+    void finalize();
+    bool isFinalized() const { return bvh.isBuilt(); }
+    Math::AABB getBoundingBox() const override;
 
     Math::Point3D getPosition() const override {
         if (primitives.empty())
@@ -30,6 +30,7 @@ void Cone::translate(const Math::Vector3D &translation) {
 
 void Cone::rotateX(double degrees) {
     rotationX += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateX("x", degrees);
     apex = rotateX.applyToPoint(apex);
     axis = rotateX.applyToVector(axis).normalize();
@@ -37,6 +38,7 @@ void Cone::rotateX(double degrees) {
 
 void Cone::rotateY(double degrees) {
     rotationY += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateY("y", degrees);
     apex = rotateY.applyToPoint(apex);
     axis = rotateY.applyToVector(axis).normalize();
@@ -44,40 +46,19 @@ void Cone::rotateY(double degrees) {
 
 void Cone::rotateZ(double degrees) {
     rotationZ += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateZ("z", degrees);
     apex = rotateZ.applyToPoint(apex);
     axis = rotateZ.applyToVector(axis).normalize();
 }
 
-std::shared_ptr<Material> Cone::getMaterial() const {
+const std::shared_ptr<Material> &Cone::getMaterial() const {
     return material;
 }
 
 std::optional<HitInfo> Cone::hit(const Ray &ray, double tMin,
 double tMax) {
-    Ray transformedRay = ray;
-    if (rotationX != 0.0 || rotationY != 0.0 || rotationZ != 0.0) {
-        Math::Point3D newOrigin = ray.origin;
-        Math::Vector3D newDirection = ray.direction;
-
-        if (rotationZ != 0.0) {
-            RayTracer::Rotate rotateZ("z", -rotationZ);
-            newOrigin = rotateZ.applyToPoint(newOrigin);
-            newDirection = rotateZ.applyToVector(newDirection);
-        }
-        if (rotationY != 0.0) {
-            RayTracer::Rotate rotateY("y", -rotationY);
-            newOrigin = rotateY.applyToPoint(newOrigin);
-            newDirection = rotateY.applyToVector(newDirection);
-        }
-        if (rotationX != 0.0) {
-            RayTracer::Rotate rotateX("x", -rotationX);
-            newOrigin = rotateX.applyToPoint(newOrigin);
-            newDirection = rotateX.applyToVector(newDirection);
-        }
-
-        transformedRay = Ray(newOrigin, newDirection);
-    }
+    Ray transformedRay = transform.toObject(ray);
 
     Math::Vector3D co = transformedRay.origin - apex;
 
@@ -133,20 +114,7 @@ double tMax) {
     if (normal.dot(transformedRay.direction) > 0)
         normal = normal * -1.0;
 
-    if (rotationX != 0.0 || rotationY != 0.0 || rotationZ != 0.0) {
-        if (rotationX != 0.0) {
-            RayTracer::Rotate rotateX("x", rotationX);
-            normal = rotateX.applyToVector(normal);
-        }
-        if (rotationY != 0.0) {
-            RayTracer::Rotate rotateY("y", rotationY);
-            normal = rotateY.applyToVector(normal);
-        }
-        if (rotationZ != 0.0) {
-            RayTracer::Rotate rotateZ("z", rotationZ);
-            normal = rotateZ.applyToVector(normal);
-        }
-    }
+    normal = transform.normalToWorld(normal);
     Math::Vector3D apexToHit = hitPoint - apex;
     double v = heightIntersect / height;
     Math::Vector3D reference;
@@ -170,7 +138,7 @@ double tMax) {
     info.hitPoint = ray.origin + ray.direction * t;
     info.normal = normal;
     try {
-        info.primitive = std::make_shared<Cone>(*this);
+        info.primitive = this;
     } catch (const std::exception& e) {
         std::cerr << "Error in Cone::hit(): " << e.what() << std::endl;
         return std::nullopt;
@@ -183,6 +151,7 @@ std::shared_ptr<IPrimitive> Cone::clone() const {
     copy->rotationX = rotationX;
     copy->rotationY = rotationY;
     copy->rotationZ = rotationZ;
+    copy->transform = transform;
     copy->setSourceFile(sourceFile);
     return copy;
 }
@@ -221,4 +190,20 @@ void Cone::getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) const
     mat.add("transparency", libconfig::Setting::TypeFloat) = material->transparency;
     mat.add("refractionIndex", libconfig::Setting::TypeFloat) = material->refractionIndex;
 }
+
+Math::AABB Cone::getBoundingBox() const {
+    Math::Vector3D diskExtent(Math::Coords{
+        radius * std::sqrt(std::max(0.0, 1.0 - axis.X * axis.X)),
+        radius * std::sqrt(std::max(0.0, 1.0 - axis.Y * axis.Y)),
+        radius * std::sqrt(std::max(0.0, 1.0 - axis.Z * axis.Z))
+    });
+    Math::Point3D base = apex + axis * height;
+    Math::AABB bounds;
+
+    bounds.expand(apex);
+    bounds.expand(base - diskExtent);
+    bounds.expand(base + diskExtent);
+    return transform.boxToWorld(bounds);
+}
+
 }  // namespace RayTracer
@@ -12,15 +12,17 @@
     #include <memory>
     #include "Primitive/IPrimitive.hpp"
     #include "Transformation/Rotate/Rotate.hpp"
+    #include "Transformation/ObjectTransform/ObjectTransform.hpp"
     #include <libconfig.h++>
 
 namespace RayTracer {
-class Cone : public IPrimitive, public std::enable_shared_from_this<Cone> {
+class Cone : public IPrimitive {
  private:
     std::shared_ptr<Material> material;
     double rotationX = 0.0;
     double rotationY = 0.0;
     double rotationZ = 0.0;
+    ObjectTransform transform;
     std::string sourceFile = "";
 
  public:
@@ -58,11 +60,12 @@ class Cone : public IPrimitive, public std::enable_shared_from_this<Cone> {
     void rotateZ(double degrees) override;
     std::optional<HitInfo> hit(const Ray &ray,
         double tMin, double tMax) override;
-    std::shared_ptr<Material> getMaterial() const override;
+    const std::shared_ptr<Material> &getMaterial() const override;
     std::shared_ptr<IPrimitive> clone() const override;
     void getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) const override;
 
     Math::Point3D getPosition() const override { return apex; }
+    Math::AABB getBoundingBox() const override;
 };
 }  // namespace RayTracer
 
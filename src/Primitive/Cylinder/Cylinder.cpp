@@ -30,6 +30,7 @@ void Cylinder::translate(const Math::Vector3D &translation) {
 
 void Cylinder::rotateX(double degrees) {
     rotationX += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateX("x", degrees);
     center = rotateX.applyToPoint(center);
     axis = rotateX.applyToVector(axis).normalize();
@@ -37,6 +38,7 @@ void Cylinder::rotateX(double degrees) {
 
 void Cylinder::rotateY(double degrees) {
     rotationY += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateY("y", degrees);
     center = rotateY.applyToPoint(center);
     axis = rotateY.applyToVector(axis).normalize();
@@ -44,40 +46,19 @@ void Cylinder::rotateY(double degrees) {
 
 void Cylinder::rotateZ(double degrees) {
     rotationZ += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateZ("z", degrees);
     center = rotateZ.applyToPoint(center);
     axis = rotateZ.applyToVector(axis).normalize();
 }
 
-std::shared_ptr<Material> Cylinder::getMaterial() const {
+const std::shared_ptr<Material> &Cylinder::getMaterial() const {
     return material;
 }
 
 std::optional<HitInfo> Cylinder::hit(const Ray &ray,
 double tMin, double tMax) {
-    Ray transformedRay = ray;
-    if (rotationX != 0.0 || rotationY != 0.0 || rotationZ != 0.0) {
-        Math::Point3D newOrigin = ray.origin;
-        Math::Vector3D newDirection = ray.direction;
-
-        if (rotationZ != 0.0) {
-            RayTracer::Rotate rotateZ("z", -rotationZ);
-            newOrigin = rotateZ.applyToPoint(newOrigin);
-            newDirection = rotateZ.applyToVector(newDirection);
-        }
-        if (rotationY != 0.0) {
-            RayTracer::Rotate rotateY("y", -rotationY);
-            newOrigin = rotateY.applyToPoint(newOrigin);
-            newDirection = rotateY.applyToVector(newDirection);
-        }
-        if (rotationX != 0.0) {
-            RayTracer::Rotate rotateX("x", -rotationX);
-            newOrigin = rotateX.applyToPoint(newOrigin);
-            newDirection = rotateX.applyToVector(newDirection);
-        }
-
-        transformedRay = Ray(newOrigin, newDirection);
-    }
+    Ray transformedRay = transform.toObject(ray);
 
     Math::Vector3D oc = transformedRay.origin - center;
 
@@ -125,20 +106,7 @@ double tMin, double tMax) {
         normal = normal * -1.0;
     }
 
-    if (rotationX != 0.0 || rotationY != 0.0 || rotationZ != 0.0) {
-        if (rotationX != 0.0) {
-            RayTracer::Rotate rotateX("x", rotationX);
-            normal = rotateX.applyToVector(normal);
-        }
-        if (rotationY != 0.0) {
-            RayTracer::Rotate rotateY("y", rotationY);
-            normal = rotateY.applyToVector(normal);
-        }
-        if (rotationZ != 0.0) {
-            RayTracer::Rotate rotateZ("z", rotationZ);
-            normal = rotateZ.applyToVector(normal);
-        }
-    }
+    normal = transform.normalToWorld(normal);
     double v = heightIntersect / height;
     Math::Vector3D reference;
     if (std::abs(axis.X) < std::abs(axis.Y) && std::abs(axis.X) < std::abs(axis.Z)) {
@@ -162,7 +130,7 @@ double tMin, double tMax) {
     info.normal = normal;
     info.uv = Math::Vector2D(u, v);
     try {
-        info.primitive = std::static_pointer_cast<IPrimitive>(shared_from_this());
+        info.primitive = this;
     } catch (const std::exception& e) {
         std::cerr << "Error in Cylinder::hit(): " << e.what() << std::endl;
         return std::nullopt;
@@ -176,6 +144,7 @@ std::shared_ptr<IPrimitive> Cylinder::clone() const {
     copy->rotationX = rotationX;
     copy->rotationY = rotationY;
     copy->rotationZ = rotationZ;
+    copy->transform = transform;
     copy->setSourceFile(sourceFile);
     return copy;
 }
@@ -214,4 +183,21 @@ void Cylinder::getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) c
     mat.add("transparency", libconfig::Setting::TypeFloat) = material->transparency;
     mat.add("refractionIndex", libconfig::Setting::TypeFloat) = material->refractionIndex;
 }
+
+Math::AABB Cylinder::getBoundingBox() const {
+    Math::Vector3D diskExtent(Math::Coords{
+        radius * std::sqrt(std::max(0.0, 1.0 - axis.X * axis.X)),
+        radius * std::sqrt(std::max(0.0, 1.0 - axis.Y * axis.Y)),
+        radius * std::sqrt(std::max(0.0, 1.0 - axis.Z * axis.Z))
+    });
+    Math::Point3D top = center + axis * height;
+    Math::AABB bounds;
+
+    bounds.expand(center - diskExtent);
+    bounds.expand(center + diskExtent);
+    bounds.expand(top - diskExtent);
+    bounds.expand(top + diskExtent);
+    return transform.boxToWorld(bounds);
+}
+
 }  // namespace RayTracer
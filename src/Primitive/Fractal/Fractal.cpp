@@ -21,6 +21,9 @@
 
 namespace RayTracer {
 
+static_assert(SdfMarcher::MAX_LANES <= IFractalType::BATCH_SIZE,
+    "a packet march evaluates all its lanes in one distanceEstimatorN call");
+
 Fractal::Fractal(const Math::Point3D &center, double boundingRadius,
                  const std::string &fractalTypeName, int maxIterations, double bailout)
     : material(std::make_shared<Material>()), center(center),
@@ -38,6 +41,8 @@ Fractal::Fractal(const Math::Point3D &center, double boundingRadius,
 }
 
 void Fractal::setFractalType(const std::string& name) {
+    prepass.invalidate();
+    distanceCache.invalidate();
     fractalType = FractalTypeFactory::getInstance().createFractalType(name);
 }
 
@@ -50,18 +55,26 @@ std::shared_ptr<IFractalType> Fractal::getFractalType() const {
 }
 
 void Fractal::setPower(double p) {
+    prepass.invalidate();
+    distanceCache.invalidate();
     power = p;
 }
 
 void Fractal::setMaxIterations(int iterations) {
+    prepass.invalidate();
+    distanceCache.invalidate();
     maxIterations = iterations;
 }
 
 void Fractal::setBailout(double b) {
+    prepass.invalidate();
+    distanceCache.invalidate();
     bailout = b;
 }
 
 void Fractal::setJuliaConstant(const Math::Point3D& c) {
+    prepass.invalidate();
+    distanceCache.invalidate();
     auto juliaFractal = std::dynamic_pointer_cast<JuliaFractal>(fractalType);
     if (juliaFractal) {
         juliaFractal->setJuliaConstant(c);
@@ -69,6 +82,8 @@ void Fractal::setJuliaConstant(const Math::Point3D& c) {
 }
 
 void Fractal::setQuaternionConstant(double cx, double cy, double cz, double cw) {
+    prepass.invalidate();
+    distanceCache.invalidate();
     auto quaternionFractal = std::dynamic_pointer_cast<QuaternionJuliaFractal>(fractalType);
     if (quaternionFractal) {
         quaternionFractal->setConstant(cx, cy, cz, cw);
@@ -76,6 +91,8 @@ void Fractal::setQuaternionConstant(double cx, double cy, double cz, double cw)
 }
 
 void Fractal::setMengerScale(double scale) {
+    prepass.invalidate();
+    distanceCache.invalidate();
     auto mengerFractal = std::dynamic_pointer_cast<MengerSpongeFractal>(fractalType);
     if (mengerFractal) {
         mengerFractal->setScale(scale);
@@ -83,6 +100,8 @@ void Fractal::setMengerScale(double scale) {
 }
 
 void Fractal::setSierpinskiParameters(double scale, bool useTetrahedron) {
+    prepass.invalidate();
+    distanceCache.invalidate();
     auto sierpinskiFractal = std::dynamic_pointer_cast<SierpinskiTetrahedronFractal>(fractalType);
     if (sierpinskiFractal) {
         sierpinskiFractal->setScale(scale);
@@ -90,6 +109,8 @@ void Fractal::setSierpinskiParameters(double scale, bool useTetrahedron) {
 }
 
 void Fractal::setMandelboxParameters(double scale, double minRadius, double foldingLimit) {
+    prepass.invalidate();
+    distanceCache.invalidate();
     auto mandelboxFractal = std::dynamic_pointer_cast<MandelboxFractal>(fractalType);
     if (mandelboxFractal) {
         mandelboxFractal->setScale(scale);
@@ -98,149 +119,242 @@ void Fractal::setMandelboxParameters(double scale, double minRadius, double fold
     }
 }
 
+void Fractal::setDistanceCache(bool enabled) {
+    useDistanceCache = enabled;
+    distanceCache.invalidate();
+}
+
+bool Fractal::hasDistanceCache() const {
+    return useDistanceCache;
+}
+
 void Fractal::translate(const Math::Vector3D &translation) {
+    prepass.invalidate();
     center += translation;
 }
 
 void Fractal::rotateX(double degrees) {
+    prepass.invalidate();
     rotationX += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateX("x", degrees);
     center = rotateX.applyToPoint(center);
 }
 
 void Fractal::rotateY(double degrees) {
+    prepass.invalidate();
     rotationY += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateY("y", degrees);
     center = rotateY.applyToPoint(center);
 }
 
 void Fractal::rotateZ(double degrees) {
+    prepass.invalidate();
     rotationZ += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateZ("z", degrees);
     center = rotateZ.applyToPoint(center);
 }
 
-std::optional<HitInfo> Fractal::hit(const Ray &ray, double tMin, double tMax) {
-    Ray transformedRay = ray;
-    if (rotationX != 0.0 || rotationY != 0.0 || rotationZ != 0.0) {
-        Math::Point3D newOrigin = ray.origin;
-        Math::Vector3D newDirection = ray.direction;
-
-        if (rotationZ != 0.0) {
-            RayTracer::Rotate rotateZ("z", -rotationZ);
-            newOrigin = rotateZ.applyToPoint(newOrigin);
-            newDirection = rotateZ.applyToVector(newDirection);
-        }
-        if (rotationY != 0.0) {
-            RayTracer::Rotate rotateY("y", -rotationY);
-            newOrigin = rotateY.applyToPoint(newOrigin);
-            newDirection = rotateY.applyToVector(newDirection);
-        }
-        if (rotationX != 0.0) {
-            RayTracer::Rotate rotateX("x", -rotationX);
-            newOrigin = rotateX.applyToPoint(newOrigin);
-            newDirection = rotateX.applyToVector(newDirection);
-        }
-
-        transformedRay = Ray(newOrigin, newDirection);
-    }
-
-    Math::Vector3D oc = transformedRay.origin - center;
-    double a = transformedRay.direction.dot(transformedRay.direction);
-    double b = 2.0 * oc.dot(transformedRay.direction);
+bool Fractal::clipToBounds(const Ray &ray, double &tMin, double &tMax) const {
+    Math::Vector3D oc = ray.origin - center;
+    double a = ray.direction.dot(ray.direction);
+    double b = 2.0 * oc.dot(ray.direction);
     double c = oc.dot(oc) - boundingRadius * boundingRadius;
     double discriminant = b * b - 4 * a * c;
 
     if (discriminant < 0)
-        return std::nullopt;
+        return false;
     double sqrtd = std::sqrt(discriminant);
     double t1 = (-b - sqrtd) / (2 * a);
     double t2 = (-b + sqrtd) / (2 * a);
-    double entryT = (t1 > tMin) ? t1 : tMin;
-    double exitT = (t2 < tMax) ? t2 : tMax;
-    if (entryT > exitT)
+    tMin = std::max(tMin, t1);
+    tMax = std::min(tMax, t2);
+    return tMin <= tMax;
+}
+
+SdfMarcher Fractal::createMarcher() const {
+    SdfMarchSettings settings;
+    settings.maxSteps = 500;
+    settings.epsilon = 0.0001 * boundingRadius;
+    settings.lipschitz = fractalType->getLipschitzBound();
+    settings.minStep = 0.00001;
+    return SdfMarcher(settings);
+}
+
+std::optional<HitInfo> Fractal::hit(const Ray &ray, double tMin, double tMax) {
+    Ray transformedRay = transform.toObject(ray);
+
+    // Primary rays skip the empty space the prepass cone of their tile crossed
+    double entryT = std::max(tMin, prepass.getStartDistance(ray));
+    double exitT = tMax;
+    if (!clipToBounds(transformedRay, entryT, exitT))
         return std::nullopt;
     return rayMarch(transformedRay, entryT, exitT);
 }
 
+std::optional<double> Fractal::intersect(const Ray &ray, double tMin, double tMax) {
+    Ray transformedRay = transform.toObject(ray);
+    double entryT = std::max(tMin, prepass.getStartDistance(ray));
+    double exitT = tMax;
+
+    if (!clipToBounds(transformedRay, entryT, exitT))
+        return std::nullopt;
+    auto march = createMarcher().march(transformedRay, entryT, exitT,
+        [this](const Math::Point3D &point) { return distance(point); });
+    if (!march)
+        return std::nullopt;
+    return march->t;
+}
+
+std::optional<HitInfo> Fractal::surfaceAt(const Ray &ray, double tMin, double distance) {
+    if (distance < tMin)
+        return std::nullopt;
+    return hitAt(transform.toObject(ray), distance);
+}
+
+void Fractal::hitPacket(const RayPacket &packet, double tMin, PacketHit &hits) {
+    Ray rays[RayPacket::SIZE];
+    double entryT[RayPacket::SIZE];
+    double exitT[RayPacket::SIZE];
+    int laneOf[RayPacket::SIZE];
+    int count = 0;
+
+    for (int lane = 0; lane < packet.count; lane++) {
+        Ray ray = packet.getRay(lane);
+        // Same object ray and range as hit() so both march the same steps
+        rays[count] = transform.toObject(ray);
+        entryT[count] = std::max(tMin, prepass.getStartDistance(ray));
+        exitT[count] = hits.distance[lane];
+        if (clipToBounds(rays[count], entryT[count], exitT[count]))
+            laneOf[count++] = lane;
+    }
+    if (count == 0)
+        return;
+    std::optional<SdfMarchHit> marches[RayPacket::SIZE];
+    createMarcher().marchN(rays, entryT, exitT, count,
+        [this](const Math::Point3D *points, int n, double *distances) {
+            distanceN(points, n, distances);
+        }, marches);
+    for (int i = 0; i < count; i++) {
+        if (!marches[i])
+            continue;
+        int lane = laneOf[i];
+        hits.distance[lane] = marches[i]->t;
+        hits.primitive[lane] = this;
+    }
+}
+
+void Fractal::prepareView(const PrimaryView &view) {
+    // Within a few hit distances of the surface the marcher needs the exact estimate
+    double lipschitz = fractalType->getLipschitzBound();
+    double margin = 4.0 * createMarcher().getSettings().epsilon * lipschitz;
+    if (!useDistanceCache || !fractalType->supportsDistanceCache())
+        distanceCache.invalidate();
+    else if (!distanceCache.isConfiguredFor(boundingRadius, margin, lipschitz))
+        distanceCache.configure(boundingRadius, margin, lipschitz);
+    if (!fractalType->supportsConeMarching()) {
+        prepass.invalidate();
+        return;
+    }
+    if (prepass.isBuiltFor(view))
+        return;
+    SdfMarcher marcher = createMarcher();
+    prepass.build(view, [this, &marcher](const Ray &ray, double slope) {
+        Ray objectRay = transform.toObject(ray);
+        double entryT = 0.0;
+        double exitT = std::numeric_limits<double>::max();
+        if (!clipToBounds(objectRay, entryT, exitT))
+            return 0.0;
+        return marcher.coneMarch(objectRay, entryT, exitT, slope,
+            [this](const Math::Point3D &point) { return distance(point); });
+    });
+}
+
 std::optional<HitInfo> Fractal::rayMarch(const Ray& ray, double tMin, double tMax) {
-    const double PRECISION = 0.00001;
-    const int MAX_STEPS = 500;
-    const double EPSILON = 0.0001 * boundingRadius;
-    double t = tMin;
-    double lastDistance = std::numeric_limits<double>::max();
-    int stepsSinceReduction = 0;
-    for (int i = 0; i < MAX_STEPS && t < tMax; i++) {
-        Math::Point3D point = ray.origin + ray.direction * t;
-        double distance = fractalType->distanceEstimator(point, center, maxIterations, bailout, power);
-        distance = std::max(distance, 1e-12);
-        double stepFactor = 0.5;
-        if (distance < EPSILON * 10.0) {
-            stepFactor = 0.1;
-            stepsSinceReduction = 0;
-        }
-        if (distance < EPSILON) {
-            HitInfo info;
-            info.distance = t;
-            info.hitPoint = ray.origin + ray.direction * t;
-            info.normal = estimateNormal(info.hitPoint);
-            info.normal = info.normal.normalize();
-            info.primitive = std::static_pointer_cast<IPrimitive>(shared_from_this());
-            if (rotationX != 0.0 || rotationY != 0.0 || rotationZ != 0.0) {
-                if (rotationX != 0.0) {
-                    RayTracer::Rotate rotateX("x", rotationX);
-                    info.normal = rotateX.applyToVector(info.normal);
-                }
-                if (rotationY != 0.0) {
-                    RayTracer::Rotate rotateY("y", rotationY);
-                    info.normal = rotateY.applyToVector(info.normal);
-                }
-                if (rotationZ != 0.0) {
-                    RayTracer::Rotate rotateZ("z", rotationZ);
-                    info.normal = rotateZ.applyToVector(info.normal);
-                }
-                info.normal = info.normal.normalize();
-            }
-            return info;
-        }
-        if (distance < lastDistance) {
-            stepsSinceReduction++;
-            if (stepsSinceReduction > 5) {
-                stepFactor = std::min(0.7, stepFactor * 1.1);
-            }
-        } else {
-            stepFactor *= 0.5;
-            stepsSinceReduction = 0;
-        }
-        lastDistance = distance;
-        double step = distance * stepFactor;
-        if (step < PRECISION) {
-            step = PRECISION;
-        }
-        t += step;
+    auto march = createMarcher().march(ray, tMin, tMax,
+        [this](const Math::Point3D &point) { return distance(point); });
+    if (!march)
+        return std::nullopt;
+    return hitAt(ray, march->t);
+}
+
+HitInfo Fractal::hitAt(const Ray& ray, double t) {
+    HitInfo info;
+    info.distance = t;
+    info.hitPoint = ray.origin + ray.direction * t;
+    info.normal = estimateNormal(info.hitPoint);
+    info.normal = info.normal.normalize();
+    info.primitive = this;
+    if (!transform.isIdentity())
+        info.normal = transform.normalToWorld(info.normal).normalize();
+    return info;
+}
+
+void Fractal::sampleFromCenter(const Math::Point3D *offsets, int count, double *distances) const {
+    fractalType->distanceEstimatorN(offsets, count, distances, Math::Point3D(Math::Coords{0, 0, 0}),
+        maxIterations, bailout, power);
+}
+
+double Fractal::distance(const Math::Point3D &point) {
+    Math::Point3D offset(Math::Coords{point.X - center.X, point.Y - center.Y, point.Z - center.Z});
+    double bound;
+    if (distanceCache.lookup(offset, [this](const Math::Point3D *offsets, int count,
+        double *distances) { sampleFromCenter(offsets, count, distances); }, bound))
+        return bound;
+    return fractalType->distanceEstimator(point, center, maxIterations, bailout, power);
+}
+
+void Fractal::distanceN(const Math::Point3D *points, int count, double *distances) {
+    Math::Point3D exact[SdfMarcher::MAX_LANES];
+    int exactLane[SdfMarcher::MAX_LANES];
+    double exactDistances[SdfMarcher::MAX_LANES];
+    int exactCount = 0;
+
+    for (int i = 0; i < count; i++) {
+        Math::Point3D offset(Math::Coords{points[i].X - center.X, points[i].Y - center.Y,
+            points[i].Z - center.Z});
+        if (distanceCache.lookup(offset, [this](const Math::Point3D *offsets, int n,
+            double *sampled) { sampleFromCenter(offsets, n, sampled); }, distances[i]))
+            continue;
+        exact[exactCount] = points[i];
+        exactLane[exactCount++] = i;
     }
-    return std::nullopt;
+    if (exactCount == 0)
+        return;
+    fractalType->distanceEstimatorN(exact, exactCount, exactDistances, center,
+        maxIterations, bailout, power);
+    for (int i = 0; i < exactCount; i++)
+        distances[exactLane[i]] = exactDistances[i];
 }
 
 Math::Vector3D Fractal::estimateNormal(const Math::Point3D& p) const {
+    double distance;
+    Math::Vector3D grad;
+    if (fractalType->distanceWithGradient(p, center, maxIterations, bailout, power, distance, grad)
+        && grad.length() >= 1e-8)
+        return grad.normalize();
+
+    // Tetrahedral differences: four taps at alternate cube corners sum to the
+    // gradient, where central differences need six
     const double EPSILON = 0.00005 * boundingRadius;
-    const Math::Vector3D dx(Math::Coords{EPSILON, 0, 0});
-    const Math::Vector3D dy(Math::Coords{0, EPSILON, 0});
-    const Math::Vector3D dz(Math::Coords{0, 0, EPSILON});
-    double gx = fractalType->distanceEstimator(p + dx, center, maxIterations, bailout, power) -
-                fractalType->distanceEstimator(p - dx, center, maxIterations, bailout, power);
-    double gy = fractalType->distanceEstimator(p + dy, center, maxIterations, bailout, power) -
-                fractalType->distanceEstimator(p - dy, center, maxIterations, bailout, power);
-    double gz = fractalType->distanceEstimator(p + dz, center, maxIterations, bailout, power) -
-                fractalType->distanceEstimator(p - dz, center, maxIterations, bailout, power);
-    Math::Vector3D grad(Math::Coords{gx, gy, gz});
+    const Math::Vector3D taps[4] = {
+        Math::Vector3D(Math::Coords{1, -1, -1}), Math::Vector3D(Math::Coords{-1, -1, 1}),
+        Math::Vector3D(Math::Coords{-1, 1, -1}), Math::Vector3D(Math::Coords{1, 1, 1})};
+    Math::Point3D samples[4];
+    double d[4];
+    for (int i = 0; i < 4; i++)
+        samples[i] = p + taps[i] * EPSILON;
+    fractalType->distanceEstimatorN(samples, 4, d, center, maxIterations, bailout, power);
+    grad = taps[0] * d[0] + taps[1] * d[1] + taps[2] * d[2] + taps[3] * d[3];
     if (grad.length() < 1e-8) {
         return (center - p).normalize();
     }
     return grad.normalize();
 }
 
-std::shared_ptr<Material> Fractal::getMaterial() const {
+const std::shared_ptr<Material> &Fractal::getMaterial() const {
     return material;
 }
 
@@ -250,7 +364,9 @@ std::shared_ptr<IPrimitive> Fractal::clone() const {
     copy->rotationX = rotationX;
     copy->rotationY = rotationY;
     copy->rotationZ = rotationZ;
+    copy->transform = transform;
     copy->power = power;
+    copy->useDistanceCache = useDistanceCache;
     copy->fractalType = fractalType->clone();
     copy->setSourceFile(sourceFile);
     return copy;
@@ -265,6 +381,8 @@ void Fractal::getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) co
     (*setting).add("maxIterations", libconfig::Setting::TypeInt) = maxIterations;
     (*setting).add("bailout", libconfig::Setting::TypeFloat) = bailout;
     (*setting).add("power", libconfig::Setting::TypeFloat) = power;
+    if (useDistanceCache)
+        (*setting).add("distanceCache", libconfig::Setting::TypeInt) = 1;
 
     if (auto juliaFractal = std::dynamic_pointer_cast<JuliaFractal>(fractalType)) {
         Math::Point3D c = juliaFractal->getJuliaConstant();
@@ -288,4 +406,8 @@ void Fractal::getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) co
     }
 }
 
+Math::AABB Fractal::getBoundingBox() const {
+    return transform.boxToWorld(Math::AABB(center, center)).inflated(boundingRadius);
+}
+
 }  // namespace RayTracer
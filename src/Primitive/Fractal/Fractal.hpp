@@ -13,24 +13,42 @@
     #include <complex>
     #include "Primitive/IPrimitive.hpp"
     #include "Transformation/Rotate/Rotate.hpp"
+    #include "Transformation/ObjectTransform/ObjectTransform.hpp"
     #include "Primitive/Fractal/FractalType/IFractalType.hpp"
     #include "Primitive/Fractal/FractalType/FractalTypeFactory.hpp"
+    #include "Primitive/SdfMarcher/SdfMarcher.hpp"
+    #include "Primitive/SdfMarcher/ConeMarchPrepass.hpp"
+    #include "Primitive/SdfMarcher/DistanceCache.hpp"
     #include <libconfig.h++>
 
 namespace RayTracer {
-class Fractal : public IPrimitive, public std::enable_shared_from_this<Fractal> {
+class Fractal : public IPrimitive {
  private:
     std::shared_ptr<Material> material;
     double rotationX = 0.0;
     double rotationY = 0.0;
     double rotationZ = 0.0;
+    ObjectTransform transform;
     int maxIterations;
     double bailout;
     double power;
     std::shared_ptr<IFractalType> fractalType;
     std::string sourceFile = "";
+    ConeMarchPrepass prepass;
+    bool useDistanceCache = false;
+    // Sampled around center, so moving the fractal keeps it valid
+    DistanceCache distanceCache;
+    SdfMarcher createMarcher() const;
+    // Where ray enters and leaves the bounding sphere within [tMin, tMax]
+    bool clipToBounds(const Ray &ray, double &tMin, double &tMax) const;
     std::optional<HitInfo> rayMarch(const Ray& ray, double tMin, double tMax);
+    HitInfo hitAt(const Ray& ray, double t);
     Math::Vector3D estimateNormal(const Math::Point3D& p) const;
+    // Estimate at points given relative to center, fills the distance cache
+    void sampleFromCenter(const Math::Point3D *offsets, int count, double *distances) const;
+    // Cached estimate away from the surface, exact estimate near it
+    double distance(const Math::Point3D &point);
+    void distanceN(const Math::Point3D *points, int count, double *distances);
 
  public:
     Math::Point3D center;
@@ -70,16 +88,30 @@ class Fractal : public IPrimitive, public std::enable_shared_from_this<Fractal>
     void setMengerScale(double scale);
     void setSierpinskiParameters(double scale, bool useTetrahedron);
     void setMandelboxParameters(double scale, double minRadius, double foldingLimit);
+    /**
+     * @brief Steps through empty space on cached distance samples
+     * Worth it for fractals rendered over many frames, the cache is filled
+     * while rendering and kept until a parameter changes
+     */
+    void setDistanceCache(bool enabled);
+    bool hasDistanceCache() const;
     void translate(const Math::Vector3D &translation) override;
     void rotateX(double degrees) override;
     void rotateY(double degrees) override;
     void rotateZ(double degrees) override;
     std::optional<HitInfo> hit(const Ray &ray, double tMin, double tMax) override;
-    std::shared_ptr<Material> getMaterial() const override;
+    std::optional<double> intersect(const Ray &ray, double tMin, double tMax) override;
+    // Normal at a distance the march already found, without marching again
+    std::optional<HitInfo> surfaceAt(const Ray &ray, double tMin, double distance) override;
+    void hitPacket(const RayPacket &packet, double tMin,
+        PacketHit &hits) override;
+    void prepareView(const PrimaryView &view) override;
+    const std::shared_ptr<Material> &getMaterial() const override;
     std::shared_ptr<IPrimitive> clone() const override;
     void getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) const override;
 
     Math::Point3D getPosition() const override { return center; }
+    Math::AABB getBoundingBox() const override;
 };
 }  // namespace RayTracer
 
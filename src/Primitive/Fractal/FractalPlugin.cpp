@@ -164,6 +164,11 @@ class FractalPlugin : public IPrimitivePlugin {
                       << ", minRadius=" << minRadius
                       << ", foldingLimit=" << foldingLimit << std::endl;
         }
+        if (params.find("distanceCache") != params.end()) {
+            fractal->setDistanceCache(params.at("distanceCache") > 0.5);
+            std::cout << "Setting distance cache: "
+                      << (fractal->hasDistanceCache() ? "on" : "off") << std::endl;
+        }
         std::cout << "Fractal creation complete." << std::endl;
         return fractal;
     }
@@ -8,14 +8,43 @@
 
 #ifndef SRC_PRIMITIVE_FRACTAL_FRACTALTYPE_IFRACTALTYPE_HPP_
     #define SRC_PRIMITIVE_FRACTAL_FRACTALTYPE_IFRACTALTYPE_HPP_
+    #include <algorithm>
     #include <string>
     #include <memory>
     #include "Math/Point3D/Point3D.hpp"
+    #include "Math/Vector3D/Vector3D.hpp"
 
 namespace RayTracer {
 
+/**
+ * @brief Points relative to the fractal center, one array per coordinate
+ * Missing lanes repeat the last point so kernels always run Width lanes,
+ * a fixed trip count the compiler turns into SIMD instructions; kernels
+ * working a lane at a time stop at count instead
+ */
+template <int Width>
+struct FractalLanes {
+    double x[Width];
+    double y[Width];
+    double z[Width];
+    int count;
+
+    FractalLanes(const Math::Point3D *points, int count, const Math::Point3D &center)
+        : count(count) {
+        for (int lane = 0; lane < Width; lane++) {
+            const Math::Point3D &point = points[std::min(lane, count - 1)];
+            x[lane] = point.X - center.X;
+            y[lane] = point.Y - center.Y;
+            z[lane] = point.Z - center.Z;
+        }
+    }
+};
+
 class IFractalType {
  public:
+    // Most points distanceEstimatorN takes at once
+    static constexpr int BATCH_SIZE = 8;
+
     virtual ~IFractalType() = default;
     virtual std::string getName() const = 0;
     virtual double distanceEstimator(const Math::Point3D& point,
@@ -23,7 +52,72 @@ class IFractalType {
                                     int maxIterations,
                                     double bailout,
                                     double power) const = 0;
+    /**
+     * @brief distanceEstimator of count points at once, count <= BATCH_SIZE
+     * Types override it with a kernel running every point per instruction,
+     * the default evaluates them one by one
+     */
+    virtual void distanceEstimatorN(const Math::Point3D *points, int count,
+                                    double *distances,
+                                    const Math::Point3D& center,
+                                    int maxIterations,
+                                    double bailout,
+                                    double power) const {
+        for (int i = 0; i < count; i++)
+            distances[i] = distanceEstimator(points[i], center, maxIterations, bailout, power);
+    }
+    /**
+     * @brief distanceEstimator and its gradient at point in a single pass
+     * Types whose iteration has a tractable Jacobian override it so normals
+     * cost one evaluation instead of finite differences
+     * @return false when no analytic gradient is available there, e.g. where
+     * the estimate is clamped; the caller then falls back to differences
+     */
+    virtual bool distanceWithGradient(const Math::Point3D& point,
+                                      const Math::Point3D& center,
+                                      int maxIterations,
+                                      double bailout,
+                                      double power,
+                                      double &distance,
+                                      Math::Vector3D &gradient) const {
+        (void)point;
+        (void)center;
+        (void)maxIterations;
+        (void)bailout;
+        (void)power;
+        (void)distance;
+        (void)gradient;
+        return false;
+    }
+    // Bound on how fast distanceEstimator changes, the marcher divides by it
+    virtual double getLipschitzBound() const { return 1.0; }
+    // Whether a cone around a ray can trust the estimate, i.e. it never jumps
+    virtual bool supportsConeMarching() const { return true; }
+    // Whether the estimate inside a small cell stays above its corner samples
+    virtual bool supportsDistanceCache() const { return supportsConeMarching(); }
     virtual std::shared_ptr<IFractalType> clone() const = 0;
+
+ protected:
+    /**
+     * @brief Runs kernel on the narrowest lane width holding count points
+     * A march ends with few rays left, they should not pay for a full batch
+     * @param kernel Callable taking (const FractalLanes<Width>&, double *distances)
+     */
+    template <typename Kernel>
+    static void runLanes(const Math::Point3D *points, int count, double *distances,
+        const Math::Point3D &center, Kernel &&kernel) {
+        if (count <= 1) {
+            kernel(FractalLanes<1>(points, count, center), distances);
+        } else if (count <= BATCH_SIZE / 2) {
+            double lanes[BATCH_SIZE / 2];
+            kernel(FractalLanes<BATCH_SIZE / 2>(points, count, center), lanes);
+            std::copy(lanes, lanes + count, distances);
+        } else {
+            double lanes[BATCH_SIZE];
+            kernel(FractalLanes<BATCH_SIZE>(points, count, center), lanes);
+            std::copy(lanes, lanes + count, distances);
+        }
+    }
 };
 
 }  // namespace RayTracer
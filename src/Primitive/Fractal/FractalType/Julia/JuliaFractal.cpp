@@ -15,42 +15,99 @@
 namespace RayTracer {
 
 double JuliaFractal::distanceEstimator(const Math::Point3D& point,
+                                       const Math::Point3D& center,
+                                       int maxIterations,
+                                       double bailout,
+                                       double power) const {
+    double distance;
+    estimate(FractalLanes<1>(&point, 1, center), maxIterations, bailout, power, &distance);
+    return distance;
+}
+
+void JuliaFractal::distanceEstimatorN(const Math::Point3D *points, int count,
+                                      double *distances,
                                       const Math::Point3D& center,
                                       int maxIterations,
                                       double bailout,
                                       double power) const {
-    Math::Vector3D position = point - center;
-    std::complex<double> z(position.X * xScale, position.Y * yScale);
-    std::complex<double> c(juliaConstant.X, juliaConstant.Y);
-    double heightField = position.Z;
-    std::complex<double> dz(1.0, 0.0);
+    runLanes(points, count, distances, center, [&](const auto &lanes, double *out) {
+        estimate(lanes, maxIterations, bailout, power, out);
+    });
+}
+
+template <int Width>
+void JuliaFractal::estimate(const FractalLanes<Width> &lanes, int maxIterations,
+    double bailout, double power, double *distances) const {
+    double cX[Width], cY[Width];
+    double zX[Width], zY[Width];
+    double dzX[Width], dzY[Width];
+    // Iteration a lane escaped at, maxIterations while it might be in the set
+    int escape[Width];
     double fractalPower = (power > 0.0) ? power : 2.0;
-    static int debugCount = 0;
-    bool mightBeInSet = true;
-    int i;
-    for (i = 0; i < maxIterations; i++) {
-        dz = fractalPower * std::pow(z, fractalPower - 1.0) * dz;
-        z = std::pow(z, fractalPower) + c;
-        if (std::abs(z) > bailout) {
-            mightBeInSet = false;
-            break;
-        }
+
+    for (int lane = 0; lane < Width; lane++) {
+        cX[lane] = juliaConstant.X;
+        cY[lane] = juliaConstant.Y;
+        zX[lane] = lanes.x[lane] * xScale;
+        zY[lane] = lanes.y[lane] * yScale;
+        dzX[lane] = 1.0;
+        dzY[lane] = 0.0;
+        escape[lane] = maxIterations;
     }
-    double distance;
-    if (mightBeInSet) {
-        double zFactor = std::abs(heightField) / zScale;
-        distance = 0.0001;
+    if (fractalPower == 2.0) {
+        // z^2 + c in plain products and |z| compared squared: without complex
+        // pow and sqrt calls the lane loop has no branch and vectorizes
+        double bailout2 = bailout * bailout;
+        for (int i = 0; i < maxIterations; i++) {
+            int running = 0;
+            for (int lane = 0; lane < Width; lane++) {
+                bool active = escape[lane] == maxIterations;
+                double newDzX = 2.0 * (zX[lane] * dzX[lane] - zY[lane] * dzY[lane]);
+                double newDzY = 2.0 * (zX[lane] * dzY[lane] + zY[lane] * dzX[lane]);
+                double newZX = zX[lane] * zX[lane] - zY[lane] * zY[lane] + cX[lane];
+                double newZY = 2.0 * zX[lane] * zY[lane] + cY[lane];
+                dzX[lane] = active ? newDzX : dzX[lane];
+                dzY[lane] = active ? newDzY : dzY[lane];
+                zX[lane] = active ? newZX : zX[lane];
+                zY[lane] = active ? newZY : zY[lane];
+                bool escaped = active && newZX * newZX + newZY * newZY > bailout2;
+                escape[lane] = escaped ? i : escape[lane];
+                running += (active && !escaped) ? 1 : 0;
+            }
+            if (running == 0)
+                break;
+        }
     } else {
-        double r = std::abs(z);
-        double dr = std::abs(dz);
-        if (dr < 1e-10) dr = 1e-10;
-        distance = 0.5 * std::log(r) * r / dr;
-        double smoothFactor = static_cast<double>(i) / maxIterations;
-        distance *= (0.2 + 0.8 * smoothFactor);
+        for (int lane = 0; lane < lanes.count; lane++) {
+            std::complex<double> c(cX[lane], cY[lane]);
+            std::complex<double> z(zX[lane], zY[lane]);
+            std::complex<double> dz(1.0, 0.0);
+            for (int i = 0; i < maxIterations; i++) {
+                dz = fractalPower * std::pow(z, fractalPower - 1.0) * dz;
+                z = std::pow(z, fractalPower) + c;
+                if (std::abs(z) > bailout) {
+                    escape[lane] = i;
+                    break;
+                }
+            }
+            zX[lane] = z.real();
+            zY[lane] = z.imag();
+            dzX[lane] = dz.real();
+            dzY[lane] = dz.imag();
+        }
+    }
+    for (int lane = 0; lane < Width; lane++) {
+        double distance = 0.0001;
+        if (escape[lane] < maxIterations) {
+            double r = std::sqrt(zX[lane] * zX[lane] + zY[lane] * zY[lane]);
+            double dr = std::max(1e-10, std::sqrt(dzX[lane] * dzX[lane] + dzY[lane] * dzY[lane]));
+            double smoothFactor = static_cast<double>(escape[lane]) / maxIterations;
+            distance = 0.5 * std::log(r) * r / dr * (0.2 + 0.8 * smoothFactor);
+        }
+        distance *= 0.02;
+        double heightDistance = std::abs(lanes.z[lane]) / zScale;
+        distances[lane] = std::max(0.00001, std::min(distance, heightDistance));
     }
-    distance *= 0.02;
-    double heightDistance = std::abs(heightField) / zScale;
-    return std::max(0.00001, std::min(distance, heightDistance));
 }
 
 }  // namespace RayTracer
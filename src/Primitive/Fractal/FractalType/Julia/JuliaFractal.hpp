@@ -21,6 +21,9 @@ class JuliaFractal : public IFractalType {
     double xScale;
     double yScale;
     double zScale;
+    template <int Width>
+    void estimate(const FractalLanes<Width> &lanes, int maxIterations,
+        double bailout, double power, double *distances) const;
 
  public:
     JuliaFractal(const Math::Point3D &constant = Math::Point3D(Math::Coords{-0.8, 0.156, 0}),
@@ -49,6 +52,12 @@ class JuliaFractal : public IFractalType {
                             int maxIterations,
                             double bailout,
                             double power) const override;
+    void distanceEstimatorN(const Math::Point3D *points, int count,
+                            double *distances,
+                            const Math::Point3D& center,
+                            int maxIterations,
+                            double bailout,
+                            double power) const override;
     std::shared_ptr<IFractalType> clone() const override {
         return std::make_shared<JuliaFractal>(*this);
     }
@@ -10,53 +10,147 @@
 #include <algorithm>
 #include "Primitive/Fractal/FractalType/Mandelbox/MandelboxFractal.hpp"
 #include "Math/Vector3D/Vector3D.hpp"
+#include "Math/Matrix3x3/Matrix3x3.hpp"
 
 namespace RayTracer {
-Math::Vector3D boxFold(const Math::Vector3D& p, double foldingLimit) {
-    Math::Vector3D result = p;
-    if (result.X > foldingLimit) result.X = 2.0 * foldingLimit - result.X;
-    else if (result.X < -foldingLimit) result.X = -2.0 * foldingLimit - result.X;
-    if (result.Y > foldingLimit) result.Y = 2.0 * foldingLimit - result.Y;
-    else if (result.Y < -foldingLimit) result.Y = -2.0 * foldingLimit - result.Y;
-    if (result.Z > foldingLimit) result.Z = 2.0 * foldingLimit - result.Z;
-    else if (result.Z < -foldingLimit) result.Z = -2.0 * foldingLimit - result.Z;
-    return result;
-}
 
-Math::Vector3D sphereFold(const Math::Vector3D& p, double minRadius2, double fixedRadius2) {
-    double r2 = p.dot(p);
-    Math::Vector3D result = p;
-    if (r2 < minRadius2) {
-        double temp = fixedRadius2 / minRadius2;
-        result = result * temp;
-    } else if (r2 < fixedRadius2) {
-        double temp = fixedRadius2 / r2;
-        result = result * temp;
-    }
-    return result;
+namespace {
+
+double foldAxis(double value, double foldingLimit) {
+    if (value > foldingLimit)
+        return 2.0 * foldingLimit - value;
+    if (value < -foldingLimit)
+        return -2.0 * foldingLimit - value;
+    return value;
 }
 
+}  // namespace
+
 double MandelboxFractal::distanceEstimator(const Math::Point3D& point,
-                                         const Math::Point3D& center,
-                                         int maxIterations,
-                                         double bailout,
-                                         double) const {
-    Math::Vector3D z = point - center;
+                                           const Math::Point3D& center,
+                                           int maxIterations,
+                                           double bailout,
+                                           double power) const {
+    double distance;
+    estimate(FractalLanes<1>(&point, 1, center), maxIterations, bailout, power, &distance);
+    return distance;
+}
+
+void MandelboxFractal::distanceEstimatorN(const Math::Point3D *points, int count,
+                                          double *distances,
+                                          const Math::Point3D& center,
+                                          int maxIterations,
+                                          double bailout,
+                                          double power) const {
+    runLanes(points, count, distances, center, [&](const auto &lanes, double *out) {
+        estimate(lanes, maxIterations, bailout, power, out);
+    });
+}
+
+bool MandelboxFractal::distanceWithGradient(const Math::Point3D& point,
+                                            const Math::Point3D& center,
+                                            int maxIterations,
+                                            double bailout,
+                                            double,
+                                            double &distance,
+                                            Math::Vector3D &gradient) const {
+    Math::Vector3D c = point - center;
+    Math::Vector3D z = c;
+    Math::Matrix3x3 jacobian;
     double dr = 1.0;
     double fixedRadius2 = 1.0;
 
     for (int i = 0; i < maxIterations; i++) {
-        z = boxFold(z, foldingLimit);
-        z = sphereFold(z, minRadius2, fixedRadius2);
-        z = z * scale + (point - center) * 0.2;
+        double *coords[3] = {&z.X, &z.Y, &z.Z};
+        for (int axis = 0; axis < 3; axis++) {
+            double folded = foldAxis(*coords[axis], foldingLimit);
+            if (folded != *coords[axis]) {
+                for (int j = 0; j < 3; j++)
+                    jacobian.m[axis][j] = -jacobian.m[axis][j];
+            }
+            *coords[axis] = folded;
+        }
+        double r2 = z.dot(z);
+        Math::Matrix3x3 fold;
+        double factor = 1.0;
+        if (r2 < minRadius2) {
+            factor = fixedRadius2 / minRadius2;
+            fold = Math::Matrix3x3(Math::Vector3D(Math::Coords{factor, 0, 0}),
+                Math::Vector3D(Math::Coords{0, factor, 0}),
+                Math::Vector3D(Math::Coords{0, 0, factor}));
+        } else if (r2 < fixedRadius2) {
+            // Inversion z / r2 has Jacobian (I - 2 z z^T / r2) / r2
+            factor = fixedRadius2 / r2;
+            for (int a = 0; a < 3; a++) {
+                for (int b = 0; b < 3; b++)
+                    fold.m[a][b] = ((a == b ? 1.0 : 0.0) - 2.0 * *coords[a] * *coords[b] / r2) * factor;
+            }
+        }
+        jacobian = fold * jacobian;
+        z.X = z.X * factor * scale + c.X * 0.2;
+        z.Y = z.Y * factor * scale + c.Y * 0.2;
+        z.Z = z.Z * factor * scale + c.Z * 0.2;
+        for (int a = 0; a < 3; a++) {
+            for (int b = 0; b < 3; b++)
+                jacobian.m[a][b] = jacobian.m[a][b] * scale + (a == b ? 0.2 : 0.0);
+        }
         dr = dr * std::abs(scale) + 1.0;
-        if (z.length() > bailout)
+        if (z.X * z.X + z.Y * z.Y + z.Z * z.Z > bailout * bailout)
             break;
     }
-    if (dr < 1e-10) dr = 1e-10;
-    double distance = z.length() / std::abs(dr);
-    distance *= 0.02;
-    return std::max(0.00001, distance);
+    double length = z.length();
+    double scaleDown = 0.02 / std::abs(std::max(1e-10, dr));
+    distance = length * scaleDown;
+    if (distance <= 0.00001 || length < 1e-12)
+        return false;
+    gradient = jacobian.transpose() * (z * (scaleDown / length));
+    return true;
+}
+
+template <int Width>
+void MandelboxFractal::estimate(const FractalLanes<Width> &lanes, int maxIterations,
+    double bailout, double, double *distances) const {
+    double zX[Width], zY[Width], zZ[Width];
+    double dr[Width];
+    bool active[Width];
+    double fixedRadius2 = 1.0;
+    // Compared squared, a sqrt call would keep the lane loop from vectorizing
+    double bailout2 = bailout * bailout;
+
+    for (int lane = 0; lane < Width; lane++) {
+        zX[lane] = lanes.x[lane];
+        zY[lane] = lanes.y[lane];
+        zZ[lane] = lanes.z[lane];
+        dr[lane] = 1.0;
+        active[lane] = true;
+    }
+    for (int i = 0; i < maxIterations; i++) {
+        int running = 0;
+        for (int lane = 0; lane < Width; lane++) {
+            double x = foldAxis(zX[lane], foldingLimit);
+            double y = foldAxis(zY[lane], foldingLimit);
+            double z = foldAxis(zZ[lane], foldingLimit);
+            double r2 = x * x + y * y + z * z;
+            double factor = r2 < minRadius2 ? fixedRadius2 / minRadius2
+                : (r2 < fixedRadius2 ? fixedRadius2 / r2 : 1.0);
+            x = x * factor * scale + lanes.x[lane] * 0.2;
+            y = y * factor * scale + lanes.y[lane] * 0.2;
+            z = z * factor * scale + lanes.z[lane] * 0.2;
+            zX[lane] = active[lane] ? x : zX[lane];
+            zY[lane] = active[lane] ? y : zY[lane];
+            zZ[lane] = active[lane] ? z : zZ[lane];
+            dr[lane] = active[lane] ? dr[lane] * std::abs(scale) + 1.0 : dr[lane];
+            active[lane] = active[lane] && !(x * x + y * y + z * z > bailout2);
+            running += active[lane] ? 1 : 0;
+        }
+        if (running == 0)
+            break;
+    }
+    for (int lane = 0; lane < Width; lane++) {
+        double length = std::sqrt(zX[lane] * zX[lane] + zY[lane] * zY[lane] + zZ[lane] * zZ[lane]);
+        double distance = length / std::abs(std::max(1e-10, dr[lane]));
+        distances[lane] = std::max(0.00001, distance * 0.02);
+    }
 }
 
 }  // namespace RayTracer
@@ -19,6 +19,9 @@ class MandelboxFractal : public IFractalType {
     double scale;
     double minRadius2;
     double foldingLimit;
+    template <int Width>
+    void estimate(const FractalLanes<Width> &lanes, int maxIterations,
+        double bailout, double power, double *distances) const;
 
  public:
     explicit MandelboxFractal(double scale = 2.0, double minRadius2 = 0.25, double foldingLimit = 1.0)
@@ -51,6 +54,21 @@ class MandelboxFractal : public IFractalType {
                             int maxIterations,
                             double bailout,
                             double power) const override;
+    void distanceEstimatorN(const Math::Point3D *points, int count,
+                            double *distances,
+                            const Math::Point3D& center,
+                            int maxIterations,
+                            double bailout,
+                            double power) const override;
+    bool distanceWithGradient(const Math::Point3D& point,
+                              const Math::Point3D& center,
+                              int maxIterations,
+                              double bailout,
+                              double power,
+                              double &distance,
+                              Math::Vector3D &gradient) const override;
+    // The sphere fold is not tracked in dr, the estimate jumps across folds
+    bool supportsConeMarching() const override { return false; }
     std::shared_ptr<IFractalType> clone() const override {
         return std::make_shared<MandelboxFractal>(*this);
     }
@@ -20,6 +20,9 @@ class MandelbrotFractal : public IFractalType {
     double xScale;
     double yScale;
     double zScale;
+    template <int Width>
+    void estimate(const FractalLanes<Width> &lanes, int maxIterations,
+        double bailout, double power, double *distances) const;
 
  public:
     explicit MandelbrotFractal(double xScale = 1.0, double yScale = 1.0,
@@ -42,6 +45,12 @@ class MandelbrotFractal : public IFractalType {
                             int maxIterations,
                             double bailout,
                             double power) const override;
+    void distanceEstimatorN(const Math::Point3D *points, int count,
+                            double *distances,
+                            const Math::Point3D& center,
+                            int maxIterations,
+                            double bailout,
+                            double power) const override;
     std::shared_ptr<IFractalType> clone() const override {
         return std::make_shared<MandelbrotFractal>(*this);
     }
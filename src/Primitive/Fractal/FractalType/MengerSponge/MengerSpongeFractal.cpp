@@ -10,6 +10,7 @@
 #include <iostream>
 #include "Primitive/Fractal/FractalType/MengerSponge/MengerSpongeFractal.hpp"
 #include "Math/Vector3D/Vector3D.hpp"
+#include "Math/Matrix3x3/Matrix3x3.hpp"
 
 namespace RayTracer {
 
@@ -49,39 +50,121 @@ Math::Vector3D estimateNormalMenger(const Math::Point3D& p, const Math::Point3D&
 }
 
 double MengerSpongeFractal::distanceEstimator(const Math::Point3D& point,
-                                            const Math::Point3D& center,
-                                            int maxIterations,
-                                            double bailout,
-                                            double power) const {
-    (void)bailout;
-    (void)power;
-    Math::Vector3D p = point - center;
-    p = p / scale;
-    double d = boxDistance(p, Math::Vector3D(Math::Coords{1, 1, 1}));
+                                              const Math::Point3D& center,
+                                              int maxIterations,
+                                              double bailout,
+                                              double power) const {
+    double distance;
+    estimate(FractalLanes<1>(&point, 1, center), maxIterations, bailout, power, &distance);
+    return distance;
+}
+
+void MengerSpongeFractal::distanceEstimatorN(const Math::Point3D *points, int count,
+                                             double *distances,
+                                             const Math::Point3D& center,
+                                             int maxIterations,
+                                             double bailout,
+                                             double power) const {
+    runLanes(points, count, distances, center, [&](const auto &lanes, double *out) {
+        estimate(lanes, maxIterations, bailout, power, out);
+    });
+}
+
+bool MengerSpongeFractal::distanceWithGradient(const Math::Point3D& point,
+                                               const Math::Point3D& center,
+                                               int maxIterations,
+                                               double,
+                                               double,
+                                               double &distance,
+                                               Math::Vector3D &gradient) const {
+    Math::Vector3D p = (point - center) / scale;
+    double c[3] = {p.X, p.Y, p.Z};
+    double box[3];
+    double grad[3] = {0.0, 0.0, 0.0};
+    double outside = 0.0;
+    int nearest = 0;
+
+    for (int axis = 0; axis < 3; axis++) {
+        box[axis] = std::abs(c[axis]) - 1.0;
+        outside += std::max(box[axis], 0.0) * std::max(box[axis], 0.0);
+        if (box[axis] > box[nearest])
+            nearest = axis;
+    }
+    double d = std::min(box[nearest], 0.0) + std::sqrt(outside);
+    // The box distance and each cross below only depend on one sign per axis
+    if (outside > 0.0) {
+        for (int axis = 0; axis < 3; axis++)
+            grad[axis] = std::copysign(std::max(box[axis], 0.0), c[axis]) / std::sqrt(outside);
+    } else {
+        grad[nearest] = std::copysign(1.0, c[nearest]);
+    }
     int iterations = std::min(maxIterations, 3);
     double m = 1.0;
     for (int i = 0; i < iterations; i++) {
         m *= 3.0;
-        Math::Vector3D a = Math::Vector3D(Math::Coords{
-            std::fmod(std::abs(p.X * m), 3.0),
-            std::fmod(std::abs(p.Y * m), 3.0),
-            std::fmod(std::abs(p.Z * m), 3.0)
-        });
-        Math::Vector3D r = Math::Vector3D(Math::Coords{
-            a.X > 1.0 ? 3.0 - a.X : a.X,
-            a.Y > 1.0 ? 3.0 - a.Y : a.Y,
-            a.Z > 1.0 ? 3.0 - a.Z : a.Z
-        });
-        double s = 1.0;
-        double v = 1.0;
-        double crossDist = std::max(r.X, std::max(r.Y, r.Z)) - s;
-        int count = (r.X > s ? 1 : 0) + (r.Y > s ? 1 : 0) + (r.Z > s ? 1 : 0);
-        if (count >= 2) {
-            d = std::max(d, crossDist / m);
+        double r[3];
+        double slope[3];
+        int widest = 0;
+        int count = 0;
+        for (int axis = 0; axis < 3; axis++) {
+            double a = std::fmod(std::abs(c[axis] * m), 3.0);
+            r[axis] = a > 1.0 ? 3.0 - a : a;
+            slope[axis] = (a > 1.0 ? -1.0 : 1.0) * std::copysign(1.0, c[axis]);
+            count += r[axis] > 1.0 ? 1 : 0;
+            if (r[axis] > r[widest])
+                widest = axis;
+        }
+        double crossDist = r[widest] - 1.0;
+        if (count >= 2 && crossDist / m > d) {
+            d = crossDist / m;
+            grad[0] = grad[1] = grad[2] = 0.0;
+            grad[widest] = slope[widest];
+        }
+    }
+    distance = d * 0.4;
+    if (distance <= 0.0001)
+        return false;
+    gradient = Math::Vector3D(Math::Coords{grad[0], grad[1], grad[2]}) * (0.4 / scale);
+    return true;
+}
+
+template <int Width>
+void MengerSpongeFractal::estimate(const FractalLanes<Width> &lanes, int maxIterations,
+    double, double, double *distances) const {
+    double pX[Width], pY[Width], pZ[Width];
+    double d[Width];
+    int iterations = std::min(maxIterations, 3);
+
+    for (int lane = 0; lane < Width; lane++) {
+        pX[lane] = lanes.x[lane] / scale;
+        pY[lane] = lanes.y[lane] / scale;
+        pZ[lane] = lanes.z[lane] / scale;
+        double dX = std::abs(pX[lane]) - 1.0;
+        double dY = std::abs(pY[lane]) - 1.0;
+        double dZ = std::abs(pZ[lane]) - 1.0;
+        double oX = std::max(dX, 0.0);
+        double oY = std::max(dY, 0.0);
+        double oZ = std::max(dZ, 0.0);
+        d[lane] = std::min(std::max(dX, std::max(dY, dZ)), 0.0)
+            + std::sqrt(oX * oX + oY * oY + oZ * oZ);
+    }
+    double m = 1.0;
+    for (int i = 0; i < iterations; i++) {
+        m *= 3.0;
+        for (int lane = 0; lane < lanes.count; lane++) {
+            double aX = std::fmod(std::abs(pX[lane] * m), 3.0);
+            double aY = std::fmod(std::abs(pY[lane] * m), 3.0);
+            double aZ = std::fmod(std::abs(pZ[lane] * m), 3.0);
+            double rX = aX > 1.0 ? 3.0 - aX : aX;
+            double rY = aY > 1.0 ? 3.0 - aY : aY;
+            double rZ = aZ > 1.0 ? 3.0 - aZ : aZ;
+            double crossDist = std::max(rX, std::max(rY, rZ)) - 1.0;
+            int count = (rX > 1.0 ? 1 : 0) + (rY > 1.0 ? 1 : 0) + (rZ > 1.0 ? 1 : 0);
+            d[lane] = count >= 2 ? std::max(d[lane], crossDist / m) : d[lane];
         }
     }
-    double finalDistance = d * 0.4;
-    return std::max(0.0001, finalDistance);
+    for (int lane = 0; lane < Width; lane++)
+        distances[lane] = std::max(0.0001, d[lane] * 0.4);
 }
 
 }  // namespace RayTracer
@@ -17,6 +17,9 @@ namespace RayTracer {
 class MengerSpongeFractal : public IFractalType {
  private:
     double scale;
+    template <int Width>
+    void estimate(const FractalLanes<Width> &lanes, int maxIterations,
+        double bailout, double power, double *distances) const;
 
  public:
     explicit MengerSpongeFractal(double scale = 3.0)
@@ -40,6 +43,22 @@ class MengerSpongeFractal : public IFractalType {
                             int maxIterations,
                             double bailout,
                             double power) const override;
+    void distanceEstimatorN(const Math::Point3D *points, int count,
+                            double *distances,
+                            const Math::Point3D& center,
+                            int maxIterations,
+                            double bailout,
+                            double power) const override;
+    bool distanceWithGradient(const Math::Point3D& point,
+                              const Math::Point3D& center,
+                              int maxIterations,
+                              double bailout,
+                              double power,
+                              double &distance,
+                              Math::Vector3D &gradient) const override;
+
+    // The fmod based crosses make the estimate jump between cells
+    bool supportsConeMarching() const override { return false; }
 
     std::shared_ptr<IFractalType> clone() const override {
         return std::make_shared<MengerSpongeFractal>(*this);
@@ -13,24 +13,44 @@
 namespace RayTracer {
 
 double QuaternionJuliaFractal::distanceEstimator(const Math::Point3D& point,
-                                               const Math::Point3D& center,
-                                               int maxIterations,
-                                               double bailout,
-                                               double power) const {
-    Math::Vector3D p = point - center;
-    Quaternion z(p.X, p.Y, p.Z, 0.0);
-    Quaternion dz(1.0, 0.0, 0.0, 0.0);
-    double r = 0.0;
-    int i;
-    for (i = 0; i < maxIterations; i++) {
-        dz = powerDerivative(z, dz, power);
-        z = powerQuaternion(z, power) + constant;
-        r = z.length();
-        if (r > bailout)
-            break;
+                                                 const Math::Point3D& center,
+                                                 int maxIterations,
+                                                 double bailout,
+                                                 double power) const {
+    double distance;
+    estimate(FractalLanes<1>(&point, 1, center), maxIterations, bailout, power, &distance);
+    return distance;
+}
+
+void QuaternionJuliaFractal::distanceEstimatorN(const Math::Point3D *points, int count,
+                                                double *distances,
+                                                const Math::Point3D& center,
+                                                int maxIterations,
+                                                double bailout,
+                                                double power) const {
+    runLanes(points, count, distances, center, [&](const auto &lanes, double *out) {
+        estimate(lanes, maxIterations, bailout, power, out);
+    });
+}
+
+template <int Width>
+void QuaternionJuliaFractal::estimate(const FractalLanes<Width> &lanes, int maxIterations,
+    double bailout, double power, double *distances) const {
+    // acos and pow in powerQuaternion keep this one a lane at a time
+    for (int lane = 0; lane < lanes.count; lane++) {
+        Quaternion z(lanes.x[lane], lanes.y[lane], lanes.z[lane], 0.0);
+        Quaternion dz(1.0, 0.0, 0.0, 0.0);
+        double r = 0.0;
+        for (int i = 0; i < maxIterations; i++) {
+            dz = powerDerivative(z, dz, power);
+            z = powerQuaternion(z, power) + constant;
+            r = z.length();
+            if (r > bailout)
+                break;
+        }
+        double distance = 0.5 * r * std::log(r) / dz.length();
+        distances[lane] = std::max(0.001, distance);
     }
-    double distance = 0.5 * r * std::log(r) / dz.length();
-    return std::max(0.001, distance);
 }
 
 Quaternion QuaternionJuliaFractal::powerQuaternion(const Quaternion& z, double n) const {
@@ -55,6 +55,9 @@ class QuaternionJuliaFractal : public IFractalType {
     Quaternion constant;
     Quaternion powerQuaternion(const Quaternion& z, double n) const;
     Quaternion powerDerivative(const Quaternion& z, const Quaternion& dz, double n) const;
+    template <int Width>
+    void estimate(const FractalLanes<Width> &lanes, int maxIterations,
+        double bailout, double power, double *distances) const;
 
  public:
     explicit QuaternionJuliaFractal(double cx = 0.35, double cy = 0.3, double cz = 0.0, double cw = 0.0)
@@ -75,6 +78,14 @@ class QuaternionJuliaFractal : public IFractalType {
                             int maxIterations,
                             double bailout,
                             double power) const override;
+    void distanceEstimatorN(const Math::Point3D *points, int count,
+                            double *distances,
+                            const Math::Point3D& center,
+                            int maxIterations,
+                            double bailout,
+                            double power) const override;
+    // The raw 0.5 r log(r) / |dz| estimate overshoots away from power 2
+    double getLipschitzBound() const override { return 2.0; }
     std::shared_ptr<IFractalType> clone() const override {
         return std::make_shared<QuaternionJuliaFractal>(*this);
     }
@@ -34,32 +34,60 @@ Math::Vector3D estimateNormalSierpinski(const Math::Point3D& p, const Math::Poin
 }
 
 double SierpinskiTetrahedronFractal::distanceEstimator(const Math::Point3D& point,
-                                          const Math::Point3D& center,
-                                          int maxIterations,
-                                          double bailout,
-                                          double power) const {
-    (void)bailout;
-    (void)power;
-    Math::Vector3D p = point - center;
+                                                       const Math::Point3D& center,
+                                                       int maxIterations,
+                                                       double bailout,
+                                                       double power) const {
+    double distance;
+    estimate(FractalLanes<1>(&point, 1, center), maxIterations, bailout, power, &distance);
+    return distance;
+}
+
+void SierpinskiTetrahedronFractal::distanceEstimatorN(const Math::Point3D *points, int count,
+                                                      double *distances,
+                                                      const Math::Point3D& center,
+                                                      int maxIterations,
+                                                      double bailout,
+                                                      double power) const {
+    runLanes(points, count, distances, center, [&](const auto &lanes, double *out) {
+        estimate(lanes, maxIterations, bailout, power, out);
+    });
+}
+
+template <int Width>
+void SierpinskiTetrahedronFractal::estimate(const FractalLanes<Width> &lanes, int maxIterations,
+    double, double, double *distances) const {
+    double zX[Width], zY[Width], zZ[Width];
     double r = 2.0;
-    Math::Vector3D z = p;
     int n = std::min(maxIterations, 9);
+
+    for (int lane = 0; lane < Width; lane++) {
+        zX[lane] = lanes.x[lane];
+        zY[lane] = lanes.y[lane];
+        zZ[lane] = lanes.z[lane];
+    }
     for (int i = 0; i < n; i++) {
-        z.X = std::fabs(z.X);
-        z.Y = std::fabs(z.Y);
-        z.Z = std::fabs(z.Z);
-        if (z.X < z.Y) std::swap(z.X, z.Y);
-        if (z.Y < z.Z) std::swap(z.Y, z.Z);
-        if (z.X < z.Y) std::swap(z.X, z.Y);
-        z.X = z.X * 2.0 - 1.0;
-        z.X *= scale;
-        z.Y *= scale;
-        z.Z *= scale;
+        for (int lane = 0; lane < Width; lane++) {
+            double x = std::fabs(zX[lane]);
+            double y = std::fabs(zY[lane]);
+            double z = std::fabs(zZ[lane]);
+            // Sorting the three coordinates with min/max instead of swaps
+            double high = std::max(x, y);
+            double low = std::min(x, y);
+            double middle = std::max(low, z);
+            z = std::min(low, z);
+            x = std::max(high, middle);
+            y = std::min(high, middle);
+            zX[lane] = (x * 2.0 - 1.0) * scale;
+            zY[lane] = y * scale;
+            zZ[lane] = z * scale;
+        }
         r = r / scale;
     }
-    double finalDistance = (Math::Vector3D(Math::Coords{z.Z, z.Y, 0.0}).length() - 0.5) * r;
-    finalDistance *= 0.15;
-    return std::max(0.0001, finalDistance);
+    for (int lane = 0; lane < Width; lane++) {
+        double length = std::sqrt(zZ[lane] * zZ[lane] + zY[lane] * zY[lane]);
+        distances[lane] = std::max(0.0001, (length - 0.5) * r * 0.15);
+    }
 }
 
 }  // namespace RayTracer
@@ -18,6 +18,9 @@ class SierpinskiTetrahedronFractal : public IFractalType {
  private:
     double scale;
     double offset;
+    template <int Width>
+    void estimate(const FractalLanes<Width> &lanes, int maxIterations,
+        double bailout, double power, double *distances) const;
 
  public:
     explicit SierpinskiTetrahedronFractal(double scale = 2.0, double offset = 1.0)
@@ -43,6 +46,14 @@ class SierpinskiTetrahedronFractal : public IFractalType {
                             int maxIterations,
                             double bailout,
                             double power) const override;
+    void distanceEstimatorN(const Math::Point3D *points, int count,
+                            double *distances,
+                            const Math::Point3D& center,
+                            int maxIterations,
+                            double bailout,
+                            double power) const override;
+    // The folds scale the estimate up faster than one cell of the cache hides
+    bool supportsDistanceCache() const override { return false; }
     std::shared_ptr<IFractalType> clone() const override {
         return std::make_shared<SierpinskiTetrahedronFractal>(*this);
     }
@@ -8,6 +8,7 @@
 
 #ifndef SRC_PRIMITIVE_IPRIMITIVE_HPP_
   #define SRC_PRIMITIVE_IPRIMITIVE_HPP_
+  #include <algorithm>
   #include <string>
   #include <memory>
   #include <optional>
@@ -16,7 +17,10 @@
   #include "Material/Material.hpp"
   #include "Math/Vector3D/Vector3D.hpp"
   #include "Math/Point3D/Point3D.hpp"
+  #include "Math/AABB/AABB.hpp"
   #include "Ray/Ray.hpp"
+  #include "Ray/RayPacket.hpp"
+  #include "Ray/PrimaryView.hpp"
 namespace RayTracer {
 class IPrimitive {
  public:
@@ -33,11 +37,66 @@ class IPrimitive {
     virtual void rotateZ(double degrees) = 0;
     virtual std::optional<HitInfo> hit(const Ray &ray,
       double tMin, double tMax) = 0;
-    virtual std::shared_ptr<Material> getMaterial() const = 0;
+    // Distance of the hit() hit without its normal and UV, for closest-hit
+    // searches that only evaluate the surface of the winner.
+    // Primitives without a cheaper test fall back to hit()
+    virtual std::optional<double> intersect(const Ray &ray, double tMin, double tMax) {
+        auto hit = this->hit(ray, tMin, tMax);
+        if (!hit)
+            return std::nullopt;
+        return hit->distance;
+    }
+    // Full hit() at a distance intersect() or hitPacket() already found for ray.
+    // Primitives that cannot evaluate it directly run hit() again, with a little
+    // room above it since distance-only tests may round differently
+    virtual std::optional<HitInfo> surfaceAt(const Ray &ray, double tMin, double distance) {
+        return hit(ray, tMin, distance + 1e-7 * std::max(1.0, distance));
+    }
+    // Whether anything of the primitive lies in [tMin, tMax], for shadow rays.
+    // Meshes and composites stop at their first blocking part
+    virtual bool occluded(const Ray &ray, double tMin, double tMax) {
+        return intersect(ray, tMin, tMax).has_value();
+    }
+    // Shrinks hits.distance of every lane hit closer and records this primitive there.
+    // Primitives without a packet kernel fall back to one hit() per lane
+    virtual void hitPacket(const RayPacket &packet, double tMin, PacketHit &hits) {
+        for (int lane = 0; lane < packet.count; lane++) {
+            auto hit = this->hit(packet.getRay(lane), tMin, hits.distance[lane]);
+            if (hit) {
+                hits.distance[lane] = hit->distance;
+                hits.primitive[lane] = this;
+            }
+        }
+    }
+    // Called once per frame before any primary ray is traced, lets costly
+    // primitives precompute what the camera will see
+    virtual void prepareView(const PrimaryView &view) { (void)view; }
+    // Called once at scene load when the material has a displacement map.
+    // Primitives able to bake it into their geometry do so, the others keep
+    // having their hits displaced by the scene
+    virtual void tessellateDisplacement() {}
+    // True once hit() reports the displaced surface itself
+    virtual bool hasDisplacedGeometry() const { return false; }
+    virtual const std::shared_ptr<Material> &getMaterial() const = 0;
     virtual std::shared_ptr<IPrimitive> clone() const = 0;
     virtual void getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) const = 0;
 
+    // UV units per world unit around hit, turns the world width a ray cone
+    // covers into a texture footprint. By default the UVs are assumed to span
+    // the bounds once; unbounded primitives without an override report 0
+    virtual double getUVDensity(const HitInfo &hit) const {
+        (void)hit;
+        Math::AABB bounds = getBoundingBox();
+        if (bounds.isEmpty() || !bounds.isBounded())
+            return 0.0;
+        Math::Vector3D extent = bounds.extent();
+        double largest = std::max({extent.X, extent.Y, extent.Z});
+        return largest > 0.0 ? 1.0 / largest : 0.0;
+    }
+
     virtual Math::Point3D getPosition() const = 0;
+    // World-space bounds of everything hit() can report, infinite if unbounded
+    virtual Math::AABB getBoundingBox() const = 0;
 };
 }  // namespace RayTracer
 
@@ -30,6 +30,7 @@ void InfiniteCone::translate(const Math::Vector3D &translation) {
 
 void InfiniteCone::rotateX(double degrees) {
     rotationX += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateX("x", degrees);
     apex = rotateX.applyToPoint(apex);
     axis = rotateX.applyToVector(axis).normalize();
@@ -37,6 +38,7 @@ void InfiniteCone::rotateX(double degrees) {
 
 void InfiniteCone::rotateY(double degrees) {
     rotationY += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateY("y", degrees);
     apex = rotateY.applyToPoint(apex);
     axis = rotateY.applyToVector(axis).normalize();
@@ -44,40 +46,19 @@ void InfiniteCone::rotateY(double degrees) {
 
 void InfiniteCone::rotateZ(double degrees) {
     rotationZ += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateZ("z", degrees);
     apex = rotateZ.applyToPoint(apex);
     axis = rotateZ.applyToVector(axis).normalize();
 }
 
-std::shared_ptr<Material> InfiniteCone::getMaterial() const {
+const std::shared_ptr<Material> &InfiniteCone::getMaterial() const {
     return material;
 }
 
 std::optional<HitInfo> InfiniteCone::hit(const Ray &ray, double tMin,
 double tMax) {
-    Ray transformedRay = ray;
-    if (rotationX != 0.0 || rotationY != 0.0 || rotationZ != 0.0) {
-        Math::Point3D newOrigin = ray.origin;
-        Math::Vector3D newDirection = ray.direction;
-
-        if (rotationZ != 0.0) {
-            RayTracer::Rotate rotateZ("z", -rotationZ);
-            newOrigin = rotateZ.applyToPoint(newOrigin);
-            newDirection = rotateZ.applyToVector(newDirection);
-        }
-        if (rotationY != 0.0) {
-            RayTracer::Rotate rotateY("y", -rotationY);
-            newOrigin = rotateY.applyToPoint(newOrigin);
-            newDirection = rotateY.applyToVector(newDirection);
-        }
-        if (rotationX != 0.0) {
-            RayTracer::Rotate rotateX("x", -rotationX);
-            newOrigin = rotateX.applyToPoint(newOrigin);
-            newDirection = rotateX.applyToVector(newDirection);
-        }
-
-        transformedRay = Ray(newOrigin, newDirection);
-    }
+    Ray transformedRay = transform.toObject(ray);
 
     Math::Vector3D co = transformedRay.origin - apex;
 
@@ -131,20 +112,7 @@ double tMax) {
     if (normal.dot(transformedRay.direction) > 0)
         normal = normal * -1.0;
 
-    if (rotationX != 0.0 || rotationY != 0.0 || rotationZ != 0.0) {
-        if (rotationX != 0.0) {
-            RayTracer::Rotate rotateX("x", rotationX);
-            normal = rotateX.applyToVector(normal);
-        }
-        if (rotationY != 0.0) {
-            RayTracer::Rotate rotateY("y", rotationY);
-            normal = rotateY.applyToVector(normal);
-        }
-        if (rotationZ != 0.0) {
-            RayTracer::Rotate rotateZ("z", rotationZ);
-            normal = rotateZ.applyToVector(normal);
-        }
-    }
+    normal = transform.normalToWorld(normal);
 
     Math::Vector3D apexToHit = hitPoint - apex;
 
@@ -169,7 +137,7 @@ double tMax) {
         info.hitPoint = ray.origin + ray.direction * t;
         info.normal = normal;
         try {
-            info.primitive = std::make_shared<InfiniteCone>(*this);
+            info.primitive = this;
         } catch (const std::exception& e) {
             std::cerr << "Error in InfiniteCone::hit(): " << e.what() << std::endl;
             return std::nullopt;
@@ -191,7 +159,7 @@ double tMax) {
     info.hitPoint = ray.origin + ray.direction * t;
     info.normal = normal;
     try {
-        info.primitive = std::make_shared<InfiniteCone>(*this);
+        info.primitive = this;
     } catch (const std::exception& e) {
         std::cerr << "Error in InfiniteCone::hit(): " << e.what() << std::endl;
         return std::nullopt;
@@ -204,6 +172,7 @@ std::shared_ptr<IPrimitive> InfiniteCone::clone() const {
     copy->rotationX = rotationX;
     copy->rotationY = rotationY;
     copy->rotationZ = rotationZ;
+    copy->transform = transform;
     copy->setSourceFile(sourceFile);
     return copy;
 }
@@ -241,4 +210,9 @@ void InfiniteCone::getLibConfigParams(std::shared_ptr<libconfig::Setting> settin
     mat.add("transparency", libconfig::Setting::TypeFloat) = material->transparency;
     mat.add("refractionIndex", libconfig::Setting::TypeFloat) = material->refractionIndex;
 }
+
+Math::AABB InfiniteCone::getBoundingBox() const {
+    return Math::AABB::infinite();
+}
+
 }  // namespace RayTracer
@@ -29,6 +29,7 @@ void InfiniteCylinder::translate(const Math::Vector3D &translation) {
 
 void InfiniteCylinder::rotateX(double degrees) {
     rotationX += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateX("x", degrees);
     center = rotateX.applyToPoint(center);
     axis = rotateX.applyToVector(axis).normalize();
@@ -36,6 +37,7 @@ void InfiniteCylinder::rotateX(double degrees) {
 
 void InfiniteCylinder::rotateY(double degrees) {
     rotationY += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateY("y", degrees);
     center = rotateY.applyToPoint(center);
     axis = rotateY.applyToVector(axis).normalize();
@@ -43,40 +45,19 @@ void InfiniteCylinder::rotateY(double degrees) {
 
 void InfiniteCylinder::rotateZ(double degrees) {
     rotationZ += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateZ("z", degrees);
     center = rotateZ.applyToPoint(center);
     axis = rotateZ.applyToVector(axis).normalize();
 }
 
-std::shared_ptr<Material> InfiniteCylinder::getMaterial() const {
+const std::shared_ptr<Material> &InfiniteCylinder::getMaterial() const {
     return material;
 }
 
 std::optional<HitInfo> InfiniteCylinder::hit(const Ray &ray,
 double tMin, double tMax) {
-    Ray transformedRay = ray;
-    if (rotationX != 0.0 || rotationY != 0.0 || rotationZ != 0.0) {
-        Math::Point3D newOrigin = ray.origin;
-        Math::Vector3D newDirection = ray.direction;
-
-        if (rotationZ != 0.0) {
-            RayTracer::Rotate rotateZ("z", -rotationZ);
-            newOrigin = rotateZ.applyToPoint(newOrigin);
-            newDirection = rotateZ.applyToVector(newDirection);
-        }
-        if (rotationY != 0.0) {
-            RayTracer::Rotate rotateY("y", -rotationY);
-            newOrigin = rotateY.applyToPoint(newOrigin);
-            newDirection = rotateY.applyToVector(newDirection);
-        }
-        if (rotationX != 0.0) {
-            RayTracer::Rotate rotateX("x", -rotationX);
-            newOrigin = rotateX.applyToPoint(newOrigin);
-            newDirection = rotateX.applyToVector(newDirection);
-        }
-
-        transformedRay = Ray(newOrigin, newDirection);
-    }
+    Ray transformedRay = transform.toObject(ray);
 
     Math::Vector3D oc = transformedRay.origin - center;
 
@@ -110,19 +91,8 @@ double tMin, double tMax) {
 
     Math::Vector3D untransformedNormal = normal;
 
-    if (rotationX != 0.0 || rotationY != 0.0 || rotationZ != 0.0) {
-        if (rotationX != 0.0) {
-            RayTracer::Rotate rotateX("x", rotationX);
-            normal = rotateX.applyToVector(normal);
-        }
-        if (rotationY != 0.0) {
-            RayTracer::Rotate rotateY("y", rotationY);
-            normal = rotateY.applyToVector(normal);
-        }
-        if (rotationZ != 0.0) {
-            RayTracer::Rotate rotateZ("z", rotationZ);
-            normal = rotateZ.applyToVector(normal);
-        }
+    if (!transform.isIdentity()) {
+        normal = transform.normalToWorld(normal);
 
         double dotProduct = normal.dot(axis);
         if (std::abs(dotProduct) > 0.0001) {
@@ -154,7 +124,7 @@ double tMin, double tMax) {
     info.normal = normal;
     info.uv = Math::Vector2D(u, v);
     try {
-        info.primitive = std::make_shared<InfiniteCylinder>(*this);
+        info.primitive = this;
     } catch (const std::exception& e) {
         std::cerr << "Error in InfiniteCylinder::hit(): " << e.what() << std::endl;
         return std::nullopt;
@@ -168,6 +138,7 @@ std::shared_ptr<IPrimitive> InfiniteCylinder::clone() const {
     copy->rotationX = rotationX;
     copy->rotationY = rotationY;
     copy->rotationZ = rotationZ;
+    copy->transform = transform;
     copy->setSourceFile(sourceFile);
     return copy;
 }
@@ -205,4 +176,9 @@ void InfiniteCylinder::getLibConfigParams(std::shared_ptr<libconfig::Setting> se
     mat.add("transparency", libconfig::Setting::TypeFloat) = material->transparency;
     mat.add("refractionIndex", libconfig::Setting::TypeFloat) = material->refractionIndex;
 }
+
+Math::AABB InfiniteCylinder::getBoundingBox() const {
+    return Math::AABB::infinite();
+}
+
 }  // namespace RayTracer
@@ -32,17 +32,20 @@ void KleinBottle::translate(const Math::Vector3D &translation) {
 
 void KleinBottle::rotateX(double degrees) {
     rotationX += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
 }
 
 void KleinBottle::rotateY(double degrees) {
     rotationY += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
 }
 
 void KleinBottle::rotateZ(double degrees) {
     rotationZ += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
 }
 
-std::shared_ptr<Material> KleinBottle::getMaterial() const {
+const std::shared_ptr<Material> &KleinBottle::getMaterial() const {
     return material;
 }
 
@@ -51,6 +54,7 @@ std::shared_ptr<IPrimitive> KleinBottle::clone() const {
     copy->rotationX = rotationX;
     copy->rotationY = rotationY;
     copy->rotationZ = rotationZ;
+    copy->transform = transform;
     copy->setSourceFile(sourceFile);
     return copy;
 }
@@ -65,40 +69,19 @@ void KleinBottle::getLibConfigParams(std::shared_ptr<libconfig::Setting> setting
     (*setting)["figure8"] = isFigure8 ? 1 : 0;
 }
 
-void KleinBottle::applyRotations(std::shared_ptr<double> x, std::shared_ptr<double> y, std::shared_ptr<double> z) const {
-    if (rotationX != 0.0) {
-        double rad = rotationX * M_PI / 180.0;
-        double newY = *y * cos(rad) - *z * sin(rad);
-        double newZ = *y * sin(rad) + *z * cos(rad);
-        *y = newY;
-        *z = newZ;
-    }
-    if (rotationY != 0.0) {
-        double rad = rotationY * M_PI / 180.0;
-        double newX = *x * cos(rad) + *z * sin(rad);
-        double newZ = -*x * sin(rad) + *z * cos(rad);
-        *x = newX;
-        *z = newZ;
-    }
-    if (rotationZ != 0.0) {
-        double rad = rotationZ * M_PI / 180.0;
-        double newX = *x * cos(rad) - *y * sin(rad);
-        double newY = *x * sin(rad) + *y * cos(rad);
-        *x = newX;
-        *y = newY;
-    }
+Math::Vector3D KleinBottle::applyRotations(const Math::Vector3D &offset) const {
+    return transform.vectorToWorld(offset);
 }
 
 double KleinBottle::classicBottleDE(const Math::Point3D &p) const {
-    auto x = std::make_shared<double>((p.X - center.X) / scale);
-    auto y = std::make_shared<double>((p.Y - center.Y) / scale);
-    auto z = std::make_shared<double>((p.Z - center.Z) / scale);
-
-    applyRotations(x, y, z);
+    Math::Vector3D local = applyRotations((p - center) / scale);
+    double x = local.X;
+    double y = local.Y;
+    double z = local.Z;
 
     double a = 0.8;
     double b = 0.3;
-    double r = std::sqrt((*x)*(*x) + (*y)*(*y));
+    double r = std::sqrt(x * x + y * y);
     double d = 1e10;
     for (int i = 0; i < 16; i++) {
         double u = i * M_PI / 8.0;
@@ -115,9 +98,9 @@ double KleinBottle::classicBottleDE(const Math::Point3D &p) const {
                 ky = a * (sin(u) * (1 + cos(v)) - b * sin(u) * cos(v));
                 kz = -b * sin(v);
             }
-            double dx = *x - kx;
-            double dy = *y - ky;
-            double dz = *z - kz;
+            double dx = x - kx;
+            double dy = y - ky;
+            double dz = z - kz;
             double dist = std::sqrt(dx*dx + dy*dy + dz*dz);
             d = std::min(d, dist);
         }
@@ -126,24 +109,23 @@ double KleinBottle::classicBottleDE(const Math::Point3D &p) const {
 }
 
 double KleinBottle::figure8DE(const Math::Point3D &p) const {
-    auto x = std::make_shared<double>((p.X - center.X) / scale);
-    auto y = std::make_shared<double>((p.Y - center.Y) / scale);
-    auto z = std::make_shared<double>((p.Z - center.Z) / scale);
-
-    applyRotations(x, y, z);
+    Math::Vector3D local = applyRotations((p - center) / scale);
+    double x = local.X;
+    double y = local.Y;
+    double z = local.Z;
 
     double r = 1.0;
     double a = 0.2;
-    double rho = sqrt((*x)*(*x) + (*y)*(*y));
-    double phi = atan2(*y, *x);
+    double rho = sqrt(x * x + y * y);
+    double phi = atan2(y, x);
     double u = phi / 2.0;
-    double v = atan2(*z, rho - r);
+    double v = atan2(z, rho - r);
     double cx = r * cos(u) * (cos(v) + 1.0) / 2.0;
     double cy = r * sin(u) * (cos(v) + 1.0) / 2.0;
     double cz = r * sin(v) / 2.0;
     double dx = rho * cos(phi) - cx;
     double dy = rho * sin(phi) - cy;
-    double dz = *z - cz;
+    double dz = z - cz;
     double d = sqrt(dx*dx + dy*dy + dz*dz) - a;
     d -= 0.05 * sin(2.0 * phi) * sin(v);
     return d * scale - thickness;
@@ -179,26 +161,31 @@ Math::Vector3D KleinBottle::estimateNormal(const Math::Point3D &p) const {
 }
 
 std::optional<HitInfo> KleinBottle::hit(const Ray &ray, double tMin, double tMax) {
-    double t = tMin;
-    const double minDistance = 0.001;
-    const int maxSteps = 256;
-    const double maxStepSize = 0.1;
-
-    for (int i = 0; i < maxSteps && t < tMax; i++) {
-        Math::Point3D position = ray.origin + ray.direction * t;
-        double distance = distanceEstimator(position);
-
-        if (distance < minDistance) {
-            HitInfo info;
-            info.distance = t;
-            info.hitPoint = position;
-            info.normal = estimateNormal(position);
-            info.primitive = shared_from_this();
-            return info;
-        }
-        t += std::max(distance, 0.0001);
-    }
-    return std::nullopt;
+    SdfMarchSettings settings;
+    settings.maxSteps = 256;
+    settings.epsilon = 0.001;
+    // The classic estimator measures in bottle units, a world unit is 1 / scale of them
+    settings.lipschitz = isFigure8 ? 1.0 : 1.0 / scale;
+    settings.minStep = 0.0001;
+    auto march = SdfMarcher(settings).march(ray, tMin, tMax,
+        [this](const Math::Point3D &position) {
+            return distanceEstimator(position);
+        });
+    if (!march)
+        return std::nullopt;
+
+    HitInfo info;
+    info.distance = march->t;
+    info.hitPoint = ray.at(march->t);
+    info.normal = estimateNormal(info.hitPoint);
+    info.primitive = this;
+    return info;
+}
+
+Math::AABB KleinBottle::getBoundingBox() const {
+    // The distance estimator rotates around the center, so only the
+    // surface extent matters: both variants stay within 3 scale units
+    return Math::AABB(center, center).inflated(scale * 3.0 + thickness);
 }
 
 }  // namespace RayTracer
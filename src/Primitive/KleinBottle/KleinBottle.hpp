@@ -11,16 +11,18 @@
     #include <string>
     #include <memory>
     #include "Primitive/IPrimitive.hpp"
-    #include "Transformation/Rotate/Rotate.hpp"
+    #include "Transformation/ObjectTransform/ObjectTransform.hpp"
+    #include "Primitive/SdfMarcher/SdfMarcher.hpp"
     #include <libconfig.h++>
 
 namespace RayTracer {
-class KleinBottle : public IPrimitive, public std::enable_shared_from_this<KleinBottle> {
+class KleinBottle : public IPrimitive {
  private:
     std::shared_ptr<Material> material;
     double rotationX = 0.0;
     double rotationY = 0.0;
     double rotationZ = 0.0;
+    ObjectTransform transform;
     bool isFigure8 = false;
     std::string sourceFile = "";
 
@@ -55,19 +57,19 @@ class KleinBottle : public IPrimitive, public std::enable_shared_from_this<Klein
     void rotateY(double degrees) override;
     void rotateZ(double degrees) override;
     std::optional<HitInfo> hit(const Ray &ray, double tMin, double tMax) override;
-    std::shared_ptr<Material> getMaterial() const override;
+    const std::shared_ptr<Material> &getMaterial() const override;
     std::shared_ptr<IPrimitive> clone() const override;
     void getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) const override;
 
     Math::Point3D getPosition() const override { return center; }
+    Math::AABB getBoundingBox() const override;
 
  private:
     double distanceEstimator(const Math::Point3D &p) const;
     double classicBottleDE(const Math::Point3D &p) const;
     double figure8DE(const Math::Point3D &p) const;
     Math::Vector3D estimateNormal(const Math::Point3D &p) const;
-    void applyRotations(std::shared_ptr<double> x, std::shared_ptr<double> y,
-        std::shared_ptr<double> z) const;
+    Math::Vector3D applyRotations(const Math::Vector3D &offset) const;
     double mix(double a, double b, double t) const;
     double smoothstep(double edge0, double edge1, double x) const;
     double clamp(double x, double minVal, double maxVal) const;
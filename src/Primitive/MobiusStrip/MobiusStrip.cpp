@@ -28,28 +28,31 @@ void MobiusStrip::translate(const Math::Vector3D &translation) {
 
 void MobiusStrip::rotateX(double degrees) {
     rotationX += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateX("x", degrees);
     center = rotateX.applyToPoint(center);
 }
 
 void MobiusStrip::rotateY(double degrees) {
     rotationY += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateY("y", degrees);
     center = rotateY.applyToPoint(center);
 }
 
 void MobiusStrip::rotateZ(double degrees) {
     rotationZ += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateZ("z", degrees);
     center = rotateZ.applyToPoint(center);
 }
 
-std::shared_ptr<Material> MobiusStrip::getMaterial() const {
+const std::shared_ptr<Material> &MobiusStrip::getMaterial() const {
     return material;
 }
 
 std::optional<HitInfo> MobiusStrip::hit(const Ray &ray, double tMin, double tMax) {
-    Ray transformedRay = MobiusStripUtils::transformRayForRotation(ray, rotationX, rotationY, rotationZ);
+    Ray transformedRay = transform.toObject(ray);
     double boundingSphereRadius = majorRadius + minorRadius + thickness/2.0;
     if (!MobiusStripUtils::checkBoundingSphereIntersection(transformedRay, center, boundingSphereRadius)) {
         return std::nullopt;
@@ -60,8 +63,7 @@ std::optional<HitInfo> MobiusStrip::hit(const Ray &ray, double tMin, double tMax
     if (!intersection.found) {
         return std::nullopt;
     }
-    Math::Vector3D normal = MobiusStripUtils::rotateNormal(intersection.normal,
-                                                          rotationX, rotationY, rotationZ);
+    Math::Vector3D normal = transform.normalToWorld(intersection.normal);
     if (normal.dot(ray.direction) > 0) {
         normal = normal * -1.0;
     }
@@ -69,7 +71,7 @@ std::optional<HitInfo> MobiusStrip::hit(const Ray &ray, double tMin, double tMax
     info.distance = intersection.distance;
     info.hitPoint = ray.origin + ray.direction * intersection.distance;
     info.normal = normal;
-    info.primitive = shared_from_this();
+    info.primitive = this;
     return info;
 }
 
@@ -78,6 +80,7 @@ std::shared_ptr<IPrimitive> MobiusStrip::clone() const {
     copy->rotationX = rotationX;
     copy->rotationY = rotationY;
     copy->rotationZ = rotationZ;
+    copy->transform = transform;
     copy->setSourceFile(sourceFile);
     return copy;
 }
@@ -91,4 +94,10 @@ void MobiusStrip::getLibConfigParams(std::shared_ptr<libconfig::Setting> setting
     (*setting)["thickness"] = thickness;
 }
 
+Math::AABB MobiusStrip::getBoundingBox() const {
+    double boundingSphereRadius = majorRadius + minorRadius + thickness / 2.0;
+
+    return transform.boxToWorld(Math::AABB(center, center)).inflated(boundingSphereRadius);
+}
+
 }  // namespace RayTracer
@@ -3,83 +3,476 @@
 ** EPITECH PROJECT, 2025
 ** Raytracer
 ** File description:
-** ObjModelLoader - loads .obj files and creates triangle primitives
+** ObjModelLoader - loads .obj files into a triangle mesh primitive
 */
-#include <vector>
-#include <memory>
-#include <string>
-#include <map>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
-#include <sstream>
 #include <iostream>
-#include "Math/Point3D/Point3D.hpp"
-#include "Primitive/Plugin/PrimitivePluginManager.hpp"
-#include "Primitive/CompositePrimitive/CompositePrimitive.hpp"
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "Primitive/TriangleMesh/TriangleMesh.hpp"
 #include "ObjModelLoader.hpp"
 
 namespace RayTracer {
 
-std::shared_ptr<IPrimitive>
-ObjModelLoader::loadObjModel(const std::string& path, const std::shared_ptr<Material>& material) {
-    auto composite = std::make_shared<CompositePrimitive>(material);
-    std::vector<Math::Point3D> vertices;
-    std::ifstream file(path);
-    if (!file) {
-        std::cerr << "Failed to open OBJ file: " << path << std::endl;
-        return composite;
-    }
-    std::string line;
-    while (std::getline(file, line)) {
-        std::istringstream iss(line);
-        std::string prefix;
-        iss >> prefix;
-        if (prefix == "v") {
-            double x, y, z;
-            iss >> x >> y >> z;
-            vertices.emplace_back(Math::Coords{x, y, z});
-        } else if (prefix == "f") {
-            std::vector<int> indices;
-            std::string token;
-            while (iss >> token) {
-                std::istringstream tokenStream(token);
-                std::string idxStr;
-                std::getline(tokenStream, idxStr, '/');
-                int idx = std::stoi(idxStr);
-                if (idx < 0) idx = static_cast<int>(vertices.size()) + idx + 1;
-                indices.push_back(idx - 1);
+namespace {
+
+constexpr char CACHE_MAGIC[8] = {'R', 'T', 'M', 'E', 'S', 'H', '0', '1'};
+// Below this size a single thread parses faster than spawning workers
+constexpr size_t MIN_CHUNK_SIZE = 1 << 20;
+
+struct CacheHeader {
+    char magic[8];
+    uint64_t sourceSize;
+    int64_t sourceModifiedSec;
+    int64_t sourceModifiedNsec;
+    uint64_t vertexCount;
+    uint64_t indexCount;
+    uint32_t hasNormals;
+    uint32_t hasTexCoords;
+};
+
+class MappedFile {
+ public:
+    explicit MappedFile(const std::string &path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            return;
+        struct stat info {};
+        if (::fstat(fd, &info) == 0 && info.st_size > 0) {
+            void *mapping = ::mmap(nullptr, static_cast<size_t>(info.st_size),
+                PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping != MAP_FAILED) {
+                _data = static_cast<const char *>(mapping);
+                _size = static_cast<size_t>(info.st_size);
+            }
+        }
+        _open = info.st_size == 0 || _data != nullptr;
+        ::close(fd);
+    }
+    ~MappedFile() {
+        if (_data)
+            ::munmap(const_cast<char *>(_data), _size);
+    }
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    bool isOpen() const { return _open; }
+    const char *data() const { return _data; }
+    size_t size() const { return _size; }
+
+ private:
+    const char *_data = nullptr;
+    size_t _size = 0;
+    bool _open = false;
+};
+
+// Index triple of a face corner, -1 when the attribute is absent.
+// Relative (negative) OBJ indices are resolved against the chunk counters
+// and flagged so the chunk offsets can be added once every chunk is parsed.
+struct ObjCorner {
+    int64_t position = -1;
+    int64_t texCoord = -1;
+    int64_t normal = -1;
+    uint8_t relative = 0;
+};
+
+// Resolved (v, vt, vn) of a corner, one mesh vertex per distinct key
+struct VertexKey {
+    int64_t position;
+    int64_t texCoord;
+    int64_t normal;
+
+    bool operator==(const VertexKey &other) const {
+        return position == other.position && texCoord == other.texCoord
+            && normal == other.normal;
+    }
+};
+
+struct VertexKeyHash {
+    size_t operator()(const VertexKey &key) const {
+        uint64_t hash = static_cast<uint64_t>(key.position) * 0x9E3779B97F4A7C15ull;
+        hash ^= static_cast<uint64_t>(key.texCoord) + 0x632BE59BD9B4E019ull + (hash << 6) + (hash >> 2);
+        hash ^= static_cast<uint64_t>(key.normal) + 0x85EBCA77C2B2AE63ull + (hash << 6) + (hash >> 2);
+        return static_cast<size_t>(hash);
+    }
+};
+
+struct ObjChunk {
+    std::vector<float> positions;
+    std::vector<float> texCoords;
+    std::vector<float> normals;
+    std::vector<ObjCorner> corners;
+    std::vector<uint32_t> faceSizes;
+};
+
+const char *skipSpaces(const char *it, const char *end) {
+    while (it < end && (*it == ' ' || *it == '\t'))
+        it++;
+    return it;
+}
+
+const char *parseFloat(const char *it, const char *end, float &value) {
+    it = skipSpaces(it, end);
+    if (it < end && *it == '+')
+        it++;
+    auto result = std::from_chars(it, end, value);
+    if (result.ec != std::errc())
+        value = 0.0f;
+    return result.ptr;
+}
+
+const char *parseIndex(const char *it, const char *end, int64_t count,
+int64_t &index, bool &relative) {
+    int64_t value = 0;
+    auto result = std::from_chars(it, end, value);
+    if (result.ec != std::errc() || value == 0) {
+        index = -1;
+        return result.ptr;
+    }
+    relative = value < 0;
+    index = relative ? count + value : value - 1;
+    return result.ptr;
+}
+
+void parseFace(const char *it, const char *end, ObjChunk &chunk) {
+    int64_t positionCount = static_cast<int64_t>(chunk.positions.size() / 3);
+    int64_t texCoordCount = static_cast<int64_t>(chunk.texCoords.size() / 2);
+    int64_t normalCount = static_cast<int64_t>(chunk.normals.size() / 3);
+    uint32_t size = 0;
+
+    while (true) {
+        it = skipSpaces(it, end);
+        if (it >= end || *it == '\r' || *it == '#')
+            break;
+        ObjCorner corner;
+        bool relative = false;
+        it = parseIndex(it, end, positionCount, corner.position, relative);
+        corner.relative |= relative ? 1 : 0;
+        if (it < end && *it == '/') {
+            it++;
+            if (it < end && *it != '/') {
+                relative = false;
+                it = parseIndex(it, end, texCoordCount, corner.texCoord, relative);
+                corner.relative |= relative ? 2 : 0;
             }
-            for (size_t i = 1; i + 1 < indices.size(); ++i) {
-                int idx0 = indices[0];
-                int idx1 = indices[i];
-                int idx2 = indices[i + 1];
-                if (idx0 >= 0 && idx1 >= 0 && idx2 >= 0 &&
-                    idx0 < static_cast<int>(vertices.size()) && idx1 < static_cast<int>(vertices.size())
-                        && idx2 < static_cast<int>(vertices.size())) {
-                    std::map<std::string, double> params = {
-                        {"v1x", vertices[idx0].X},
-                        {"v1y", vertices[idx0].Y},
-                        {"v1z", vertices[idx0].Z},
-                        {"v2x", vertices[idx1].X},
-                        {"v2y", vertices[idx1].Y},
-                        {"v2z", vertices[idx1].Z},
-                        {"v3x", vertices[idx2].X},
-                        {"v3y", vertices[idx2].Y},
-                        {"v3z", vertices[idx2].Z}
-                    };
-                    auto pluginManager = PrimitivePluginManager::getInstance();
-                    try {
-                        if (!pluginManager->getPlugin("triangles"))
-                            pluginManager->loadAllPlugins("plugins/primitives");
-                    } catch (...) {
-                        pluginManager->loadAllPlugins("plugins/primitives");
-                    }
-                    auto tri = pluginManager->createPrimitive("triangles", params, material);
-                    composite->add(tri);
-                }
+            if (it < end && *it == '/') {
+                it++;
+                relative = false;
+                it = parseIndex(it, end, normalCount, corner.normal, relative);
+                corner.relative |= relative ? 4 : 0;
             }
         }
+        while (it < end && *it != ' ' && *it != '\t' && *it != '\r')
+            it++;
+        chunk.corners.push_back(corner);
+        size++;
+    }
+    chunk.faceSizes.push_back(size);
+}
+
+void parseChunk(const char *begin, const char *end, ObjChunk &chunk) {
+    const char *line = begin;
+
+    while (line < end) {
+        const char *lineEnd = static_cast<const char *>(
+            std::memchr(line, '\n', static_cast<size_t>(end - line)));
+        if (!lineEnd)
+            lineEnd = end;
+        const char *it = skipSpaces(line, lineEnd);
+
+        if (lineEnd - it > 2 && it[0] == 'v' && it[1] == ' ') {
+            float x = 0.0f;
+            float y = 0.0f;
+            float z = 0.0f;
+            it = parseFloat(it + 2, lineEnd, x);
+            it = parseFloat(it, lineEnd, y);
+            parseFloat(it, lineEnd, z);
+            chunk.positions.insert(chunk.positions.end(), {x, y, z});
+        } else if (lineEnd - it > 3 && it[0] == 'v' && it[1] == 't' && it[2] == ' ') {
+            float u = 0.0f;
+            float v = 0.0f;
+            it = parseFloat(it + 3, lineEnd, u);
+            parseFloat(it, lineEnd, v);
+            chunk.texCoords.insert(chunk.texCoords.end(), {u, v});
+        } else if (lineEnd - it > 3 && it[0] == 'v' && it[1] == 'n' && it[2] == ' ') {
+            float x = 0.0f;
+            float y = 0.0f;
+            float z = 0.0f;
+            it = parseFloat(it + 3, lineEnd, x);
+            it = parseFloat(it, lineEnd, y);
+            parseFloat(it, lineEnd, z);
+            chunk.normals.insert(chunk.normals.end(), {x, y, z});
+        } else if (lineEnd - it > 2 && it[0] == 'f' && it[1] == ' ') {
+            parseFace(it + 2, lineEnd, chunk);
+        }
+        line = lineEnd + 1;
+    }
+}
+
+std::vector<ObjChunk> parseChunks(const char *data, size_t size) {
+    unsigned int hardwareThreads = std::thread::hardware_concurrency();
+    size_t threadCount = std::max<size_t>(1, std::min<size_t>(
+        hardwareThreads == 0 ? 1 : hardwareThreads, size / MIN_CHUNK_SIZE));
+    std::vector<const char *> bounds{data};
+
+    // Cut on line boundaries so every chunk only holds whole lines
+    for (size_t i = 1; i < threadCount; i++) {
+        const char *cut = std::max(data + size * i / threadCount, bounds.back());
+        const char *newline = static_cast<const char *>(
+            std::memchr(cut, '\n', static_cast<size_t>(data + size - cut)));
+        bounds.push_back(newline ? newline + 1 : data + size);
+    }
+    bounds.push_back(data + size);
+
+    std::vector<ObjChunk> chunks(threadCount);
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < threadCount; i++)
+        workers.emplace_back(parseChunk, bounds[i], bounds[i + 1], std::ref(chunks[i]));
+    parseChunk(bounds[0], bounds[1], chunks[0]);
+    for (auto &worker : workers)
+        worker.join();
+    return chunks;
+}
+
+bool getSourceStat(const std::string &path, struct stat &info) {
+    return ::stat(path.c_str(), &info) == 0;
+}
+
+}  // namespace
+
+bool ObjModelLoader::parseObjFile(const std::string& path, MeshData& data) {
+    MappedFile file(path);
+    if (!file.isOpen())
+        return false;
+    std::vector<ObjChunk> chunks = parseChunks(file.data(), file.size());
+
+    std::vector<float> positions;
+    std::vector<float> texCoords;
+    std::vector<float> normals;
+    std::vector<ObjCorner> corners;
+    std::vector<uint32_t> faceSizes;
+    for (auto &chunk : chunks) {
+        int64_t positionOffset = static_cast<int64_t>(positions.size() / 3);
+        int64_t texCoordOffset = static_cast<int64_t>(texCoords.size() / 2);
+        int64_t normalOffset = static_cast<int64_t>(normals.size() / 3);
+
+        for (auto &corner : chunk.corners) {
+            if (corner.relative & 1)
+                corner.position += positionOffset;
+            if (corner.relative & 2)
+                corner.texCoord += texCoordOffset;
+            if (corner.relative & 4)
+                corner.normal += normalOffset;
+        }
+        positions.insert(positions.end(), chunk.positions.begin(), chunk.positions.end());
+        texCoords.insert(texCoords.end(), chunk.texCoords.begin(), chunk.texCoords.end());
+        normals.insert(normals.end(), chunk.normals.begin(), chunk.normals.end());
+        corners.insert(corners.end(), chunk.corners.begin(), chunk.corners.end());
+        faceSizes.insert(faceSizes.end(), chunk.faceSizes.begin(), chunk.faceSizes.end());
+        chunk = ObjChunk();
+    }
+
+    int64_t positionCount = static_cast<int64_t>(positions.size() / 3);
+    int64_t texCoordCount = static_cast<int64_t>(texCoords.size() / 2);
+    int64_t normalCount = static_cast<int64_t>(normals.size() / 3);
+    bool useTexCoords = std::any_of(corners.begin(), corners.end(),
+        [texCoordCount](const ObjCorner &c) { return c.texCoord >= 0 && c.texCoord < texCoordCount; });
+    bool useNormals = std::any_of(corners.begin(), corners.end(),
+        [normalCount](const ObjCorner &c) { return c.normal >= 0 && c.normal < normalCount; });
+
+    data = MeshData();
+    // Without vt/vn the OBJ vertices are the mesh vertices, otherwise every
+    // distinct (v, vt, vn) triple becomes one mesh vertex
+    std::unordered_map<VertexKey, uint32_t, VertexKeyHash> remap;
+    auto vertexOf = [&](const ObjCorner &corner) -> uint32_t {
+        if (!useTexCoords && !useNormals)
+            return static_cast<uint32_t>(corner.position);
+        int64_t texCoord = (corner.texCoord >= 0 && corner.texCoord < texCoordCount) ? corner.texCoord : -1;
+        int64_t normal = (corner.normal >= 0 && corner.normal < normalCount) ? corner.normal : -1;
+        VertexKey key{corner.position, texCoord, normal};
+        auto found = remap.find(key);
+        if (found != remap.end())
+            return found->second;
+        uint32_t vertex = static_cast<uint32_t>(data.positionsX.size());
+        data.positionsX.push_back(positions[3 * corner.position]);
+        data.positionsY.push_back(positions[3 * corner.position + 1]);
+        data.positionsZ.push_back(positions[3 * corner.position + 2]);
+        if (useNormals) {
+            data.normalsX.push_back(normal < 0 ? 0.0f : normals[3 * normal]);
+            data.normalsY.push_back(normal < 0 ? 0.0f : normals[3 * normal + 1]);
+            data.normalsZ.push_back(normal < 0 ? 0.0f : normals[3 * normal + 2]);
+        }
+        if (useTexCoords) {
+            data.texCoordsU.push_back(texCoord < 0 ? 0.0f : texCoords[2 * texCoord]);
+            data.texCoordsV.push_back(texCoord < 0 ? 0.0f : texCoords[2 * texCoord + 1]);
+        }
+        remap.emplace(key, vertex);
+        return vertex;
+    };
+
+    if (!useTexCoords && !useNormals) {
+        data.positionsX.reserve(positionCount);
+        data.positionsY.reserve(positionCount);
+        data.positionsZ.reserve(positionCount);
+        for (int64_t i = 0; i < positionCount; i++) {
+            data.positionsX.push_back(positions[3 * i]);
+            data.positionsY.push_back(positions[3 * i + 1]);
+            data.positionsZ.push_back(positions[3 * i + 2]);
+        }
+    }
+    data.indices.reserve(corners.size() * 3 / 2);
+    size_t first = 0;
+    for (uint32_t faceSize : faceSizes) {
+        for (size_t i = 1; i + 1 < faceSize; i++) {
+            const ObjCorner &c0 = corners[first];
+            const ObjCorner &c1 = corners[first + i];
+            const ObjCorner &c2 = corners[first + i + 1];
+            if (c0.position < 0 || c1.position < 0 || c2.position < 0
+                || c0.position >= positionCount || c1.position >= positionCount
+                || c2.position >= positionCount)
+                continue;
+            data.indices.push_back(vertexOf(c0));
+            data.indices.push_back(vertexOf(c1));
+            data.indices.push_back(vertexOf(c2));
+        }
+        first += faceSize;
+    }
+    return true;
+}
+
+std::string ObjModelLoader::getCachePath(const std::string& path) {
+    size_t dot = path.find_last_of('.');
+    size_t slash = path.find_last_of('/');
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash))
+        return path + ".rtmesh";
+    return path.substr(0, dot) + ".rtmesh";
+}
+
+bool ObjModelLoader::readMeshCache(const std::string& cachePath,
+const std::string& sourcePath, MeshData& data) {
+    struct stat source {};
+    if (!getSourceStat(sourcePath, source))
+        return false;
+    MappedFile file(cachePath);
+    if (!file.isOpen() || file.size() < sizeof(CacheHeader))
+        return false;
+
+    CacheHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (std::memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0
+        || header.sourceSize != static_cast<uint64_t>(source.st_size)
+        || header.sourceModifiedSec != static_cast<int64_t>(source.st_mtim.tv_sec)
+        || header.sourceModifiedNsec != static_cast<int64_t>(source.st_mtim.tv_nsec))
+        return false;
+
+    size_t vertexArrays = 3 + (header.hasNormals ? 3 : 0) + (header.hasTexCoords ? 2 : 0);
+    size_t expected = sizeof(CacheHeader) + header.vertexCount * vertexArrays * sizeof(float)
+        + header.indexCount * sizeof(uint32_t);
+    if (file.size() != expected || header.indexCount % 3 != 0)
+        return false;
+
+    const char *it = file.data() + sizeof(CacheHeader);
+    auto readArray = [&it](std::vector<float> &array, size_t count) {
+        array.resize(count);
+        std::memcpy(array.data(), it, count * sizeof(float));
+        it += count * sizeof(float);
+    };
+    data = MeshData();
+    readArray(data.positionsX, header.vertexCount);
+    readArray(data.positionsY, header.vertexCount);
+    readArray(data.positionsZ, header.vertexCount);
+    if (header.hasNormals) {
+        readArray(data.normalsX, header.vertexCount);
+        readArray(data.normalsY, header.vertexCount);
+        readArray(data.normalsZ, header.vertexCount);
+    }
+    if (header.hasTexCoords) {
+        readArray(data.texCoordsU, header.vertexCount);
+        readArray(data.texCoordsV, header.vertexCount);
+    }
+    data.indices.resize(header.indexCount);
+    std::memcpy(data.indices.data(), it, header.indexCount * sizeof(uint32_t));
+
+    for (uint32_t index : data.indices) {
+        if (index >= header.vertexCount)
+            return false;
+    }
+    return true;
+}
+
+bool ObjModelLoader::writeMeshCache(const std::string& cachePath,
+const std::string& sourcePath, const MeshData& data) {
+    struct stat source {};
+    if (!getSourceStat(sourcePath, source))
+        return false;
+
+    CacheHeader header {};
+    std::memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    header.sourceSize = static_cast<uint64_t>(source.st_size);
+    header.sourceModifiedSec = static_cast<int64_t>(source.st_mtim.tv_sec);
+    header.sourceModifiedNsec = static_cast<int64_t>(source.st_mtim.tv_nsec);
+    header.vertexCount = data.getVertexCount();
+    header.indexCount = data.indices.size();
+    header.hasNormals = data.hasNormals() ? 1 : 0;
+    header.hasTexCoords = data.hasTexCoords() ? 1 : 0;
+
+    // Write next to the final file then rename, so a reader never sees half a cache
+    std::string tempPath = cachePath + ".tmp";
+    std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+    if (!file)
+        return false;
+    auto writeArray = [&file](const auto &array) {
+        file.write(reinterpret_cast<const char *>(array.data()),
+            static_cast<std::streamsize>(array.size() * sizeof(array[0])));
+    };
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    writeArray(data.positionsX);
+    writeArray(data.positionsY);
+    writeArray(data.positionsZ);
+    if (header.hasNormals) {
+        writeArray(data.normalsX);
+        writeArray(data.normalsY);
+        writeArray(data.normalsZ);
+    }
+    if (header.hasTexCoords) {
+        writeArray(data.texCoordsU);
+        writeArray(data.texCoordsV);
+    }
+    writeArray(data.indices);
+    file.close();
+    if (!file || std::rename(tempPath.c_str(), cachePath.c_str()) != 0) {
+        std::remove(tempPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+std::shared_ptr<IPrimitive>
+ObjModelLoader::loadObjModel(const std::string& path, const std::shared_ptr<Material>& material) {
+    MeshData data;
+    std::string cachePath = getCachePath(path);
+
+    if (readMeshCache(cachePath, path, data))
+        return std::make_shared<TriangleMesh>(std::move(data), material);
+    if (!parseObjFile(path, data)) {
+        std::cerr << "Failed to open OBJ file: " << path << std::endl;
+        return std::make_shared<TriangleMesh>(MeshData(), material);
     }
-    return composite;
+    if (!writeMeshCache(cachePath, path, data))
+        std::cerr << "Could not write mesh cache: " << cachePath << std::endl;
+    return std::make_shared<TriangleMesh>(std::move(data), material);
 }
 
 }  // namespace RayTracer
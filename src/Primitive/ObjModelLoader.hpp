@@ -12,14 +12,43 @@
     #include <vector>
     #include <memory>
     #include "Primitive/IPrimitive.hpp"
+    #include "Primitive/TriangleMesh/TriangleMesh.hpp"
     #include "Material/Material.hpp"
 
 namespace RayTracer {
 
 class ObjModelLoader {
 public:
+    /**
+     * @brief Loads an OBJ file as a single triangle mesh
+     * Reads the binary cache next to the file when it is up to date,
+     * otherwise parses the OBJ and writes the cache for the next load
+     */
     static std::shared_ptr<IPrimitive>
     loadObjModel(const std::string& path, const std::shared_ptr<Material>& material);
+
+    /**
+     * @brief Parses an OBJ file (v, vt, vn and f lines) using every core
+     * @return False if the file can not be read
+     */
+    static bool parseObjFile(const std::string& path, MeshData& data);
+
+    /**
+     * @brief Gets the binary mesh cache path of an OBJ file (same name, .rtmesh)
+     */
+    static std::string getCachePath(const std::string& path);
+
+    /**
+     * @brief Loads a mesh cache, rejected if the OBJ size or mtime changed
+     */
+    static bool readMeshCache(const std::string& cachePath,
+        const std::string& sourcePath, MeshData& data);
+
+    /**
+     * @brief Writes a mesh cache stamped with the OBJ size and mtime
+     */
+    static bool writeMeshCache(const std::string& cachePath,
+        const std::string& sourcePath, const MeshData& data);
 };
 
 }  // namespace RayTracer
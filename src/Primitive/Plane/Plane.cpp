@@ -24,6 +24,7 @@ void Plane::translate(const Math::Vector3D &translation) {
 
 void Plane::rotateX(double degrees) {
     rotationX += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateX("x", degrees);
     position = rotateX.applyToPoint(position);
     normal = rotateX.applyToVector(normal).normalize();
@@ -31,6 +32,7 @@ void Plane::rotateX(double degrees) {
 
 void Plane::rotateY(double degrees) {
     rotationY += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateY("y", degrees);
     position = rotateY.applyToPoint(position);
     normal = rotateY.applyToVector(normal).normalize();
@@ -38,43 +40,21 @@ void Plane::rotateY(double degrees) {
 
 void Plane::rotateZ(double degrees) {
     rotationZ += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateZ("z", degrees);
     position = rotateZ.applyToPoint(position);
     normal = rotateZ.applyToVector(normal).normalize();
 }
 
-std::shared_ptr<Material> Plane::getMaterial() const {
+const std::shared_ptr<Material> &Plane::getMaterial() const {
     return material;
 }
 
-std::optional<HitInfo> Plane::hit(const Ray &ray, double tMin,
+std::optional<double> Plane::intersect(const Ray &ray, double tMin,
 double tMax) {
-    Ray transformedRay = ray;
+    Ray transformedRay = transform.toObject(ray);
     Math::Vector3D transformedNormal = normal;
 
-    if (rotationX != 0.0 || rotationY != 0.0 || rotationZ != 0.0) {
-        Math::Point3D newOrigin = ray.origin;
-        Math::Vector3D newDirection = ray.direction;
-
-        if (rotationZ != 0.0) {
-            RayTracer::Rotate rotateZ("z", -rotationZ);
-            newOrigin = rotateZ.applyToPoint(newOrigin);
-            newDirection = rotateZ.applyToVector(newDirection);
-        }
-        if (rotationY != 0.0) {
-            RayTracer::Rotate rotateY("y", -rotationY);
-            newOrigin = rotateY.applyToPoint(newOrigin);
-            newDirection = rotateY.applyToVector(newDirection);
-        }
-        if (rotationX != 0.0) {
-            RayTracer::Rotate rotateX("x", -rotationX);
-            newOrigin = rotateX.applyToPoint(newOrigin);
-            newDirection = rotateX.applyToVector(newDirection);
-        }
-
-        transformedRay = Ray(newOrigin, newDirection);
-    }
-
     double denominator = transformedNormal.dot(transformedRay.direction);
 
     if (std::abs(denominator) < 1e-8)
@@ -85,6 +65,16 @@ double tMax) {
 
     if (t < tMin || t > tMax)
         return std::nullopt;
+    return t;
+}
+
+std::optional<HitInfo> Plane::hit(const Ray &ray, double tMin,
+double tMax) {
+    std::optional<double> distance = intersect(ray, tMin, tMax);
+    if (!distance)
+        return std::nullopt;
+    double denominator = normal.dot(transform.toObject(ray).direction);
+    double t = *distance;
 
     HitInfo info;
     info.distance = t;
@@ -107,22 +97,44 @@ double tMax) {
     Math::Vector3D toPoint = info.hitPoint - position;
     double u = toPoint.dot(tangent1);
     double v = toPoint.dot(tangent2);
-    double uvScale = 0.1;
-    u = std::fmod(u * uvScale, 1.0);
-    v = std::fmod(v * uvScale, 1.0);
+    u = std::fmod(u * UV_SCALE, 1.0);
+    v = std::fmod(v * UV_SCALE, 1.0);
     if (u < 0) u += 1.0;
     if (v < 0) v += 1.0;
 
     info.uv = Math::Vector2D(u, v);
-    info.primitive = std::static_pointer_cast<IPrimitive>(shared_from_this());
+    info.primitive = this;
     return info;
 }
 
+void Plane::hitPacket(const RayPacket &packet, double tMin,
+PacketHit &hits) {
+    // Rotating the plane once is cheaper than bringing every ray to object space
+    Math::Point3D worldPosition = transform.pointToWorld(position);
+    Math::Vector3D worldNormal = transform.normalToWorld(normal);
+
+    for (int lane = 0; lane < packet.count; lane++) {
+        double denominator = worldNormal.X * packet.directionX[lane]
+            + worldNormal.Y * packet.directionY[lane]
+            + worldNormal.Z * packet.directionZ[lane];
+        if (std::abs(denominator) < 1e-8)
+            continue;
+        double t = ((worldPosition.X - packet.originX[lane]) * worldNormal.X
+            + (worldPosition.Y - packet.originY[lane]) * worldNormal.Y
+            + (worldPosition.Z - packet.originZ[lane]) * worldNormal.Z) / denominator;
+        if (t < tMin || t > hits.distance[lane])
+            continue;
+        hits.distance[lane] = t;
+        hits.primitive[lane] = this;
+    }
+}
+
 std::shared_ptr<IPrimitive> Plane::clone() const {
     auto copy = std::make_shared<Plane>(position, normal, material);
     copy->rotationX = rotationX;
     copy->rotationY = rotationY;
     copy->rotationZ = rotationZ;
+    copy->transform = transform;
     copy->setSourceFile(sourceFile);
     return copy;
 }
@@ -151,4 +163,9 @@ void Plane::getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) cons
     mat.add("transparency", libconfig::Setting::TypeFloat) = material->transparency;
     mat.add("refractionIndex", libconfig::Setting::TypeFloat) = material->refractionIndex;
 }
+
+Math::AABB Plane::getBoundingBox() const {
+    return Math::AABB::infinite();
+}
+
 }  // namespace RayTracer
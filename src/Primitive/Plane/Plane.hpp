@@ -12,18 +12,23 @@
     #include <memory>
     #include "Primitive/IPrimitive.hpp"
     #include "Transformation/Rotate/Rotate.hpp"
+    #include "Transformation/ObjectTransform/ObjectTransform.hpp"
     #include <libconfig.h++>
 
 namespace RayTracer {
-class Plane : public IPrimitive, public std::enable_shared_from_this<Plane> {
+class Plane : public IPrimitive {
  private:
     std::shared_ptr<Material> material;
     double rotationX = 0.0;
     double rotationY = 0.0;
     double rotationZ = 0.0;
+    ObjectTransform transform;
     std::string sourceFile = "";
 
  public:
+    // UV units per world unit, the texture repeats every 1 / UV_SCALE
+    static constexpr double UV_SCALE = 0.1;
+
     Math::Point3D position;
     Math::Vector3D normal;
 
@@ -54,11 +59,20 @@ class Plane : public IPrimitive, public std::enable_shared_from_this<Plane> {
     void rotateZ(double degrees) override;
     std::optional<HitInfo> hit(const Ray &ray,
         double tMin, double tMax) override;
-    std::shared_ptr<Material> getMaterial() const override;
+    std::optional<double> intersect(const Ray &ray, double tMin,
+        double tMax) override;
+    void hitPacket(const RayPacket &packet, double tMin,
+        PacketHit &hits) override;
+    const std::shared_ptr<Material> &getMaterial() const override;
     std::shared_ptr<IPrimitive> clone() const override;
     void getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) const override;
 
+    double getUVDensity(const HitInfo &hit) const override {
+        (void)hit;
+        return UV_SCALE;
+    }
     Math::Point3D getPosition() const override { return position; }
+    Math::AABB getBoundingBox() const override;
 };
 }  // namespace RayTracer
 
@@ -44,7 +44,7 @@ double tMin, double tMax) {
     return wrappedPrimitive->hit(ray, tMin, tMax);
 }
 
-std::shared_ptr<Material> PrimitiveDecorator::getMaterial() const {
+const std::shared_ptr<Material> &PrimitiveDecorator::getMaterial() const {
     return wrappedPrimitive->getMaterial();
 }
 
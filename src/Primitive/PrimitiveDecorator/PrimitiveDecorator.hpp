@@ -14,7 +14,7 @@
     #include "Primitive/IPrimitive.hpp"
 
 namespace RayTracer {
-class PrimitiveDecorator : public IPrimitive, public std::enable_shared_from_this<PrimitiveDecorator> {
+class PrimitiveDecorator : public IPrimitive {
  protected:
     std::shared_ptr<IPrimitive> wrappedPrimitive;
 
@@ -30,11 +30,25 @@ class PrimitiveDecorator : public IPrimitive, public std::enable_shared_from_thi
     std::string getSourceFile() const override;
     std::optional<HitInfo> hit(const Ray &ray, double tMin,
         double tMax) override;
-    std::shared_ptr<Material> getMaterial() const override;
+    std::optional<double> intersect(const Ray &ray, double tMin, double tMax) override {
+        return wrappedPrimitive->intersect(ray, tMin, tMax);
+    }
+    std::optional<HitInfo> surfaceAt(const Ray &ray, double tMin, double distance) override {
+        return wrappedPrimitive->surfaceAt(ray, tMin, distance);
+    }
+    bool occluded(const Ray &ray, double tMin, double tMax) override {
+        return wrappedPrimitive->occluded(ray, tMin, tMax);
+    }
+    void prepareView(const PrimaryView &view) override { wrappedPrimitive->prepareView(view); }
+    void tessellateDisplacement() override { wrappedPrimitive->tessellateDisplacement(); }
+    bool hasDisplacedGeometry() const override { return wrappedPrimitive->hasDisplacedGeometry(); }
+    const std::shared_ptr<Material> &getMaterial() const override;
     std::shared_ptr<IPrimitive> clone() const override = 0;
     void getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) const override;
 
+    double getUVDensity(const HitInfo &hit) const override { return wrappedPrimitive->getUVDensity(hit); }
     Math::Point3D getPosition() const override { return wrappedPrimitive->getPosition(); }
+    Math::AABB getBoundingBox() const override { return wrappedPrimitive->getBoundingBox(); }
 };
 }  // namespace RayTracer
 
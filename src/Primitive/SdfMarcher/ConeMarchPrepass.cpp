@@ -0,0 +1,58 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** ConeMarchPrepass implementation
+*/
+#include <algorithm>
+#include <cmath>
+#include "Primitive/SdfMarcher/ConeMarchPrepass.hpp"
+
+namespace RayTracer {
+
+void ConeMarchPrepass::build(const PrimaryView &view,
+const std::function<double(const Ray &, double)> &startDistance) {
+    _view = PrimaryView();
+    if (!view.isValid())
+        return;
+    _tilesX = (view.width + TILE_SIZE - 1) / TILE_SIZE;
+    _tilesY = (view.height + TILE_SIZE - 1) / TILE_SIZE;
+    _starts.assign(_tilesX * _tilesY, 0.0);
+
+    for (int tileY = 0; tileY < _tilesY; tileY++) {
+        for (int tileX = 0; tileX < _tilesX; tileX++) {
+            // Pixels are jittered by up to half a pixel around their center
+            double minX = tileX * TILE_SIZE - 0.5;
+            double minY = tileY * TILE_SIZE - 0.5;
+            double maxX = std::min(minX + TILE_SIZE, view.width - 0.5);
+            double maxY = std::min(minY + TILE_SIZE, view.height - 0.5);
+            Ray center = view.pixelRay((minX + maxX) * 0.5, (minY + maxY) * 0.5);
+
+            double slope = 0.0;
+            for (int corner = 0; corner < 4; corner++) {
+                Ray edge = view.pixelRay(corner & 1 ? maxX : minX, corner & 2 ? maxY : minY);
+                slope = std::max(slope, (edge.direction - center.direction).length());
+            }
+            // Margin for the tile bending once projected on the unit sphere
+            slope *= 1.01;
+            _starts[tileY * _tilesX + tileX] = std::max(0.0, startDistance(center, slope));
+        }
+    }
+    _view = view;
+}
+
+double ConeMarchPrepass::getStartDistance(const Ray &ray) const {
+    double x;
+    double y;
+    if (!_view.isValid() || !_view.pixelOf(ray, x, y))
+        return 0.0;
+    int pixelX = static_cast<int>(std::floor(x + 0.5));
+    int pixelY = static_cast<int>(std::floor(y + 0.5));
+    if (pixelX < 0 || pixelY < 0 || pixelX >= _view.width || pixelY >= _view.height)
+        return 0.0;
+    double start = _starts[(pixelY / TILE_SIZE) * _tilesX + pixelX / TILE_SIZE];
+    return start / ray.direction.length();
+}
+
+}  // namespace RayTracer
@@ -0,0 +1,59 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** ConeMarchPrepass - per tile start distances for primary rays
+*/
+
+#ifndef SRC_PRIMITIVE_SDFMARCHER_CONEMARCHPREPASS_HPP_
+    #define SRC_PRIMITIVE_SDFMARCHER_CONEMARCHPREPASS_HPP_
+    #include <functional>
+    #include <vector>
+    #include "Ray/PrimaryView.hpp"
+    #include "Ray/Ray.hpp"
+
+namespace RayTracer {
+
+/**
+ * @brief Low resolution depth of an implicit surface seen from the camera
+ *
+ * One cone is marched per tile of pixels, wide enough to contain every ray
+ * of the tile including the sub-pixel jitter of progressive sampling. Primary
+ * rays then skip the empty space their tile's cone already crossed.
+ */
+class ConeMarchPrepass {
+ public:
+    static constexpr int TILE_SIZE = 8;
+
+    /**
+     * @brief Marches the cone of every tile of view
+     * @param startDistance Returns how far a cone around the given normalized
+     * ray, of the given radius at unit distance, is free of surface
+     */
+    void build(const PrimaryView &view,
+        const std::function<double(const Ray &, double)> &startDistance);
+
+    // Forgets the distances, e.g. when the surface moved
+    void invalidate() { _view = PrimaryView(); }
+
+    bool isBuiltFor(const PrimaryView &view) const {
+        return _view.isValid() && _view == view;
+    }
+
+    /**
+     * @brief Distance along ray that is known to be free of surface
+     * @return 0 for rays that are not primary rays of the built view
+     */
+    double getStartDistance(const Ray &ray) const;
+
+ private:
+    PrimaryView _view;
+    int _tilesX = 0;
+    int _tilesY = 0;
+    std::vector<double> _starts;
+};
+
+}  // namespace RayTracer
+
+#endif  // SRC_PRIMITIVE_SDFMARCHER_CONEMARCHPREPASS_HPP_
@@ -0,0 +1,46 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** DistanceCache implementation
+*/
+#include "Primitive/SdfMarcher/DistanceCache.hpp"
+
+namespace RayTracer {
+
+DistanceCache &DistanceCache::operator=(const DistanceCache &other) {
+    (void)other;
+    invalidate();
+    return *this;
+}
+
+DistanceCache::~DistanceCache() {
+    invalidate();
+}
+
+void DistanceCache::configure(double radius, double margin, double lipschitz) {
+    constexpr int slots = BRICKS_PER_AXIS * BRICKS_PER_AXIS * BRICKS_PER_AXIS;
+
+    invalidate();
+    _bricks = std::make_unique<std::atomic<Brick *>[]>(slots);
+    for (int i = 0; i < slots; i++)
+        _bricks[i].store(nullptr, std::memory_order_relaxed);
+    _radius = radius;
+    _cellSize = 2.0 * radius / RESOLUTION;
+    _inverseCellSize = 1.0 / _cellSize;
+    _margin = margin;
+    _lipschitz = lipschitz;
+}
+
+void DistanceCache::invalidate() {
+    constexpr int slots = BRICKS_PER_AXIS * BRICKS_PER_AXIS * BRICKS_PER_AXIS;
+
+    if (!_bricks)
+        return;
+    for (int i = 0; i < slots; i++)
+        delete _bricks[i].load(std::memory_order_relaxed);
+    _bricks.reset();
+}
+
+}  // namespace RayTracer
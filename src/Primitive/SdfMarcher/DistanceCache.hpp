@@ -0,0 +1,173 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** DistanceCache - sparse bricks of sampled distances around an implicit shape
+*/
+
+#ifndef SRC_PRIMITIVE_SDFMARCHER_DISTANCECACHE_HPP_
+    #define SRC_PRIMITIVE_SDFMARCHER_DISTANCECACHE_HPP_
+    #include <algorithm>
+    #include <array>
+    #include <atomic>
+    #include <cmath>
+    #include <limits>
+    #include <memory>
+    #include "Math/Point3D/Point3D.hpp"
+    #include "Primitive/SdfMarcher/SdfMarcher.hpp"
+
+namespace RayTracer {
+
+/**
+ * @brief Distance estimates sampled on a grid, to step through empty space
+ *
+ * The grid covers the cube of half size radius around the origin and is cut
+ * into bricks of BRICK_SIZE^3 cells. A brick is sampled by the first ray
+ * that needs it, so render threads fill the cache in parallel and only
+ * around what they actually look at.
+ * A point gets the best bound its cell corners give: each sample minus
+ * lipschitz times the distance to its corner, so a feature smaller than a
+ * cell cannot hide between the corners. Within margin of the surface
+ * nothing is reported, the marcher needs the exact estimate there to find
+ * the hit.
+ */
+class DistanceCache {
+ public:
+    // Cells per axis across the cube
+    static constexpr int RESOLUTION = 64;
+    // Cells per axis of a brick
+    static constexpr int BRICK_SIZE = 8;
+
+    DistanceCache() = default;
+    // Copies start empty, the samples belong to the shape that took them
+    DistanceCache(const DistanceCache &other) { (void)other; }
+    DistanceCache &operator=(const DistanceCache &other);
+    ~DistanceCache();
+
+    /**
+     * @brief Covers the cube of half size radius, dropping every sample
+     * Not thread safe, call it before rendering starts
+     * @param lipschitz Upper bound of the gradient norm of the sampled estimate
+     */
+    void configure(double radius, double margin, double lipschitz = 1.0);
+
+    // Drops the samples and the cube, e.g. when the shape changed
+    void invalidate();
+
+    bool isConfiguredFor(double radius, double margin, double lipschitz = 1.0) const {
+        return _bricks && _radius == radius && _margin == margin && _lipschitz == lipschitz;
+    }
+
+    /**
+     * @brief Cached distance estimate at point
+     * @param sample Callable filling distances from (points, count, distances)
+     * with count <= SdfMarcher::MAX_LANES, used to fill a missing brick
+     * @return false when point is outside the cube or within margin of the
+     * surface, the caller then evaluates the estimate itself
+     */
+    template <typename SampleN>
+    bool lookup(const Math::Point3D &point, SampleN &&sample, double &distance) {
+        if (!_bricks)
+            return false;
+        int index[3];
+        // Position inside the cell, in cells
+        double inside[3];
+        const double coords[3] = {point.X, point.Y, point.Z};
+        for (int axis = 0; axis < 3; axis++) {
+            double cell = (coords[axis] + _radius) * _inverseCellSize;
+            if (!(cell >= 0.0 && cell < RESOLUTION))
+                return false;
+            index[axis] = static_cast<int>(cell);
+            inside[axis] = cell - index[axis];
+        }
+        int slot = brickSlot(index[0] / BRICK_SIZE, index[1] / BRICK_SIZE, index[2] / BRICK_SIZE);
+        const Brick *brick = _bricks[slot].load(std::memory_order_acquire);
+        if (!brick)
+            brick = fill(slot, sample);
+        const float *corner = brick->data() + sampleSlot(index[0] % BRICK_SIZE,
+            index[1] % BRICK_SIZE, index[2] % BRICK_SIZE);
+        double best = -std::numeric_limits<double>::infinity();
+        for (int i = 0; i < 8; i++) {
+            int cx = i >> 2;
+            int cy = (i >> 1) & 1;
+            int cz = i & 1;
+            double dx = inside[0] - cx;
+            double dy = inside[1] - cy;
+            double dz = inside[2] - cz;
+            double toCorner = std::sqrt(dx * dx + dy * dy + dz * dz) * _cellSize;
+            double sampled = corner[sampleSlot(cx, cy, cz)];
+            best = std::max(best, sampled - _lipschitz * toCorner);
+        }
+        distance = best;
+        return distance > _margin;
+    }
+
+ private:
+    // Samples per axis of a brick, one more than its cells
+    static constexpr int SAMPLES = BRICK_SIZE + 1;
+    static constexpr int BRICKS_PER_AXIS = RESOLUTION / BRICK_SIZE;
+
+    using Brick = std::array<float, SAMPLES * SAMPLES * SAMPLES>;
+
+    static int brickSlot(int x, int y, int z) {
+        return (x * BRICKS_PER_AXIS + y) * BRICKS_PER_AXIS + z;
+    }
+
+    static int sampleSlot(int x, int y, int z) {
+        return (x * SAMPLES + y) * SAMPLES + z;
+    }
+
+    // Stored values are rounded down so they never exceed the samples
+    static float roundDown(double value) {
+        float stored = static_cast<float>(value);
+        if (static_cast<double>(stored) > value)
+            stored = std::nextafter(stored, -std::numeric_limits<float>::infinity());
+        return stored;
+    }
+
+    template <typename SampleN>
+    const Brick *fill(int slot, SampleN &&sample) {
+        auto brick = std::make_unique<Brick>();
+        int bx = slot / (BRICKS_PER_AXIS * BRICKS_PER_AXIS) * BRICK_SIZE;
+        int by = slot / BRICKS_PER_AXIS % BRICKS_PER_AXIS * BRICK_SIZE;
+        int bz = slot % BRICKS_PER_AXIS * BRICK_SIZE;
+        const int size = static_cast<int>(brick->size());
+        Math::Point3D points[SdfMarcher::MAX_LANES];
+        double distances[SdfMarcher::MAX_LANES];
+        int count = 0;
+        int first = 0;
+
+        for (int i = 0; i < size; i++) {
+            int x = bx + i / (SAMPLES * SAMPLES);
+            int y = by + i / SAMPLES % SAMPLES;
+            int z = bz + i % SAMPLES;
+            points[count++] = Math::Point3D(Math::Coords{x * _cellSize - _radius,
+                y * _cellSize - _radius, z * _cellSize - _radius});
+            if (count < SdfMarcher::MAX_LANES && i + 1 < size)
+                continue;
+            sample(points, count, distances);
+            for (int k = 0; k < count; k++)
+                (*brick)[first + k] = roundDown(distances[k]);
+            first += count;
+            count = 0;
+        }
+        // Another thread may have filled the same brick meanwhile, keep theirs
+        Brick *expected = nullptr;
+        if (_bricks[slot].compare_exchange_strong(expected, brick.get(),
+            std::memory_order_acq_rel, std::memory_order_acquire))
+            return brick.release();
+        return expected;
+    }
+
+    std::unique_ptr<std::atomic<Brick *>[]> _bricks;
+    double _radius = 0.0;
+    double _cellSize = 0.0;
+    double _inverseCellSize = 0.0;
+    double _margin = 0.0;
+    double _lipschitz = 1.0;
+};
+
+}  // namespace RayTracer
+
+#endif  // SRC_PRIMITIVE_SDFMARCHER_DISTANCECACHE_HPP_
@@ -0,0 +1,200 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** SdfMarcher - sphere tracing shared by the implicit primitives
+*/
+
+#ifndef SRC_PRIMITIVE_SDFMARCHER_SDFMARCHER_HPP_
+    #define SRC_PRIMITIVE_SDFMARCHER_SDFMARCHER_HPP_
+    #include <algorithm>
+    #include <cmath>
+    #include <optional>
+    #include "Ray/Ray.hpp"
+    #include "Ray/RayPacket.hpp"
+
+namespace RayTracer {
+
+/**
+ * @brief Per-shape tuning of the sphere tracer
+ */
+struct SdfMarchSettings {
+    // Evaluations allowed per ray, bounds the cost of a miss
+    int maxSteps = 256;
+    // Distance to the surface considered a hit, in world units
+    double epsilon = 1e-4;
+    // Upper bound of the gradient norm, distances are divided by it
+    double lipschitz = 1.0;
+    // Over-relaxation factor in [1, 2), 1 is plain sphere tracing
+    double relaxation = 1.2;
+    // Smallest step, keeps estimators clamped above zero moving forward
+    double minStep = 0.0;
+};
+
+/**
+ * @brief Result of a march: the hit distance and the evaluations it took
+ */
+struct SdfMarchHit {
+    double t;
+    int steps;
+};
+
+/**
+ * @brief Enhanced sphere tracing over a distance bound
+ *
+ * Steps are over-relaxed while consecutive unbounding spheres keep
+ * overlapping; as soon as they do not, the marcher steps back to the last
+ * safe position and takes one plain step from there, so no surface can be
+ * skipped.
+ * A hit is reported when the bound falls below epsilon or below half the
+ * ray cone width at that distance, whichever is larger. Only camera rays
+ * carry a cone (Ray::spread), the others are marched down to epsilon.
+ */
+class SdfMarcher {
+ public:
+    // Most rays marchN takes at once
+    static constexpr int MAX_LANES = RayPacket::SIZE;
+
+    explicit SdfMarcher(const SdfMarchSettings &settings = SdfMarchSettings())
+        : _settings(settings) {}
+
+    const SdfMarchSettings &getSettings() const { return _settings; }
+
+    /**
+     * @brief Marches ray on [tMin, tMax]
+     * @param distance Callable returning the signed distance estimate at a point
+     * @return The first hit, or nullopt when the range or the step budget ran out
+     */
+    template <typename Distance>
+    std::optional<SdfMarchHit> march(const Ray &ray, double tMin, double tMax,
+        Distance &&distance) const {
+        Lane lane = startLane(ray, tMin, tMax);
+
+        if (tMin > tMax)
+            return std::nullopt;
+        while (lane.steps < _settings.maxSteps) {
+            Step step = advance(lane, distance(ray.at(lane.t)));
+            if (step == Step::Hit)
+                return SdfMarchHit{lane.t, lane.steps};
+            if (step == Step::Miss)
+                break;
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief march() of count rays at once, count <= MAX_LANES
+     * Every lane takes the same steps as march() would; the rays still
+     * running are gathered so each evaluation covers them all in one call.
+     * @param distanceN Callable filling distances from (points, count, distances)
+     * @param hits Receives the result of each ray
+     */
+    template <typename DistanceN>
+    void marchN(const Ray *rays, const double *tMin, const double *tMax, int count,
+        DistanceN &&distanceN, std::optional<SdfMarchHit> *hits) const {
+        Lane lanes[MAX_LANES];
+        int running[MAX_LANES];
+        int runningCount = 0;
+        Math::Point3D points[MAX_LANES];
+        double distances[MAX_LANES];
+
+        for (int i = 0; i < count; i++) {
+            hits[i] = std::nullopt;
+            lanes[i] = startLane(rays[i], tMin[i], tMax[i]);
+            if (tMin[i] <= tMax[i] && _settings.maxSteps > 0)
+                running[runningCount++] = i;
+        }
+        while (runningCount > 0) {
+            for (int k = 0; k < runningCount; k++)
+                points[k] = rays[running[k]].at(lanes[running[k]].t);
+            distanceN(points, runningCount, distances);
+            int kept = 0;
+            for (int k = 0; k < runningCount; k++) {
+                Lane &lane = lanes[running[k]];
+                Step step = advance(lane, distances[k]);
+                if (step == Step::Hit)
+                    hits[running[k]] = SdfMarchHit{lane.t, lane.steps};
+                else if (step == Step::Continue && lane.steps < _settings.maxSteps)
+                    running[kept++] = running[k];
+            }
+            runningCount = kept;
+        }
+    }
+
+    /**
+     * @brief Marches a cone around ray until it touches the surface
+     * Every ray leaving the same origin within slope * t of ray at distance t
+     * is guaranteed to meet nothing before the returned distance, so it can
+     * start marching there.
+     * @param slope Radius of the cone at unit distance
+     * @return The distance reached, tMin if the cone was already touching
+     */
+    template <typename Distance>
+    double coneMarch(const Ray &ray, double tMin, double tMax, double slope,
+        Distance &&distance) const {
+        double inverseLipschitz = 1.0 / _settings.lipschitz;
+        double t = tMin;
+
+        for (int step = 0; step < _settings.maxSteps && t < tMax; step++) {
+            double radius = std::abs(distance(ray.at(t))) * inverseLipschitz;
+            double clearance = radius - slope * t;
+            if (clearance < _settings.epsilon)
+                break;
+            // Keeps the points swept by every ray of the cone inside the sphere
+            t += clearance / (1.0 + slope);
+        }
+        return std::min(t, tMax);
+    }
+
+ private:
+    enum class Step { Continue, Hit, Miss };
+
+    // Progress of one ray, shared by march() and marchN()
+    struct Lane {
+        double t = 0.0;
+        double tMax = 0.0;
+        double previousRadius = 0.0;
+        double stepLength = 0.0;
+        double omega = 1.0;
+        // Accepted distance per unit of t, half the cone of the ray
+        double footprint = 0.0;
+        int steps = 0;
+    };
+
+    Lane startLane(const Ray &ray, double tMin, double tMax) const {
+        Lane lane;
+        lane.t = tMin;
+        lane.tMax = tMax;
+        lane.omega = _settings.relaxation;
+        lane.footprint = 0.5 * std::max(0.0, ray.spread);
+        return lane;
+    }
+
+    // Takes one step of lane given the distance estimate at lane.t
+    Step advance(Lane &lane, double distance) const {
+        double radius = std::abs(distance) * (1.0 / _settings.lipschitz);
+
+        lane.steps++;
+        // Spheres stopped overlapping: the relaxed step may have crossed
+        if (lane.omega > 1.0 && radius + lane.previousRadius < lane.stepLength) {
+            lane.t += lane.previousRadius - lane.stepLength;
+            lane.stepLength = lane.previousRadius;
+            lane.omega = 1.0;
+            return Step::Continue;
+        }
+        if (radius < std::max(_settings.epsilon, lane.footprint * lane.t))
+            return Step::Hit;
+        lane.previousRadius = radius;
+        lane.stepLength = std::max(radius * lane.omega, _settings.minStep);
+        lane.omega = _settings.relaxation;
+        lane.t += lane.stepLength;
+        return lane.t > lane.tMax ? Step::Miss : Step::Continue;
+    }
+
+    SdfMarchSettings _settings;
+};
+
+}  // namespace RayTracer
+
+#endif  // SRC_PRIMITIVE_SDFMARCHER_SDFMARCHER_HPP_
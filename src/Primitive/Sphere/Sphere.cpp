@@ -5,6 +5,9 @@
 ** File description:
 ** Sphere implementation
 */
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#endif
 #include "Primitive/Sphere/Sphere.hpp"
 #include <cmath>
 #include <memory>
@@ -28,6 +31,7 @@ void Sphere::translate(const Math::Vector3D &translation) {
 
 void Sphere::rotateX(double degrees) {
     rotationX += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
 
     RayTracer::Rotate rotateX("x", degrees);
     center = rotateX.applyToPoint(center);
@@ -35,6 +39,7 @@ void Sphere::rotateX(double degrees) {
 
 void Sphere::rotateY(double degrees) {
     rotationY += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
 
     RayTracer::Rotate rotateY("y", degrees);
     center = rotateY.applyToPoint(center);
@@ -42,41 +47,19 @@ void Sphere::rotateY(double degrees) {
 
 void Sphere::rotateZ(double degrees) {
     rotationZ += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
 
     RayTracer::Rotate rotateZ("z", degrees);
     center = rotateZ.applyToPoint(center);
 }
 
-std::shared_ptr<Material> Sphere::getMaterial() const {
+const std::shared_ptr<Material> &Sphere::getMaterial() const {
     return material;
 }
 
-std::optional<HitInfo> Sphere::hit(const Ray &ray, double tMin,
+std::optional<double> Sphere::intersect(const Ray &ray, double tMin,
 double tMax) {
-    Ray transformedRay = ray;
-
-    if (rotationX != 0.0 || rotationY != 0.0 || rotationZ != 0.0) {
-        Math::Point3D newOrigin = ray.origin;
-        Math::Vector3D newDirection = ray.direction;
-
-        if (rotationZ != 0.0) {
-            RayTracer::Rotate rotateZ("z", -rotationZ);
-            newOrigin = rotateZ.applyToPoint(newOrigin);
-            newDirection = rotateZ.applyToVector(newDirection);
-        }
-        if (rotationY != 0.0) {
-            RayTracer::Rotate rotateY("y", -rotationY);
-            newOrigin = rotateY.applyToPoint(newOrigin);
-            newDirection = rotateY.applyToVector(newDirection);
-        }
-        if (rotationX != 0.0) {
-            RayTracer::Rotate rotateX("x", -rotationX);
-            newOrigin = rotateX.applyToPoint(newOrigin);
-            newDirection = rotateX.applyToVector(newDirection);
-        }
-
-        transformedRay = Ray(newOrigin, newDirection);
-    }
+    Ray transformedRay = transform.toObject(ray);
 
     Math::Vector3D oc = transformedRay.origin - center;
     double a = transformedRay.direction.dot(transformedRay.direction);
@@ -94,6 +77,16 @@ double tMax) {
         if (root < tMin || tMax < root)
             return std::nullopt;
     }
+    return root;
+}
+
+std::optional<HitInfo> Sphere::hit(const Ray &ray, double tMin,
+double tMax) {
+    std::optional<double> distance = intersect(ray, tMin, tMax);
+    if (!distance)
+        return std::nullopt;
+    Ray transformedRay = transform.toObject(ray);
+    double root = *distance;
 
     HitInfo info;
     info.distance = root;
@@ -102,39 +95,100 @@ double tMax) {
     Math::Point3D hitPoint = transformedRay.at(root);
     Math::Vector3D normal = (hitPoint - center) / radius;
 
-    if (rotationX != 0.0 || rotationY != 0.0 || rotationZ != 0.0) {
-        if (rotationX != 0.0) {
-            RayTracer::Rotate rotateX("x", rotationX);
-            normal = rotateX.applyToVector(normal);
-        }
-        if (rotationY != 0.0) {
-            RayTracer::Rotate rotateY("y", rotationY);
-            normal = rotateY.applyToVector(normal);
-        }
-        if (rotationZ != 0.0) {
-            RayTracer::Rotate rotateZ("z", rotationZ);
-            normal = rotateZ.applyToVector(normal);
-        }
-    }
+    normal = transform.normalToWorld(normal);
     Math::Vector3D normalizedPoint = normal.normalize();
     double u = 0.5 + std::atan2(normalizedPoint.Z, normalizedPoint.X) / (2.0 * M_PI);
     double v = 0.5 - std::asin(normalizedPoint.Y) / M_PI;
     info.uv = Math::Vector2D(u, v);
 
     info.normal = normal;
-    std::shared_ptr<Sphere> sphereCopy = std::make_shared<Sphere>(center, radius, material);
-    sphereCopy->rotationX = rotationX;
-    sphereCopy->rotationY = rotationY;
-    sphereCopy->rotationZ = rotationZ;
-    info.primitive = std::static_pointer_cast<IPrimitive>(shared_from_this());
+    info.primitive = this;
     return info;
 }
 
+void Sphere::hitPacket(const RayPacket &packet, double tMin,
+PacketHit &hits) {
+    // The rotations only move the center, so the kernel runs in world space
+    Math::Point3D worldCenter = transform.pointToWorld(center);
+    const double radiusSquared = radius * radius;
+    int lane = 0;
+
+#if defined(__AVX2__)
+    const __m256d centerX = _mm256_set1_pd(worldCenter.X);
+    const __m256d centerY = _mm256_set1_pd(worldCenter.Y);
+    const __m256d centerZ = _mm256_set1_pd(worldCenter.Z);
+    const __m256d lowerBound = _mm256_set1_pd(tMin);
+    const __m256d zero = _mm256_setzero_pd();
+
+    for (; lane + 4 <= packet.count; lane += 4) {
+        __m256d dx = _mm256_load_pd(packet.directionX + lane);
+        __m256d dy = _mm256_load_pd(packet.directionY + lane);
+        __m256d dz = _mm256_load_pd(packet.directionZ + lane);
+        __m256d ocx = _mm256_sub_pd(_mm256_load_pd(packet.originX + lane), centerX);
+        __m256d ocy = _mm256_sub_pd(_mm256_load_pd(packet.originY + lane), centerY);
+        __m256d ocz = _mm256_sub_pd(_mm256_load_pd(packet.originZ + lane), centerZ);
+        __m256d a = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(dx, dx),
+            _mm256_mul_pd(dy, dy)), _mm256_mul_pd(dz, dz));
+        __m256d halfB = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(ocx, dx),
+            _mm256_mul_pd(ocy, dy)), _mm256_mul_pd(ocz, dz));
+        __m256d c = _mm256_sub_pd(_mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(ocx, ocx),
+            _mm256_mul_pd(ocy, ocy)), _mm256_mul_pd(ocz, ocz)), _mm256_set1_pd(radiusSquared));
+        __m256d discriminant = _mm256_sub_pd(_mm256_mul_pd(halfB, halfB), _mm256_mul_pd(a, c));
+        __m256d hasRoots = _mm256_cmp_pd(discriminant, zero, _CMP_GE_OQ);
+        if (_mm256_movemask_pd(hasRoots) == 0)
+            continue;
+        __m256d sqrtd = _mm256_sqrt_pd(_mm256_max_pd(discriminant, zero));
+        __m256d nearRoot = _mm256_div_pd(_mm256_sub_pd(_mm256_sub_pd(zero, halfB), sqrtd), a);
+        __m256d farRoot = _mm256_div_pd(_mm256_add_pd(_mm256_sub_pd(zero, halfB), sqrtd), a);
+        __m256d closest = _mm256_load_pd(hits.distance + lane);
+        __m256d nearValid = _mm256_and_pd(_mm256_cmp_pd(nearRoot, lowerBound, _CMP_GE_OQ),
+            _mm256_cmp_pd(nearRoot, closest, _CMP_LE_OQ));
+        __m256d farValid = _mm256_and_pd(_mm256_cmp_pd(farRoot, lowerBound, _CMP_GE_OQ),
+            _mm256_cmp_pd(farRoot, closest, _CMP_LE_OQ));
+        __m256d root = _mm256_blendv_pd(farRoot, nearRoot, nearValid);
+        __m256d valid = _mm256_and_pd(hasRoots, _mm256_or_pd(nearValid, farValid));
+        int mask = _mm256_movemask_pd(valid);
+        if (mask == 0)
+            continue;
+        _mm256_store_pd(hits.distance + lane, _mm256_blendv_pd(closest, root, valid));
+        for (int i = 0; i < 4; i++) {
+            if (mask & (1 << i))
+                hits.primitive[lane + i] = this;
+        }
+    }
+#endif
+    for (; lane < packet.count; lane++) {
+        double ocx = packet.originX[lane] - worldCenter.X;
+        double ocy = packet.originY[lane] - worldCenter.Y;
+        double ocz = packet.originZ[lane] - worldCenter.Z;
+        double dx = packet.directionX[lane];
+        double dy = packet.directionY[lane];
+        double dz = packet.directionZ[lane];
+        double a = dx * dx + dy * dy + dz * dz;
+        double halfB = ocx * dx + ocy * dy + ocz * dz;
+        double c = ocx * ocx + ocy * ocy + ocz * ocz - radiusSquared;
+        double discriminant = halfB * halfB - a * c;
+
+        if (discriminant < 0)
+            continue;
+        double sqrtd = std::sqrt(discriminant);
+        double root = (-halfB - sqrtd) / a;
+        if (root < tMin || hits.distance[lane] < root) {
+            root = (-halfB + sqrtd) / a;
+            if (root < tMin || hits.distance[lane] < root)
+                continue;
+        }
+        hits.distance[lane] = root;
+        hits.primitive[lane] = this;
+    }
+}
+
 std::shared_ptr<IPrimitive> Sphere::clone() const {
     auto copy = std::make_shared<Sphere>(center, radius, material);
     copy->rotationX = rotationX;
     copy->rotationY = rotationY;
     copy->rotationZ = rotationZ;
+    copy->transform = transform;
     copy->setSourceFile(sourceFile);
     return copy;
 }
@@ -160,4 +214,9 @@ void Sphere::getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) con
     mat.add("transparency", libconfig::Setting::TypeFloat) = material->transparency;
     mat.add("refractionIndex", libconfig::Setting::TypeFloat) = material->refractionIndex;
 }
+
+Math::AABB Sphere::getBoundingBox() const {
+    return transform.boxToWorld(Math::AABB(center, center)).inflated(radius);
+}
+
 }  // namespace RayTracer
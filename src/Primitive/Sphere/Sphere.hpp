@@ -8,19 +8,22 @@
 
 #ifndef SRC_PRIMITIVE_SPHERE_SPHERE_HPP_
     #define SRC_PRIMITIVE_SPHERE_SPHERE_HPP_
+    #include <cmath>
     #include <string>
     #include <memory>
     #include "Primitive/IPrimitive.hpp"
     #include "Transformation/Rotate/Rotate.hpp"
+    #include "Transformation/ObjectTransform/ObjectTransform.hpp"
     #include <libconfig.h++>
 
 namespace RayTracer {
-class Sphere : public IPrimitive, public std::enable_shared_from_this<Sphere> {
+class Sphere : public IPrimitive {
  private:
     std::shared_ptr<Material> material;
     double rotationX = 0.0;
     double rotationY = 0.0;
     double rotationZ = 0.0;
+    ObjectTransform transform;
     std::string sourceFile = "";
 
  public:
@@ -54,11 +57,21 @@ class Sphere : public IPrimitive, public std::enable_shared_from_this<Sphere> {
     void rotateZ(double degrees) override;
     std::optional<HitInfo> hit(const Ray &ray, double tMin,
         double tMax) override;
-    std::shared_ptr<Material> getMaterial() const override;
+    std::optional<double> intersect(const Ray &ray, double tMin,
+        double tMax) override;
+    void hitPacket(const RayPacket &packet, double tMin,
+        PacketHit &hits) override;
+    const std::shared_ptr<Material> &getMaterial() const override;
     std::shared_ptr<IPrimitive> clone() const override;
     void getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) const override;
 
+    // v covers half a great circle, the densest direction
+    double getUVDensity(const HitInfo &hit) const override {
+        (void)hit;
+        return radius > 0.0 ? 1.0 / (M_PI * radius) : 0.0;
+    }
     Math::Point3D getPosition() const override { return center; }
+    Math::AABB getBoundingBox() const override;
 };
 }  // namespace RayTracer
 
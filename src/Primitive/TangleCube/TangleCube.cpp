@@ -20,6 +20,7 @@ void TangleCube::translate(const Math::Vector3D &translation) {
 
 void TangleCube::rotateX(double degrees) {
     rotationX += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateX("x", degrees);
     center = rotateX.applyToPoint(center);
     axis = rotateX.applyToVector(axis).normalize();
@@ -27,6 +28,7 @@ void TangleCube::rotateX(double degrees) {
 
 void TangleCube::rotateY(double degrees) {
     rotationY += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateY("y", degrees);
     center = rotateY.applyToPoint(center);
     axis = rotateY.applyToVector(axis).normalize();
@@ -34,42 +36,20 @@ void TangleCube::rotateY(double degrees) {
 
 void TangleCube::rotateZ(double degrees) {
     rotationZ += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateZ("z", degrees);
     center = rotateZ.applyToPoint(center);
     axis = rotateZ.applyToVector(axis).normalize();
 }
 
-std::shared_ptr<Material> TangleCube::getMaterial() const {
+const std::shared_ptr<Material> &TangleCube::getMaterial() const {
     return material;
 }
 
 std::optional<HitInfo> TangleCube::hit(const Ray &ray, double tMin, double tMax) {
-    Ray transformedRay = ray;
-    if (rotationX != 0.0 || rotationY != 0.0 || rotationZ != 0.0) {
-        Math::Point3D newOrigin = ray.origin;
-        Math::Vector3D newDirection = ray.direction;
-
-        if (rotationZ != 0.0) {
-            RayTracer::Rotate rotateZ("z", -rotationZ);
-            newOrigin = rotateZ.applyToPoint(newOrigin);
-            newDirection = rotateZ.applyToVector(newDirection);
-        }
-        if (rotationY != 0.0) {
-            RayTracer::Rotate rotateY("y", -rotationY);
-            newOrigin = rotateY.applyToPoint(newOrigin);
-            newDirection = rotateY.applyToVector(newDirection);
-        }
-        if (rotationX != 0.0) {
-            RayTracer::Rotate rotateX("x", -rotationX);
-            newOrigin = rotateX.applyToPoint(newOrigin);
-            newDirection = rotateX.applyToVector(newDirection);
-        }
-
-        transformedRay = Ray(newOrigin, newDirection);
-    }
+    Ray transformedRay = transform.toObject(ray);
     const int MAX_STEPS = 512;
     const double EPSILON = 0.00005;
-    const double MAX_DIST = 20.0;
 
     auto tangleCubeSDF = [this](const Math::Vector3D& p) -> double {
         double scale = 1.5 / size;
@@ -132,97 +112,32 @@ std::optional<HitInfo> TangleCube::hit(const Ray &ray, double tMin, double tMax)
     tMin = std::max(tMin, tmin);
     tMax = std::min(tMax, tmax);
 
-    double t = tMin;
-    const int BINARY_STEPS = 32;
-    bool hit_found = false;
-    double closest_t = tMax;
-
-    double prev_sdf = tangleCubeSDF(transformedRay.origin + transformedRay.direction * t - center);
-    for (int i = 0; i < MAX_STEPS && t < tMax; i++) {
-        double curr_t = t + i * (tMax - tMin) / MAX_STEPS;
-        Math::Vector3D p = transformedRay.origin + transformedRay.direction * curr_t - center;
-        double curr_sdf = tangleCubeSDF(p);
-        if (prev_sdf * curr_sdf < 0) {
-            double t_low = curr_t - (tMax - tMin) / MAX_STEPS;
-            double t_high = curr_t;
-            double mid_sdf;
-            for (int j = 0; j < BINARY_STEPS; j++) {
-                double t_mid = (t_low + t_high) * 0.5;
-                Math::Vector3D mid_p = transformedRay.origin + transformedRay.direction * t_mid - center;
-                mid_sdf = tangleCubeSDF(mid_p);
-
-                if (std::abs(mid_sdf) < EPSILON) {
-                    hit_found = true;
-                    closest_t = t_mid;
-                    break;
-                }
-
-                if (prev_sdf * mid_sdf < 0) {
-                    t_high = t_mid;
-                } else {
-                    t_low = t_mid;
-                    prev_sdf = mid_sdf;
-                }
-            }
-
-            if (!hit_found) {
-                closest_t = (t_low + t_high) * 0.5;
-                hit_found = true;
-            }
-
-            break;
-        }
-
-        prev_sdf = curr_sdf;
-    }
-    if (!hit_found) {
-        t = tMin;
-        double min_step = EPSILON * 5.0;
-        for (int i = 0; i < MAX_STEPS && t < tMax; i++) {
-            Math::Vector3D p = transformedRay.origin + transformedRay.direction * t - center;
-            double d = tangleCubeSDF(p);
-            if (std::abs(d) < EPSILON) {
-                hit_found = true;
-                closest_t = t;
-                break;
-            }
-
-            double step = std::abs(d) * 0.25;
-            step = std::max(step, min_step);
-            step = std::min(step, (tMax - t) * 0.5);
-
-            t += step;
-        }
-    }
-
-    if (!hit_found) {
+    SdfMarchSettings settings;
+    settings.maxSteps = MAX_STEPS;
+    settings.epsilon = EPSILON * size;
+    // Inside the bounding box the scaled coordinates stay below 2.4, where the
+    // gradient of the blended quartic is at most 54 per scaled unit
+    settings.lipschitz = 54.0 * 1.5 / size;
+    auto march = SdfMarcher(settings).march(transformedRay, tMin, tMax,
+        [this, &tangleCubeSDF](const Math::Point3D &p) {
+            return tangleCubeSDF(p - center);
+        });
+    if (!march) {
         return std::nullopt;
     }
+    double closest_t = march->t;
 
     Math::Point3D hitPoint = transformedRay.origin + transformedRay.direction * closest_t;
     Math::Vector3D rel_hit = hitPoint - center;
     Math::Vector3D final_normal = calculateNormal(rel_hit);
 
-    if (rotationX != 0.0 || rotationY != 0.0 || rotationZ != 0.0) {
-        if (rotationX != 0.0) {
-            RayTracer::Rotate rotateX("x", rotationX);
-            final_normal = rotateX.applyToVector(final_normal);
-        }
-        if (rotationY != 0.0) {
-            RayTracer::Rotate rotateY("y", rotationY);
-            final_normal = rotateY.applyToVector(final_normal);
-        }
-        if (rotationZ != 0.0) {
-            RayTracer::Rotate rotateZ("z", rotationZ);
-            final_normal = rotateZ.applyToVector(final_normal);
-        }
-    }
+    final_normal = transform.normalToWorld(final_normal);
 
     HitInfo info;
     info.distance = closest_t;
     info.hitPoint = ray.origin + ray.direction * closest_t;
     info.normal = final_normal.normalize();
-    info.primitive = shared_from_this();
+    info.primitive = this;
     return info;
 }
 
@@ -232,6 +147,7 @@ std::shared_ptr<IPrimitive> TangleCube::clone() const {
     copy->rotationX = rotationX;
     copy->rotationY = rotationY;
     copy->rotationZ = rotationZ;
+    copy->transform = transform;
     return copy;
 }
 
@@ -269,4 +185,12 @@ void TangleCube::getLibConfigParams(std::shared_ptr<libconfig::Setting> setting)
     mat.add("transparency", libconfig::Setting::TypeFloat) = material->transparency;
     mat.add("refractionIndex", libconfig::Setting::TypeFloat) = material->refractionIndex;
 }
+
+Math::AABB TangleCube::getBoundingBox() const {
+    double boundingSize = size * 1.6;
+    Math::AABB bounds = Math::AABB(center, center).inflated(boundingSize);
+
+    return transform.boxToWorld(bounds);
+}
+
 }  // namespace RayTracer
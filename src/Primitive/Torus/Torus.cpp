@@ -10,6 +10,7 @@
 #include <memory>
 #include <algorithm>
 #include "Primitive/Torus/Torus.hpp"
+#include "Math/Polynomial/Polynomial.hpp"
 
 namespace RayTracer {
 
@@ -29,6 +30,7 @@ void Torus::translate(const Math::Vector3D &translation) {
 
 void Torus::rotateX(double degrees) {
     rotationX += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateX("x", degrees);
     center = rotateX.applyToPoint(center);
     axis = rotateX.applyToVector(axis).normalize();
@@ -36,6 +38,7 @@ void Torus::rotateX(double degrees) {
 
 void Torus::rotateY(double degrees) {
     rotationY += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateY("y", degrees);
     center = rotateY.applyToPoint(center);
     axis = rotateY.applyToVector(axis).normalize();
@@ -43,12 +46,13 @@ void Torus::rotateY(double degrees) {
 
 void Torus::rotateZ(double degrees) {
     rotationZ += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
     RayTracer::Rotate rotateZ("z", degrees);
     center = rotateZ.applyToPoint(center);
     axis = rotateZ.applyToVector(axis).normalize();
 }
 
-std::shared_ptr<Material> Torus::getMaterial() const {
+const std::shared_ptr<Material> &Torus::getMaterial() const {
     return material;
 }
 
@@ -64,28 +68,51 @@ bool Torus::checkBoundingSphereIntersection(const Ray &ray) const {
 }
 
 Ray Torus::transformRayForRotation(const Ray &ray) const {
-    if (rotationX == 0.0 && rotationY == 0.0 && rotationZ == 0.0) {
-        return ray;
-    }
-    Math::Point3D newOrigin = ray.origin;
-    Math::Vector3D newDirection = ray.direction;
+    return transform.toObject(ray);
+}
 
-    if (rotationZ != 0.0) {
-        RayTracer::Rotate rotateZ("z", -rotationZ);
-        newOrigin = rotateZ.applyToPoint(newOrigin);
-        newDirection = rotateZ.applyToVector(newDirection);
-    }
-    if (rotationY != 0.0) {
-        RayTracer::Rotate rotateY("y", -rotationY);
-        newOrigin = rotateY.applyToPoint(newOrigin);
-        newDirection = rotateY.applyToVector(newDirection);
-    }
-    if (rotationX != 0.0) {
-        RayTracer::Rotate rotateX("x", -rotationX);
-        newOrigin = rotateX.applyToPoint(newOrigin);
-        newDirection = rotateX.applyToVector(newDirection);
+std::optional<double> Torus::solveIntersection(const Ray &ray, double tMin,
+double tMax) const {
+    // Restart the ray where it enters the bounding sphere, coefficients built
+    // from a far away origin lose the precision grazing rays need
+    double boundingRadius = majorRadius + minorRadius;
+    Math::Vector3D toCenter = ray.origin - center;
+    double dd = ray.direction.dot(ray.direction);
+    double halfB = toCenter.dot(ray.direction);
+    double c = toCenter.dot(toCenter) - boundingRadius * boundingRadius;
+    double discriminant = halfB * halfB - dd * c;
+    if (discriminant < 0.0 || dd == 0.0)
+        return std::nullopt;
+    double shift = std::max(0.0, (-halfB - std::sqrt(discriminant)) / dd);
+
+    // |p|^2 + R^2 - r^2 squared equals 4R^2 times the squared distance of p
+    // to the axis, with p = o + t d taken relative to the center
+    Math::Vector3D o = toCenter + ray.direction * shift;
+    const Math::Vector3D &d = ray.direction;
+    double od = o.dot(d);
+    double oo = o.dot(o);
+    double oa = o.dot(axis);
+    double da = d.dot(axis);
+    double squareMajor = majorRadius * majorRadius;
+    double k = oo + squareMajor - minorRadius * minorRadius;
+    double fourSquareMajor = 4.0 * squareMajor;
+
+    double roots[4];
+    int count = Math::Polynomial::solveQuartic(
+        dd * dd,
+        4.0 * dd * od,
+        4.0 * od * od + 2.0 * dd * k - fourSquareMajor * (dd - da * da),
+        4.0 * od * k - 2.0 * fourSquareMajor * (od - oa * da),
+        k * k - fourSquareMajor * (oo - oa * oa),
+        roots);
+
+    std::optional<double> closest;
+    for (int i = 0; i < count; i++) {
+        double t = roots[i] + shift;
+        if (t >= tMin && t <= tMax && (!closest || t < *closest))
+            closest = t;
     }
-    return Ray(newOrigin, newDirection);
+    return closest;
 }
 
 Math::Vector3D Torus::calculateNormal(const Math::Point3D &hitPoint) const {
@@ -109,109 +136,77 @@ std::optional<HitInfo> Torus::hit(const Ray &ray, double tMin, double tMax) {
 
     Ray transformedRay = transformRayForRotation(ray);
 
-    Math::Vector3D oc = transformedRay.origin - center;
+    std::optional<double> root = solveIntersection(transformedRay, tMin, tMax);
+    if (!root)
+        return std::nullopt;
 
-    const int MAX_STEPS = 128;
     const double EPSILON = 0.001;
-    double t = tMin;
-
-    for (int i = 0; i < MAX_STEPS && t < tMax; i++) {
-        Math::Point3D p = transformedRay.origin + transformedRay.direction * t;
-        Math::Vector3D op = p - center;
-
-        double dotProduct = op.dot(axis);
-        Math::Point3D projectedPoint = p - axis * dotProduct;
-
-        Math::Vector3D toProjected = projectedPoint - center;
-        double distToAxis = toProjected.length();
-
-        double distance = std::sqrt(
-            std::pow(distToAxis - majorRadius, 2) +
-            std::pow(dotProduct, 2)
-        ) - minorRadius;
-
-        if (distance < EPSILON) {
-            HitInfo info;
-            info.distance = t;
-            info.hitPoint = ray.origin + ray.direction * t;
-            info.normal = calculateNormal(p);
-
-            Math::Vector3D hitPointVector = p - center;
-
-            double heightFromCenter = hitPointVector.dot(axis);
-            Math::Vector3D projectedVector = hitPointVector - axis * heightFromCenter;
-            double projLength = projectedVector.length();
-
-            Math::Vector3D normalized;
-            if (projLength > EPSILON) {
-                normalized = projectedVector / projLength;
-            } else {
-                if (std::abs(axis.X) < std::abs(axis.Y) && std::abs(axis.X) < std::abs(axis.Z)) {
-                    normalized = axis.cross(Math::Vector3D(Math::Coords{1, 0, 0})).normalize();
-                } else {
-                    normalized = axis.cross(Math::Vector3D(Math::Coords{0, 1, 0})).normalize();
-                }
-            }
-
-            Math::Point3D tubeCenter = center + normalized * majorRadius;
-
-            Math::Vector3D basisX, basisY;
-            if (std::abs(axis.X) < 0.9) {
-                basisX = Math::Vector3D(Math::Coords{1, 0, 0}).cross(axis).normalize();
-            } else {
-                basisX = Math::Vector3D(Math::Coords{0, 1, 0}).cross(axis).normalize();
-            }
-            basisY = axis.cross(basisX).normalize();
-
-            double phi = std::atan2(normalized.dot(basisY), normalized.dot(basisX));
-            double u = (phi + M_PI) / (2.0 * M_PI);
-
-            Math::Vector3D tubeVector = p - tubeCenter;
-            double tubeHeight = tubeVector.dot(axis);
-            Math::Vector3D tubeRadial = tubeVector - axis * tubeHeight;
-            double tubeRadialLength = tubeRadial.length();
-
-            if (tubeRadialLength > EPSILON) {
-                tubeRadial = tubeRadial / tubeRadialLength;
-
-                double cosTheta = tubeRadial.dot(normalized);
-                double sinTheta = tubeRadial.dot(axis.cross(normalized).normalize());
-                double theta = std::atan2(sinTheta, cosTheta);
-                double v = (theta + M_PI) / (2.0 * M_PI);
-
-                u = std::fmod(u, 1.0);
-                if (u < 0) u += 1.0;
-                v = std::fmod(v, 1.0);
-                if (v < 0) v += 1.0;
-
-                info.uv = Math::Vector2D(u, v);
-            } else {
-                info.uv = Math::Vector2D(0, 0);
-            }
-
-            if (rotationX != 0.0 || rotationY != 0.0 || rotationZ != 0.0) {
-                if (rotationX != 0.0) {
-                    RayTracer::Rotate rotateX("x", rotationX);
-                    info.normal = rotateX.applyToVector(info.normal);
-                }
-                if (rotationY != 0.0) {
-                    RayTracer::Rotate rotateY("y", rotationY);
-                    info.normal = rotateY.applyToVector(info.normal);
-                }
-                if (rotationZ != 0.0) {
-                    RayTracer::Rotate rotateZ("z", rotationZ);
-                    info.normal = rotateZ.applyToVector(info.normal);
-                }
-            }
-
-            info.normal = info.normal.normalize();
-            info.primitive = const_cast<Torus*>(this)->shared_from_this();
-            return info;
+    double t = *root;
+    Math::Point3D p = transformedRay.origin + transformedRay.direction * t;
+
+    HitInfo info;
+    info.distance = t;
+    info.hitPoint = ray.origin + ray.direction * t;
+    info.normal = calculateNormal(p);
+
+    Math::Vector3D hitPointVector = p - center;
+
+    double heightFromCenter = hitPointVector.dot(axis);
+    Math::Vector3D projectedVector = hitPointVector - axis * heightFromCenter;
+    double projLength = projectedVector.length();
+
+    Math::Vector3D normalized;
+    if (projLength > EPSILON) {
+        normalized = projectedVector / projLength;
+    } else {
+        if (std::abs(axis.X) < std::abs(axis.Y) && std::abs(axis.X) < std::abs(axis.Z)) {
+            normalized = axis.cross(Math::Vector3D(Math::Coords{1, 0, 0})).normalize();
+        } else {
+            normalized = axis.cross(Math::Vector3D(Math::Coords{0, 1, 0})).normalize();
         }
-        t += std::max(distance * 0.5, EPSILON);
     }
 
-    return std::nullopt;
+    Math::Point3D tubeCenter = center + normalized * majorRadius;
+
+    Math::Vector3D basisX, basisY;
+    if (std::abs(axis.X) < 0.9) {
+        basisX = Math::Vector3D(Math::Coords{1, 0, 0}).cross(axis).normalize();
+    } else {
+        basisX = Math::Vector3D(Math::Coords{0, 1, 0}).cross(axis).normalize();
+    }
+    basisY = axis.cross(basisX).normalize();
+
+    double phi = std::atan2(normalized.dot(basisY), normalized.dot(basisX));
+    double u = (phi + M_PI) / (2.0 * M_PI);
+
+    Math::Vector3D tubeVector = p - tubeCenter;
+    double tubeHeight = tubeVector.dot(axis);
+    Math::Vector3D tubeRadial = tubeVector - axis * tubeHeight;
+    double tubeRadialLength = tubeRadial.length();
+
+    if (tubeRadialLength > EPSILON) {
+        tubeRadial = tubeRadial / tubeRadialLength;
+
+        double cosTheta = tubeRadial.dot(normalized);
+        double sinTheta = tubeRadial.dot(axis.cross(normalized).normalize());
+        double theta = std::atan2(sinTheta, cosTheta);
+        double v = (theta + M_PI) / (2.0 * M_PI);
+
+        u = std::fmod(u, 1.0);
+        if (u < 0) u += 1.0;
+        v = std::fmod(v, 1.0);
+        if (v < 0) v += 1.0;
+
+        info.uv = Math::Vector2D(u, v);
+    } else {
+        info.uv = Math::Vector2D(0, 0);
+    }
+
+    info.normal = transform.normalToWorld(info.normal);
+
+    info.normal = info.normal.normalize();
+    info.primitive = this;
+    return info;
 }
 
 std::shared_ptr<IPrimitive> Torus::clone() const {
@@ -219,6 +214,7 @@ std::shared_ptr<IPrimitive> Torus::clone() const {
     copy->rotationX = rotationX;
     copy->rotationY = rotationY;
     copy->rotationZ = rotationZ;
+    copy->transform = transform;
     copy->setSourceFile(sourceFile);
     return copy;
 }
@@ -256,4 +252,14 @@ void Torus::getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) cons
     (*materialSetting).add("refractionIndex", libconfig::Setting::TypeFloat) = material->refractionIndex;
 }
 
+Math::AABB Torus::getBoundingBox() const {
+    Math::Vector3D ringExtent(Math::Coords{
+        majorRadius * std::sqrt(std::max(0.0, 1.0 - axis.X * axis.X)) + minorRadius,
+        majorRadius * std::sqrt(std::max(0.0, 1.0 - axis.Y * axis.Y)) + minorRadius,
+        majorRadius * std::sqrt(std::max(0.0, 1.0 - axis.Z * axis.Z)) + minorRadius
+    });
+    Math::AABB bounds(center - ringExtent, center + ringExtent);
+    return transform.boxToWorld(bounds);
+}
+
 }  // namespace RayTracer
@@ -12,15 +12,17 @@
     #include <memory>
     #include "Primitive/IPrimitive.hpp"
     #include "Transformation/Rotate/Rotate.hpp"
+    #include "Transformation/ObjectTransform/ObjectTransform.hpp"
     #include <libconfig.h++>
 
 namespace RayTracer {
-class Torus : public IPrimitive, public std::enable_shared_from_this<Torus> {
+class Torus : public IPrimitive {
  private:
     std::shared_ptr<Material> material;
     double rotationX = 0.0;
     double rotationY = 0.0;
     double rotationZ = 0.0;
+    ObjectTransform transform;
     std::string sourceFile = "";
 
  public:
@@ -49,15 +51,19 @@ class Torus : public IPrimitive, public std::enable_shared_from_this<Torus> {
     void rotateY(double degrees) override;
     void rotateZ(double degrees) override;
     std::optional<HitInfo> hit(const Ray &ray, double tMin, double tMax) override;
-    std::shared_ptr<Material> getMaterial() const override;
+    const std::shared_ptr<Material> &getMaterial() const override;
     std::shared_ptr<IPrimitive> clone() const override;
     void getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) const override;
 
     Math::Point3D getPosition() const override { return center; }
+    Math::AABB getBoundingBox() const override;
 
  private:
     bool checkBoundingSphereIntersection(const Ray &ray) const;
     Ray transformRayForRotation(const Ray &ray) const;
+    // Smallest root of the ray/torus quartic in [tMin, tMax], in object space
+    std::optional<double> solveIntersection(const Ray &ray, double tMin,
+        double tMax) const;
     Math::Vector3D calculateNormal(const Math::Point3D &hitPoint) const;
 
     Math::Point3D sampleTorus(double u, double v) const {
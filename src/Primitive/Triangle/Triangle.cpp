@@ -12,7 +12,6 @@
 #include "Math/Point3D/Point3D.hpp"
 #include "Math/Vector3D/Vector3D.hpp"
 #include "Triangle.hpp"
-#include "Transformation/Rotate/Rotate.hpp"
 
 namespace RayTracer {
 Triangle::Triangle(const Math::Point3D &v1, const Math::Point3D &v2, const Math::Point3D &v3)
@@ -40,14 +39,17 @@ void Triangle::translate(const Math::Vector3D &translation) {
 
 void Triangle::rotateX(double degrees) {
     rotationX += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
 }
 
 void Triangle::rotateY(double degrees) {
     rotationY += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
 }
 
 void Triangle::rotateZ(double degrees) {
     rotationZ += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
 }
 
 Math::Point3D Triangle::getPosition() const {
@@ -60,30 +62,7 @@ Math::Point3D Triangle::getPosition() const {
 
 std::optional<HitInfo> Triangle::hit(const Ray &ray, double tMin,
 double tMax) {
-    Ray transformedRay = ray;
-
-    if (rotationX != 0.0 || rotationY != 0.0 || rotationZ != 0.0) {
-        Math::Point3D newOrigin = ray.origin;
-        Math::Vector3D newDirection = ray.direction;
-
-        if (rotationZ != 0.0) {
-            RayTracer::Rotate rotateZ("z", -rotationZ);
-            newOrigin = rotateZ.applyToPoint(newOrigin);
-            newDirection = rotateZ.applyToVector(newDirection);
-        }
-        if (rotationY != 0.0) {
-            RayTracer::Rotate rotateY("y", -rotationY);
-            newOrigin = rotateY.applyToPoint(newOrigin);
-            newDirection = rotateY.applyToVector(newDirection);
-        }
-        if (rotationX != 0.0) {
-            RayTracer::Rotate rotateX("x", -rotationX);
-            newOrigin = rotateX.applyToPoint(newOrigin);
-            newDirection = rotateX.applyToVector(newDirection);
-        }
-
-        transformedRay = Ray(newOrigin, newDirection);
-    }
+    Ray transformedRay = transform.toObject(ray);
 
     Math::Vector3D edge1 = vertex2 - vertex1;
     Math::Vector3D edge2 = vertex3 - vertex1;
@@ -117,20 +96,7 @@ double tMax) {
     if (triangleNormal.dot(transformedRay.direction) > 0)
         triangleNormal = triangleNormal * -1.0;
 
-    if (rotationX != 0.0 || rotationY != 0.0 || rotationZ != 0.0) {
-        if (rotationX != 0.0) {
-            RayTracer::Rotate rotateX("x", rotationX);
-            triangleNormal = rotateX.applyToVector(triangleNormal);
-        }
-        if (rotationY != 0.0) {
-            RayTracer::Rotate rotateY("y", rotationY);
-            triangleNormal = rotateY.applyToVector(triangleNormal);
-        }
-        if (rotationZ != 0.0) {
-            RayTracer::Rotate rotateZ("z", rotationZ);
-            triangleNormal = rotateZ.applyToVector(triangleNormal);
-        }
-    }
+    triangleNormal = transform.normalToWorld(triangleNormal);
 
     double w = 1.0 - u - v;
     double textureU = u;
@@ -141,11 +107,11 @@ double tMax) {
     info.hitPoint = ray.origin + ray.direction * t;
     info.normal = triangleNormal.normalize();
     info.uv = Math::Vector2D(textureU, textureV);
-    info.primitive = shared_from_this();
+    info.primitive = this;
     return info;
 }
 
-std::shared_ptr<Material> Triangle::getMaterial() const {
+const std::shared_ptr<Material> &Triangle::getMaterial() const {
     return material;
 }
 
@@ -154,6 +120,7 @@ std::shared_ptr<IPrimitive> Triangle::clone() const {
     copy->rotationX = rotationX;
     copy->rotationY = rotationY;
     copy->rotationZ = rotationZ;
+    copy->transform = transform;
     copy->setSourceFile(sourceFile);
     return copy;
 }
@@ -170,4 +137,14 @@ void Triangle::getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) c
     (*setting).add("v3z", libconfig::Setting::TypeFloat) = static_cast<double>(vertex3.Z);
 }
 
+Math::AABB Triangle::getBoundingBox() const {
+    Math::AABB bounds;
+
+    bounds.expand(vertex1);
+    bounds.expand(vertex2);
+    bounds.expand(vertex3);
+    // Keep axis-aligned triangles from producing a zero-thickness box
+    return transform.boxToWorld(bounds.inflated(1e-6));
+}
+
 }  // namespace RayTracer
@@ -0,0 +1,477 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** TriangleMesh implementation
+*/
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "Primitive/TriangleMesh/TriangleMesh.hpp"
+
+namespace RayTracer {
+
+TriangleMesh::TriangleMesh(MeshData meshData,
+const std::shared_ptr<Material> &material)
+: material(material), offset(Math::Coords{0.0, 0.0, 0.0}),
+data(std::move(meshData)) {
+    buildTree();
+}
+
+void TriangleMesh::buildTree() {
+    size_t triangleCount = data.getTriangleCount();
+    std::vector<Math::AABB> bounds;
+
+    data.indices.resize(triangleCount * 3);
+    bounds.reserve(triangleCount);
+    for (size_t i = 0; i < triangleCount; i++)
+        bounds.push_back(triangleBounds(i));
+    tree.build(bounds);
+
+    // Store the faces in leaf order so a leaf slot is a triangle index
+    std::vector<uint32_t> ordered;
+    ordered.reserve(data.indices.size());
+    for (int triangle : tree.getOrder()) {
+        ordered.push_back(data.indices[3 * triangle]);
+        ordered.push_back(data.indices[3 * triangle + 1]);
+        ordered.push_back(data.indices[3 * triangle + 2]);
+    }
+    data.indices = std::move(ordered);
+
+    double surfaceArea = 0.0;
+    double uvArea = 0.0;
+    for (size_t i = 0; i < triangleCount; i++) {
+        uint32_t i0 = data.indices[3 * i];
+        uint32_t i1 = data.indices[3 * i + 1];
+        uint32_t i2 = data.indices[3 * i + 2];
+        Math::Point3D vertex1 = vertexAt(i0);
+        surfaceArea += 0.5 * (vertexAt(i1) - vertex1).cross(vertexAt(i2) - vertex1).length();
+        if (!data.hasTexCoords()) {
+            // hit() reports barycentric UVs, each face covers half the unit square
+            uvArea += 0.5;
+            continue;
+        }
+        double du1 = data.texCoordsU[i1] - data.texCoordsU[i0];
+        double dv1 = data.texCoordsV[i1] - data.texCoordsV[i0];
+        double du2 = data.texCoordsU[i2] - data.texCoordsU[i0];
+        double dv2 = data.texCoordsV[i2] - data.texCoordsV[i0];
+        uvArea += 0.5 * std::abs(du1 * dv2 - du2 * dv1);
+    }
+    uvDensity = surfaceArea > 0.0 ? std::sqrt(uvArea / surfaceArea) : 0.0;
+}
+
+Math::Point3D TriangleMesh::vertexAt(uint32_t vertex) const {
+    return Math::Point3D(Math::Coords{
+        data.positionsX[vertex],
+        data.positionsY[vertex],
+        data.positionsZ[vertex]
+    });
+}
+
+Math::AABB TriangleMesh::triangleBounds(size_t triangle) const {
+    Math::AABB bounds;
+
+    for (int corner = 0; corner < 3; corner++)
+        bounds.expand(vertexAt(data.indices[3 * triangle + corner]));
+    // Keep axis-aligned faces from producing a zero-thickness box
+    return bounds.inflated(1e-6);
+}
+
+void TriangleMesh::translate(const Math::Vector3D &translation) {
+    offset += translation;
+}
+
+void TriangleMesh::rotateX(double degrees) {
+    rotationX += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
+}
+
+void TriangleMesh::rotateY(double degrees) {
+    rotationY += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
+}
+
+void TriangleMesh::rotateZ(double degrees) {
+    rotationZ += degrees;
+    transform.setRotation(rotationX, rotationY, rotationZ);
+}
+
+const std::shared_ptr<Material> &TriangleMesh::getMaterial() const {
+    return material;
+}
+
+bool TriangleMesh::intersectTriangle(size_t triangle, const Ray &ray,
+double tMin, double tMax, double &t, double &u, double &v) const {
+    Math::Point3D vertex1 = vertexAt(data.indices[3 * triangle]);
+    Math::Point3D vertex2 = vertexAt(data.indices[3 * triangle + 1]);
+    Math::Point3D vertex3 = vertexAt(data.indices[3 * triangle + 2]);
+    Math::Vector3D edge1 = vertex2 - vertex1;
+    Math::Vector3D edge2 = vertex3 - vertex1;
+    Math::Vector3D h = ray.direction.cross(edge2);
+    double a = edge1.dot(h);
+
+    if (std::abs(a) < 1e-8)
+        return false;
+
+    double f = 1.0 / a;
+    Math::Vector3D s = ray.origin - vertex1;
+    u = f * s.dot(h);
+    if (u < 0.0 || u > 1.0)
+        return false;
+
+    Math::Vector3D q = s.cross(edge1);
+    v = f * ray.direction.dot(q);
+    if (v < 0.0 || u + v > 1.0)
+        return false;
+
+    t = f * edge2.dot(q);
+    return t >= tMin && t <= tMax;
+}
+
+bool TriangleMesh::closestTriangle(const Ray &localRay, double tMin,
+double &closest, size_t &triangle, double &u, double &v) const {
+    return tree.traverse(localRay, tMin, closest, false,
+        [this, &localRay, &triangle, &u, &v](int slot,
+        double slotMin, double &slotMax) {
+            double t = 0.0;
+            double slotU = 0.0;
+            double slotV = 0.0;
+            if (!intersectTriangle(slot, localRay, slotMin, slotMax, t, slotU, slotV))
+                return false;
+            slotMax = t;
+            triangle = slot;
+            u = slotU;
+            v = slotV;
+            return true;
+        });
+}
+
+std::optional<double> TriangleMesh::intersect(const Ray &ray, double tMin,
+double tMax) {
+    Ray transformedRay = transform.toObject(ray);
+    Ray localRay(transformedRay.origin - offset, transformedRay.direction);
+    double closest = tMax;
+    size_t triangle = 0;
+    double u = 0.0;
+    double v = 0.0;
+
+    if (!closestTriangle(localRay, tMin, closest, triangle, u, v))
+        return std::nullopt;
+    return closest;
+}
+
+bool TriangleMesh::occluded(const Ray &ray, double tMin, double tMax) {
+    Ray transformedRay = transform.toObject(ray);
+    Ray localRay(transformedRay.origin - offset, transformedRay.direction);
+    double closest = tMax;
+
+    return tree.traverse(localRay, tMin, closest, true,
+        [this, &localRay](int slot, double slotMin, double &slotMax) {
+            double t = 0.0;
+            double u = 0.0;
+            double v = 0.0;
+            return intersectTriangle(slot, localRay, slotMin, slotMax, t, u, v);
+        });
+}
+
+std::optional<HitInfo> TriangleMesh::hit(const Ray &ray, double tMin,
+double tMax) {
+    Ray transformedRay = transform.toObject(ray);
+    Ray localRay(transformedRay.origin - offset, transformedRay.direction);
+
+    double closest = tMax;
+    size_t hitTriangle = 0;
+    double hitU = 0.0;
+    double hitV = 0.0;
+    if (!closestTriangle(localRay, tMin, closest, hitTriangle, hitU, hitV))
+        return std::nullopt;
+
+    uint32_t i0 = data.indices[3 * hitTriangle];
+    uint32_t i1 = data.indices[3 * hitTriangle + 1];
+    uint32_t i2 = data.indices[3 * hitTriangle + 2];
+    double w = 1.0 - hitU - hitV;
+    Math::Point3D vertex1 = vertexAt(i0);
+    Math::Vector3D faceNormal = (vertexAt(i1) - vertex1).cross(
+        vertexAt(i2) - vertex1).normalize();
+    bool backFacing = faceNormal.dot(localRay.direction) > 0;
+    Math::Vector3D normal = faceNormal;
+
+    if (data.hasNormals()) {
+        Math::Vector3D interpolated(Math::Coords{
+            w * data.normalsX[i0] + hitU * data.normalsX[i1] + hitV * data.normalsX[i2],
+            w * data.normalsY[i0] + hitU * data.normalsY[i1] + hitV * data.normalsY[i2],
+            w * data.normalsZ[i0] + hitU * data.normalsZ[i1] + hitV * data.normalsZ[i2]
+        });
+        if (interpolated.length() > 1e-8)
+            normal = interpolated.normalize();
+    }
+    if (backFacing)
+        normal = normal * -1.0;
+
+    normal = transform.normalToWorld(normal);
+
+    HitInfo info;
+    info.distance = closest;
+    info.hitPoint = ray.origin + ray.direction * closest;
+    info.normal = normal.normalize();
+    if (data.hasTexCoords()) {
+        info.uv = Math::Vector2D(
+            w * data.texCoordsU[i0] + hitU * data.texCoordsU[i1] + hitV * data.texCoordsU[i2],
+            w * data.texCoordsV[i0] + hitU * data.texCoordsV[i1] + hitV * data.texCoordsV[i2]);
+    } else {
+        info.uv = Math::Vector2D(hitU, hitV);
+    }
+    info.primitive = this;
+    return info;
+}
+
+void TriangleMesh::hitPacket(const RayPacket &packet, double tMin,
+PacketHit &hits) {
+    if (tree.empty())
+        return;
+    RayPacket local = transform.toObject(packet);
+    for (int lane = 0; lane < local.count; lane++) {
+        local.originX[lane] -= offset.X;
+        local.originY[lane] -= offset.Y;
+        local.originZ[lane] -= offset.Z;
+    }
+
+    tree.traversePacket(local, tMin, hits.distance, [this, &local, tMin, &hits](int slot) {
+        Math::Point3D vertex1 = vertexAt(data.indices[3 * slot]);
+        Math::Point3D vertex2 = vertexAt(data.indices[3 * slot + 1]);
+        Math::Point3D vertex3 = vertexAt(data.indices[3 * slot + 2]);
+        double e1x = vertex2.X - vertex1.X;
+        double e1y = vertex2.Y - vertex1.Y;
+        double e1z = vertex2.Z - vertex1.Z;
+        double e2x = vertex3.X - vertex1.X;
+        double e2y = vertex3.Y - vertex1.Y;
+        double e2z = vertex3.Z - vertex1.Z;
+
+        // Moller-Trumbore on every lane, same tests as intersectTriangle
+        for (int lane = 0; lane < local.count; lane++) {
+            double dx = local.directionX[lane];
+            double dy = local.directionY[lane];
+            double dz = local.directionZ[lane];
+            double hx = dy * e2z - dz * e2y;
+            double hy = dz * e2x - dx * e2z;
+            double hz = dx * e2y - dy * e2x;
+            double a = e1x * hx + e1y * hy + e1z * hz;
+            if (std::abs(a) < 1e-8)
+                continue;
+            double f = 1.0 / a;
+            double sx = local.originX[lane] - vertex1.X;
+            double sy = local.originY[lane] - vertex1.Y;
+            double sz = local.originZ[lane] - vertex1.Z;
+            double u = f * (sx * hx + sy * hy + sz * hz);
+            if (u < 0.0 || u > 1.0)
+                continue;
+            double qx = sy * e1z - sz * e1y;
+            double qy = sz * e1x - sx * e1z;
+            double qz = sx * e1y - sy * e1x;
+            double v = f * (dx * qx + dy * qy + dz * qz);
+            if (v < 0.0 || u + v > 1.0)
+                continue;
+            double t = f * (e2x * qx + e2y * qy + e2z * qz);
+            if (t < tMin || t > hits.distance[lane])
+                continue;
+            hits.distance[lane] = t;
+            hits.primitive[lane] = this;
+        }
+    });
+}
+
+void TriangleMesh::tessellateDisplacement() {
+    size_t triangleCount = data.getTriangleCount();
+    if (displaced || triangleCount == 0 || !material || !material->hasDisplacementMap())
+        return;
+    int segments = static_cast<int>(std::sqrt(
+        static_cast<double>(MAX_DISPLACED_TRIANGLES) / triangleCount));
+    segments = std::clamp(segments, 1, MAX_SUBDIVISIONS);
+    size_t vertexCount = data.getVertexCount();
+
+    // Area weighted normals, one per position so split vertices push the same way
+    std::map<std::array<float, 3>, Math::Vector3D> positionNormals;
+    auto positionOf = [this](uint32_t vertex) {
+        return std::array<float, 3>{data.positionsX[vertex], data.positionsY[vertex],
+            data.positionsZ[vertex]};
+    };
+    for (size_t triangle = 0; triangle < triangleCount; triangle++) {
+        Math::Point3D vertex1 = vertexAt(data.indices[3 * triangle]);
+        Math::Vector3D weighted = (vertexAt(data.indices[3 * triangle + 1]) - vertex1).cross(
+            vertexAt(data.indices[3 * triangle + 2]) - vertex1);
+        for (int corner = 0; corner < 3; corner++) {
+            auto it = positionNormals.try_emplace(positionOf(data.indices[3 * triangle + corner]),
+                Math::Coords{0.0, 0.0, 0.0}).first;
+            it->second += weighted;
+        }
+    }
+    std::vector<Math::Vector3D> normals;
+    normals.reserve(vertexCount);
+    for (uint32_t vertex = 0; vertex < vertexCount; vertex++)
+        normals.push_back(positionNormals.at(positionOf(vertex)));
+
+    // Vertices with the same position and UV are one corner for the micro-vertices.
+    // Barycentric UVs differ on each face, such faces keep their own edges
+    std::vector<uint32_t> welded(vertexCount);
+    std::map<std::array<float, 5>, uint32_t> weldIds;
+    for (uint32_t vertex = 0; vertex < vertexCount; vertex++) {
+        if (!data.hasTexCoords()) {
+            welded[vertex] = vertex;
+            continue;
+        }
+        std::array<float, 3> position = positionOf(vertex);
+        welded[vertex] = weldIds.try_emplace({position[0], position[1], position[2],
+            data.texCoordsU[vertex], data.texCoordsV[vertex]},
+            static_cast<uint32_t>(weldIds.size())).first->second;
+    }
+
+    MeshData micro;
+    // (lower corner, upper corner, step from the lower one) -> micro-vertex
+    std::map<std::tuple<uint32_t, uint32_t, int>, uint32_t> shared;
+    auto addVertex = [this, &micro, &normals](const uint32_t *corners,
+        const double *weights, const Math::Vector2D &faceUV) {
+        Math::Vector3D position(Math::Coords{0.0, 0.0, 0.0});
+        Math::Vector3D normal(Math::Coords{0.0, 0.0, 0.0});
+        Math::Vector2D uv = faceUV;
+
+        if (data.hasTexCoords())
+            uv = Math::Vector2D(0.0, 0.0);
+        for (int corner = 0; corner < 3; corner++) {
+            uint32_t vertex = corners[corner];
+            position += Math::Vector3D(Math::Coords{data.positionsX[vertex],
+                data.positionsY[vertex], data.positionsZ[vertex]}) * weights[corner];
+            normal += normals[vertex] * weights[corner];
+            if (data.hasTexCoords()) {
+                uv.U += data.texCoordsU[vertex] * weights[corner];
+                uv.V += data.texCoordsV[vertex] * weights[corner];
+            }
+        }
+        if (normal.length() > 1e-12)
+            normal = normal.normalize();
+        Math::Point3D point = material->displacePoint(
+            Math::Point3D(Math::Coords{position.X, position.Y, position.Z}), normal, uv);
+        micro.positionsX.push_back(static_cast<float>(point.X));
+        micro.positionsY.push_back(static_cast<float>(point.Y));
+        micro.positionsZ.push_back(static_cast<float>(point.Z));
+        micro.texCoordsU.push_back(static_cast<float>(uv.U));
+        micro.texCoordsV.push_back(static_cast<float>(uv.V));
+        return static_cast<uint32_t>(micro.getVertexCount() - 1);
+    };
+    // Point step / segments of the way from corner a to corner b, built the same
+    // way from both faces of the edge so they get the very same vertex
+    auto edgeVertex = [&](uint32_t a, uint32_t b, int step, const Math::Vector2D &faceUV) {
+        if (welded[b] < welded[a] || (welded[b] == welded[a] && b < a)) {
+            std::swap(a, b);
+            step = segments - step;
+        }
+        if (step == segments) {
+            a = b;
+            step = 0;
+        }
+        auto key = std::make_tuple(welded[a], step == 0 ? welded[a] : welded[b], step);
+        auto found = shared.find(key);
+        if (found != shared.end())
+            return found->second;
+        uint32_t corners[3] = {a, b, b};
+        double weights[3] = {1.0 - static_cast<double>(step) / segments,
+            static_cast<double>(step) / segments, 0.0};
+        uint32_t vertex = addVertex(corners, weights, faceUV);
+        shared.emplace(key, vertex);
+        return vertex;
+    };
+
+    for (size_t triangle = 0; triangle < triangleCount; triangle++) {
+        uint32_t corners[3] = {data.indices[3 * triangle],
+            data.indices[3 * triangle + 1], data.indices[3 * triangle + 2]};
+        std::vector<uint32_t> grid;
+        grid.reserve(static_cast<size_t>(segments + 1) * (segments + 2) / 2);
+
+        if (!data.hasTexCoords())
+            shared.clear();
+        // Row i walks from the first corner towards the third, column j towards the second
+        for (int i = 0; i <= segments; i++) {
+            for (int j = 0; j <= segments - i; j++) {
+                Math::Vector2D faceUV(static_cast<double>(j) / segments,
+                    static_cast<double>(i) / segments);
+                if (i == 0) {
+                    grid.push_back(edgeVertex(corners[0], corners[1], j, faceUV));
+                } else if (j == 0) {
+                    grid.push_back(edgeVertex(corners[0], corners[2], i, faceUV));
+                } else if (i + j == segments) {
+                    grid.push_back(edgeVertex(corners[1], corners[2], i, faceUV));
+                } else {
+                    double weights[3] = {1.0 - faceUV.U - faceUV.V, faceUV.U, faceUV.V};
+                    grid.push_back(addVertex(corners, weights, faceUV));
+                }
+            }
+        }
+
+        auto index = [&grid, segments](int i, int j) {
+            return grid[i * (segments + 1) - i * (i - 1) / 2 + j];
+        };
+        // Same winding as the original face
+        for (int i = 0; i < segments; i++) {
+            for (int j = 0; j < segments - i; j++) {
+                micro.indices.insert(micro.indices.end(),
+                    {index(i, j), index(i, j + 1), index(i + 1, j)});
+                if (j + 1 < segments - i) {
+                    micro.indices.insert(micro.indices.end(),
+                        {index(i, j + 1), index(i + 1, j + 1), index(i + 1, j)});
+                }
+            }
+        }
+    }
+
+    // Smooth normals of the displaced surface, area weighted across the shared vertices
+    size_t microCount = micro.getVertexCount();
+    micro.normalsX.assign(microCount, 0.0f);
+    micro.normalsY.assign(microCount, 0.0f);
+    micro.normalsZ.assign(microCount, 0.0f);
+    data = std::move(micro);
+    for (size_t face = 0; face < data.getTriangleCount(); face++) {
+        Math::Point3D vertex1 = vertexAt(data.indices[3 * face]);
+        Math::Vector3D normal = (vertexAt(data.indices[3 * face + 1]) - vertex1).cross(
+            vertexAt(data.indices[3 * face + 2]) - vertex1);
+        for (int corner = 0; corner < 3; corner++) {
+            uint32_t vertex = data.indices[3 * face + corner];
+            data.normalsX[vertex] += static_cast<float>(normal.X);
+            data.normalsY[vertex] += static_cast<float>(normal.Y);
+            data.normalsZ[vertex] += static_cast<float>(normal.Z);
+        }
+    }
+    buildTree();
+    displaced = true;
+}
+
+std::shared_ptr<IPrimitive> TriangleMesh::clone() const {
+    return std::make_shared<TriangleMesh>(*this);
+}
+
+void TriangleMesh::getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) const {
+    // Meshes come from obj_model entries, which the scene saves on its own
+    (void)setting;
+}
+
+Math::Point3D TriangleMesh::getPosition() const {
+    if (tree.empty())
+        return Math::Point3D(Math::Coords{offset.X, offset.Y, offset.Z});
+    return tree.getBounds().centroid() + offset;
+}
+
+Math::AABB TriangleMesh::getBoundingBox() const {
+    if (tree.empty())
+        return Math::AABB();
+    Math::AABB bounds = tree.getBounds();
+
+    bounds = Math::AABB(bounds.min + offset, bounds.max + offset);
+    return transform.boxToWorld(bounds);
+}
+
+}  // namespace RayTracer
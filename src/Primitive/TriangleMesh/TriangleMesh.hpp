@@ -0,0 +1,144 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** TriangleMesh Primitive
+*/
+
+#ifndef SRC_PRIMITIVE_TRIANGLEMESH_TRIANGLEMESH_HPP_
+    #define SRC_PRIMITIVE_TRIANGLEMESH_TRIANGLEMESH_HPP_
+    #include <cstdint>
+    #include <string>
+    #include <memory>
+    #include <vector>
+    #include <libconfig.h++>
+    #include "Primitive/IPrimitive.hpp"
+    #include "Primitive/BVH/BVHTree.hpp"
+    #include "Transformation/ObjectTransform/ObjectTransform.hpp"
+
+namespace RayTracer {
+/**
+ * @brief Flat vertex and index buffers of a mesh
+ *
+ * Attributes are stored as one array per component. Normals and texture
+ * coordinates are optional: leave their arrays empty, otherwise they hold
+ * one entry per vertex like the positions.
+ */
+struct MeshData {
+    std::vector<float> positionsX;
+    std::vector<float> positionsY;
+    std::vector<float> positionsZ;
+    std::vector<float> normalsX;
+    std::vector<float> normalsY;
+    std::vector<float> normalsZ;
+    std::vector<float> texCoordsU;
+    std::vector<float> texCoordsV;
+    // Three vertex indices per triangle
+    std::vector<uint32_t> indices;
+
+    size_t getVertexCount() const { return positionsX.size(); }
+    size_t getTriangleCount() const { return indices.size() / 3; }
+    bool hasNormals() const { return !normalsX.empty(); }
+    bool hasTexCoords() const { return !texCoordsU.empty(); }
+};
+
+/**
+ * @brief Indexed triangle mesh intersected through its own BVH
+ *
+ * Replaces one Triangle primitive per face: the whole mesh is a single
+ * primitive sharing its vertices between faces.
+ */
+class TriangleMesh : public IPrimitive {
+ public:
+    // Micro-triangles a displaced mesh may grow to, split evenly between its faces
+    static constexpr size_t MAX_DISPLACED_TRIANGLES = 1 << 20;
+    // Most segments an original edge is split into
+    static constexpr int MAX_SUBDIVISIONS = 64;
+
+ private:
+    std::shared_ptr<Material> material;
+    double rotationX = 0.0;
+    double rotationY = 0.0;
+    double rotationZ = 0.0;
+    ObjectTransform transform;
+    std::string sourceFile = "";
+    // Applied in object space, before the rotations, like Triangle does
+    Math::Vector3D offset;
+    MeshData data;
+    BVHTree tree;
+    bool displaced = false;
+    // Square root of the UV area over the surface area, see getUVDensity()
+    double uvDensity = 0.0;
+
+    void buildTree();
+    Math::Point3D vertexAt(uint32_t vertex) const;
+    Math::AABB triangleBounds(size_t triangle) const;
+    bool intersectTriangle(size_t triangle, const Ray &ray, double tMin,
+        double tMax, double &t, double &u, double &v) const;
+    // Shrinks closest to the nearest face along the object space ray
+    bool closestTriangle(const Ray &localRay, double tMin, double &closest,
+        size_t &triangle, double &u, double &v) const;
+
+ public:
+    TriangleMesh(MeshData data, const std::shared_ptr<Material> &material);
+    ~TriangleMesh() override = default;
+
+    static std::string getTypeNameStatic() {
+        return "meshes";
+    }
+
+    std::string getTypeName() const override {
+        return TriangleMesh::getTypeNameStatic();
+    }
+
+    void setSourceFile(const std::string& source) override {
+        sourceFile = source;
+    }
+
+    std::string getSourceFile() const override {
+        return sourceFile;
+    }
+
+    void translate(const Math::Vector3D &translation) override;
+    void rotateX(double degrees) override;
+    void rotateY(double degrees) override;
+    void rotateZ(double degrees) override;
+    std::optional<HitInfo> hit(const Ray &ray,
+        double tMin, double tMax) override;
+    std::optional<double> intersect(const Ray &ray, double tMin,
+        double tMax) override;
+    bool occluded(const Ray &ray, double tMin, double tMax) override;
+    void hitPacket(const RayPacket &packet, double tMin,
+        PacketHit &hits) override;
+    /**
+     * @brief Replaces the faces by displaced micro-triangles
+     *
+     * Every face is split in the same number of segments per edge. Faces
+     * sharing an edge, with the same positions and texture coordinates at its
+     * ends, share its micro-vertices, so the displaced mesh stays watertight.
+     * Vertices move along the area weighted normal of their position, by the
+     * material displacement at their texture coordinate; faces without any
+     * use their barycentric ones, as hit() does, and keep their own edges.
+     * Nothing happens without a displacement map.
+     */
+    void tessellateDisplacement() override;
+    bool hasDisplacedGeometry() const override { return displaced; }
+    const std::shared_ptr<Material> &getMaterial() const override;
+    std::shared_ptr<IPrimitive> clone() const override;
+    void getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) const override;
+
+    // Averaged over the faces, computed with the tree
+    double getUVDensity(const HitInfo &hit) const override {
+        (void)hit;
+        return uvDensity;
+    }
+    Math::Point3D getPosition() const override;
+    Math::AABB getBoundingBox() const override;
+
+    const MeshData &getData() const { return data; }
+    size_t getTriangleCount() const { return data.getTriangleCount(); }
+};
+}  // namespace RayTracer
+
+#endif  // SRC_PRIMITIVE_TRIANGLEMESH_TRIANGLEMESH_HPP_
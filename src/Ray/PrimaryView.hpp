@@ -0,0 +1,73 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** PrimaryView - layout of the camera rays of a frame
+*/
+
+#ifndef SRC_RAY_PRIMARYVIEW_HPP_
+#define SRC_RAY_PRIMARYVIEW_HPP_
+#include "Math/Point3D/Point3D.hpp"
+#include "Math/Vector3D/Vector3D.hpp"
+#include "Ray/Ray.hpp"
+
+namespace RayTracer {
+
+/**
+ * @brief Where the primary rays of a frame come from and go through
+ * Pixel (x, y) looks through screenOrigin + screenU * x / (width - 1)
+ * + screenV * (height - 1 - y) / (height - 1), like Camera::ray does
+ */
+struct PrimaryView {
+    Math::Point3D eye;
+    Math::Point3D screenOrigin;
+    Math::Vector3D screenU;
+    Math::Vector3D screenV;
+    int width = 0;
+    int height = 0;
+
+    bool operator==(const PrimaryView &other) const {
+        return sameCoords(eye, other.eye) && sameCoords(screenOrigin, other.screenOrigin)
+            && sameCoords(screenU, other.screenU) && sameCoords(screenV, other.screenV)
+            && width == other.width && height == other.height;
+    }
+
+    bool isValid() const { return width > 1 && height > 1; }
+
+    // Normalized ray through continuous pixel coordinates
+    Ray pixelRay(double x, double y) const {
+        double u = x / (width - 1);
+        double v = ((height - 1) - y) / (height - 1);
+        Math::Point3D target = screenOrigin + screenU * u + screenV * v;
+        return Ray(eye, (target - eye).normalize());
+    }
+
+    /**
+     * @brief Inverse of pixelRay() for rays leaving the eye
+     * @return false for rays from elsewhere or pointing away from the screen
+     */
+    bool pixelOf(const Ray &ray, double &x, double &y) const {
+        if (!sameCoords(ray.origin, eye))
+            return false;
+        Math::Vector3D normal = screenU.cross(screenV);
+        double facing = ray.direction.dot(normal);
+        double distance = (screenOrigin - eye).dot(normal);
+        if (facing == 0.0 || distance / facing <= 0.0)
+            return false;
+        Math::Vector3D onScreen = eye + ray.direction * (distance / facing) - screenOrigin;
+        x = onScreen.dot(screenU) / screenU.dot(screenU) * (width - 1);
+        y = (height - 1) - onScreen.dot(screenV) / screenV.dot(screenV) * (height - 1);
+        return true;
+    }
+
+ private:
+    template <typename A, typename B>
+    static bool sameCoords(const A &a, const B &b) {
+        return a.X == b.X && a.Y == b.Y && a.Z == b.Z;
+    }
+};
+
+}  // namespace RayTracer
+
+#endif  // SRC_RAY_PRIMARYVIEW_HPP_
@@ -16,6 +16,9 @@ class Ray {
  public:
     Math::Point3D origin;
     Math::Vector3D direction;
+    // Angle the ray cone widens by per unit of distance, about one pixel for
+    // camera rays; 0 for rays that carry no footprint
+    double spread = 0.0;
 
     Ray() = default;
     Ray(const Math::Point3D &origin, const Math::Vector3D &direction);
@@ -0,0 +1,85 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** RayPacket - coherent rays stored as structure of arrays
+*/
+
+#ifndef SRC_RAY_RAYPACKET_HPP_
+#define SRC_RAY_RAYPACKET_HPP_
+#include <cmath>
+#include <limits>
+#include "Ray/Ray.hpp"
+
+namespace RayTracer {
+class IPrimitive;
+
+/**
+ * @brief Up to SIZE rays laid out lane by lane so intersection kernels can
+ * process several rays per instruction (4 doubles per AVX2 register)
+ */
+struct RayPacket {
+    static constexpr int SIZE = 8;
+
+    alignas(32) double originX[SIZE];
+    alignas(32) double originY[SIZE];
+    alignas(32) double originZ[SIZE];
+    alignas(32) double directionX[SIZE];
+    alignas(32) double directionY[SIZE];
+    alignas(32) double directionZ[SIZE];
+    alignas(32) double inverseX[SIZE];
+    alignas(32) double inverseY[SIZE];
+    alignas(32) double inverseZ[SIZE];
+    double spread[SIZE];
+    int count = 0;
+
+    void set(int lane, const Ray &ray) {
+        originX[lane] = ray.origin.X;
+        originY[lane] = ray.origin.Y;
+        originZ[lane] = ray.origin.Z;
+        directionX[lane] = ray.direction.X;
+        directionY[lane] = ray.direction.Y;
+        directionZ[lane] = ray.direction.Z;
+        inverseX[lane] = safeInverse(ray.direction.X);
+        inverseY[lane] = safeInverse(ray.direction.Y);
+        inverseZ[lane] = safeInverse(ray.direction.Z);
+        spread[lane] = ray.spread;
+    }
+
+    // A huge finite inverse keeps 0 * inverse at 0 in slab tests, where an
+    // infinite one gives NaN that vector min/max do not handle like the scalar test
+    static double safeInverse(double value) {
+        double inverse = 1.0 / value;
+        if (std::isfinite(inverse))
+            return inverse;
+        return std::copysign(1e300, value);
+    }
+
+    Ray getRay(int lane) const {
+        Ray ray(Math::Point3D(Math::Coords{originX[lane], originY[lane], originZ[lane]}),
+            Math::Vector3D(Math::Coords{directionX[lane], directionY[lane], directionZ[lane]}));
+        ray.spread = spread[lane];
+        return ray;
+    }
+};
+
+/**
+ * @brief Closest distance and primitive found so far for each lane of a packet
+ * Only visibility is resolved per packet, the full HitInfo of a lane is
+ * computed afterwards by calling hit() on the reported primitive
+ */
+struct PacketHit {
+    alignas(32) double distance[RayPacket::SIZE];
+    IPrimitive *primitive[RayPacket::SIZE];
+
+    explicit PacketHit(double tMax = std::numeric_limits<double>::infinity()) {
+        for (int lane = 0; lane < RayPacket::SIZE; lane++) {
+            distance[lane] = tMax;
+            primitive[lane] = nullptr;
+        }
+    }
+};
+}  // namespace RayTracer
+
+#endif  // SRC_RAY_RAYPACKET_HPP_
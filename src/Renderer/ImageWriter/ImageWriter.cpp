@@ -0,0 +1,173 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** ImageWriter - writes rendered frame buffers to PPM or PNG files
+*/
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "Exception/FileIOException.hpp"
+#include "Renderer/ImageWriter/ImageWriter.hpp"
+
+namespace RayTracer {
+
+namespace {
+
+const std::array<uint32_t, 256> &crcTable() {
+    static const std::array<uint32_t, 256> table = [] {
+        std::array<uint32_t, 256> values {};
+        for (uint32_t n = 0; n < 256; n++) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; k++)
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            values[n] = c;
+        }
+        return values;
+    }();
+    return table;
+}
+
+uint32_t crc32(uint32_t crc, const uint8_t *data, size_t size) {
+    const auto &table = crcTable();
+    for (size_t i = 0; i < size; i++)
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    return crc;
+}
+
+void appendBigEndian(std::vector<uint8_t> &out, uint32_t value) {
+    out.push_back(static_cast<uint8_t>(value >> 24));
+    out.push_back(static_cast<uint8_t>(value >> 16));
+    out.push_back(static_cast<uint8_t>(value >> 8));
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+void appendChunk(std::vector<uint8_t> &out, const char type[4],
+const std::vector<uint8_t> &data) {
+    appendBigEndian(out, static_cast<uint32_t>(data.size()));
+    size_t typeStart = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data.begin(), data.end());
+    uint32_t crc = crc32(0xFFFFFFFFu, out.data() + typeStart, out.size() - typeStart);
+    appendBigEndian(out, crc ^ 0xFFFFFFFFu);
+}
+
+void writeFile(const std::string &filename, const std::string &header,
+const std::vector<uint8_t> &data) {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+        throw FileIOException(filename, "open", "Could not open file for writing");
+    file.write(header.data(), static_cast<std::streamsize>(header.size()));
+    file.write(reinterpret_cast<const char *>(data.data()),
+        static_cast<std::streamsize>(data.size()));
+    if (!file)
+        throw FileIOException(filename, "write", "Could not write image data");
+}
+
+bool hasPngExtension(const std::string &filename) {
+    if (filename.size() < 4)
+        return false;
+    std::string extension = filename.substr(filename.size() - 4);
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+        [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension == ".png";
+}
+
+}  // namespace
+
+std::vector<uint8_t> ImageWriter::toRGB8(const std::vector<Math::Vector3D> &frameBuffer) {
+    std::vector<uint8_t> rgb(frameBuffer.size() * 3);
+
+    toRGB8(frameBuffer.data(), static_cast<int>(frameBuffer.size()), rgb.data());
+    return rgb;
+}
+
+void ImageWriter::toRGB8(const Math::Vector3D *colors, int count, uint8_t *rgb) {
+    auto toByte = [](double value) {
+        return static_cast<uint8_t>(255.999 * std::sqrt(std::max(0.0, std::min(1.0, value))));
+    };
+
+    for (int i = 0; i < count; i++) {
+        rgb[3 * i] = toByte(colors[i].X);
+        rgb[3 * i + 1] = toByte(colors[i].Y);
+        rgb[3 * i + 2] = toByte(colors[i].Z);
+    }
+}
+
+void ImageWriter::write(const std::string &filename,
+const std::vector<Math::Vector3D> &frameBuffer, int width, int height) {
+    write(filename, toRGB8(frameBuffer), width, height);
+}
+
+void ImageWriter::write(const std::string &filename,
+const std::vector<uint8_t> &rgb, int width, int height) {
+    if (hasPngExtension(filename))
+        writePNG(filename, rgb, width, height);
+    else
+        writePPM(filename, rgb, width, height);
+}
+
+void ImageWriter::writePPM(const std::string &filename,
+const std::vector<uint8_t> &rgb, int width, int height) {
+    std::string header = "P6\n" + std::to_string(width) + " "
+        + std::to_string(height) + "\n255\n";
+
+    writeFile(filename, header, rgb);
+}
+
+void ImageWriter::writePNG(const std::string &filename,
+const std::vector<uint8_t> &rgb, int width, int height) {
+    static const char signature[] = "\x89PNG\r\n\x1a\n";
+    const size_t rowSize = static_cast<size_t>(width) * 3;
+    const size_t maxBlockSize = 65535;
+
+    // Each scanline is prefixed with filter type 0 (none)
+    std::vector<uint8_t> raw;
+    raw.reserve((rowSize + 1) * height);
+    for (int y = 0; y < height; y++) {
+        raw.push_back(0);
+        raw.insert(raw.end(), rgb.begin() + y * rowSize, rgb.begin() + (y + 1) * rowSize);
+    }
+
+    // zlib stream made of stored deflate blocks, followed by the adler32 checksum
+    std::vector<uint8_t> zlib = {0x78, 0x01};
+    zlib.reserve(raw.size() + raw.size() / maxBlockSize * 5 + 16);
+    size_t offset = 0;
+    do {
+        size_t blockSize = std::min(maxBlockSize, raw.size() - offset);
+        bool last = offset + blockSize == raw.size();
+        zlib.push_back(last ? 1 : 0);
+        zlib.push_back(static_cast<uint8_t>(blockSize));
+        zlib.push_back(static_cast<uint8_t>(blockSize >> 8));
+        zlib.push_back(static_cast<uint8_t>(~blockSize));
+        zlib.push_back(static_cast<uint8_t>(~blockSize >> 8));
+        zlib.insert(zlib.end(), raw.begin() + offset, raw.begin() + offset + blockSize);
+        offset += blockSize;
+    } while (offset < raw.size());
+    uint32_t a = 1;
+    uint32_t b = 0;
+    for (uint8_t byte : raw) {
+        a = (a + byte) % 65521;
+        b = (b + a) % 65521;
+    }
+    appendBigEndian(zlib, (b << 16) | a);
+
+    std::vector<uint8_t> header;
+    appendBigEndian(header, static_cast<uint32_t>(width));
+    appendBigEndian(header, static_cast<uint32_t>(height));
+    header.insert(header.end(), {8, 2, 0, 0, 0});
+
+    std::vector<uint8_t> png;
+    appendChunk(png, "IHDR", header);
+    appendChunk(png, "IDAT", zlib);
+    appendChunk(png, "IEND", {});
+    writeFile(filename, std::string(signature, 8), png);
+}
+
+}  // namespace RayTracer
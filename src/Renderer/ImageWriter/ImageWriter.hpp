@@ -0,0 +1,68 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** ImageWriter - writes rendered frame buffers to PPM or PNG files
+*/
+
+#ifndef SRC_RENDERER_IMAGEWRITER_IMAGEWRITER_HPP_
+    #define SRC_RENDERER_IMAGEWRITER_IMAGEWRITER_HPP_
+    #include <cstdint>
+    #include <string>
+    #include <vector>
+    #include "Math/Vector3D/Vector3D.hpp"
+
+namespace RayTracer {
+
+/**
+ * @brief Writes a whole frame buffer to disk in a single pass
+ */
+class ImageWriter {
+ public:
+    /**
+     * @brief Converts linear colors to gamma corrected 8-bit RGB triplets
+     * @param frameBuffer The colors, row by row from the top of the image
+     * @return The packed RGB bytes
+     */
+    static std::vector<uint8_t> toRGB8(const std::vector<Math::Vector3D> &frameBuffer);
+
+    /**
+     * @brief toRGB8() of count colors into rgb, 3 bytes per color
+     * Lets the conversion run block by block, e.g. as the output of post-processing
+     */
+    static void toRGB8(const Math::Vector3D *colors, int count, uint8_t *rgb);
+
+    /**
+     * @brief Writes a frame buffer, as PNG if the filename ends in .png, as binary PPM otherwise
+     * @throws FileIOException if the file can not be written
+     */
+    static void write(const std::string &filename,
+        const std::vector<Math::Vector3D> &frameBuffer, int width, int height);
+
+    /**
+     * @brief write() of colors already packed by toRGB8()
+     * @throws FileIOException if the file can not be written
+     */
+    static void write(const std::string &filename,
+        const std::vector<uint8_t> &rgb, int width, int height);
+
+    /**
+     * @brief Writes packed RGB bytes as a binary (P6) PPM file
+     * @throws FileIOException if the file can not be written
+     */
+    static void writePPM(const std::string &filename,
+        const std::vector<uint8_t> &rgb, int width, int height);
+
+    /**
+     * @brief Writes packed RGB bytes as an 8-bit RGB PNG file
+     * The image data is stored in uncompressed deflate blocks, so no zlib is needed
+     * @throws FileIOException if the file can not be written
+     */
+    static void writePNG(const std::string &filename,
+        const std::vector<uint8_t> &rgb, int width, int height);
+};
+
+}  // namespace RayTracer
+
+#endif  // SRC_RENDERER_IMAGEWRITER_IMAGEWRITER_HPP_
@@ -6,121 +6,319 @@
 */
 
 #include "Renderer.hpp"
-#include <thread>
+#include "ImageWriter/ImageWriter.hpp"
 #include <vector>
-#include <mutex>
 #include <cmath>
 #include <algorithm>
-#include <atomic>
 #include <memory>
+#include <optional>
+#include <string>
 // Suppression de l'include direct de SupersamplingPostProcess
 
 namespace RayTracer {
 
-Renderer::Renderer(std::shared_ptr<IDisplayManager> displayManager)
-    : _displayManager(displayManager) {
+namespace {
+
+bool sameVector(const Math::Vector3D &a, const Math::Vector3D &b) {
+    return a.X == b.X && a.Y == b.Y && a.Z == b.Z;
+}
+
+bool samePoint(const Math::Point3D &a, const Math::Point3D &b) {
+    return a.X == b.X && a.Y == b.Y && a.Z == b.Z;
+}
+
+}  // namespace
+
+Renderer::Renderer(unsigned int threadCount)
+    : _displayManager(nullptr),
+      _threadPool(std::make_unique<RenderThreadPool>(threadCount)) {
+}
+
+Renderer::Renderer(std::shared_ptr<IDisplayManager> displayManager, unsigned int threadCount)
+    : _displayManager(displayManager),
+      _threadPool(std::make_unique<RenderThreadPool>(threadCount)) {
 }
 
 Renderer::~Renderer() {
 }
 
+void Renderer::setThreadCount(unsigned int threadCount) {
+    if (RenderThreadPool::resolveThreadCount(threadCount) == getThreadCount())
+        return;
+    _threadPool.reset();
+    _threadPool = std::make_unique<RenderThreadPool>(threadCount);
+}
+
+void Renderer::setProgressive(bool progressive) {
+    _progressive = progressive;
+    resetAccumulation();
+}
+
+void Renderer::setSamplerPattern(Sampler::Pattern pattern) {
+    _samplerPattern = pattern;
+    resetAccumulation();
+}
+
+void Renderer::resetAccumulation() {
+    _accumulatedSamples = 0;
+}
+
 void Renderer::drawScene(const Scene& scene, const Camera& camera, const bool lowRender) {
     auto windowSize = _displayManager->getWindowSize();
     int imageWidth = windowSize.x;
     int imageHeight = windowSize.y;
 
+    if (_progressive && !lowRender) {
+        drawProgressive(scene, camera, imageWidth, imageHeight);
+        return;
+    }
+    resetAccumulation();
+    renderFrame(scene, camera, imageWidth, imageHeight, lowRender);
+    presentFrame(scene, _rawColorBuffer, imageWidth, imageHeight);
+}
+
+bool Renderer::isAccumulationValid(const Scene& scene, const Camera& camera,
+int imageWidth, int imageHeight) const {
+    return _accumulatedSamples > 0
+        && imageWidth == _accumulationWidth && imageHeight == _accumulationHeight
+        && scene.getRevision() == _accumulationRevision
+        && samePoint(camera.origin, _accumulationCamera.origin)
+        && samePoint(camera.screen.origin, _accumulationCamera.screen.origin)
+        && sameVector(camera.screen.bottom_side, _accumulationCamera.screen.bottom_side)
+        && sameVector(camera.screen.left_side, _accumulationCamera.screen.left_side);
+}
+
+void Renderer::drawProgressive(const Scene& scene, const Camera& camera,
+int imageWidth, int imageHeight) {
+    if (!isAccumulationValid(scene, camera, imageWidth, imageHeight)) {
+        _accumulationBuffer.assign(imageWidth * imageHeight, Math::Vector3D());
+        _accumulatedSamples = 0;
+        _accumulationWidth = imageWidth;
+        _accumulationHeight = imageHeight;
+        _accumulationRevision = scene.getRevision();
+        _accumulationCamera = camera;
+    } else if (_accumulatedSamples >= _maxProgressiveSamples) {
+        // Converged: show the last image again instead of tracing the same frame
+        _displayManager->beginFrame();
+        _displayManager->drawImage(_pixelBuffer, imageWidth, imageHeight);
+        _displayManager->endFrame();
+        return;
+    }
+
+    const std::vector<Math::Vector3D>& sampleBuffer =
+        renderFrame(scene, camera, imageWidth, imageHeight, false, _accumulatedSamples);
+    _accumulatedSamples++;
+
+    double weight = 1.0 / _accumulatedSamples;
+    _averageBuffer.resize(_accumulationBuffer.size());
+    for (size_t i = 0; i < _accumulationBuffer.size(); ++i) {
+        _accumulationBuffer[i] += sampleBuffer[i];
+        _averageBuffer[i] = _accumulationBuffer[i] * weight;
+    }
+    presentFrame(scene, _averageBuffer, imageWidth, imageHeight);
+}
+
+ParallelFor Renderer::threadPoolFor() const {
+    return [this](int count, const std::function<void(int)> &task) {
+        _threadPool->run(count, task);
+    };
+}
+
+void Renderer::presentFrame(const Scene& scene, std::vector<Math::Vector3D>& colors,
+int imageWidth, int imageHeight) {
+    _pixelBuffer.resize(imageWidth * imageHeight);
+
+    scene.applyPostProcessing(colors, _postProcessScratch, imageWidth, imageHeight,
+        threadPoolFor(), [&](int firstIndex, int count) {
+        for (int index = firstIndex; index < firstIndex + count; ++index) {
+            const Math::Vector3D& color = colors[index];
+
+            uint8_t r = static_cast<uint8_t>(255.999 * std::sqrt(std::max(0.0, std::min(1.0, color.X))));
+            uint8_t g = static_cast<uint8_t>(255.999 * std::sqrt(std::max(0.0, std::min(1.0, color.Y))));
+            uint8_t b = static_cast<uint8_t>(255.999 * std::sqrt(std::max(0.0, std::min(1.0, color.Z))));
+
+            _pixelBuffer[index] = {r, g, b, 255};
+        }
+    });
+
+    _displayManager->beginFrame();
+    _displayManager->drawImage(_pixelBuffer, imageWidth, imageHeight);
+    _displayManager->endFrame();
+}
+
+void Renderer::renderToFile(const Scene& scene, const Camera& camera,
+int imageWidth, int imageHeight, const std::string& filename) {
+    renderFrame(scene, camera, imageWidth, imageHeight);
+    // Bytes are packed in the last post-processing pass, while each block is in cache
+    std::vector<uint8_t> rgb(_rawColorBuffer.size() * 3);
+    scene.applyPostProcessing(_rawColorBuffer, _postProcessScratch, imageWidth, imageHeight,
+        threadPoolFor(), [&](int firstIndex, int count) {
+        ImageWriter::toRGB8(_rawColorBuffer.data() + firstIndex, count, rgb.data() + 3 * firstIndex);
+    });
+
+    ImageWriter::write(filename, rgb, imageWidth, imageHeight);
+}
+
+const std::vector<Math::Vector3D>& Renderer::renderFrame(const Scene& scene,
+const Camera& camera, int imageWidth, int imageHeight, const bool lowRender, int sampleIndex) {
     const_cast<Scene&>(scene).setImageDimensions(imageWidth, imageHeight);
+    // Primary rays carry the cone of their pixel, textures filter over what it
+    // covers and implicit surfaces stop refining below half of it
+    double pixelSpread = camera.pixelSpread(imageWidth);
 
-    std::vector<Math::Vector3D> rawColorBuffer(imageWidth * imageHeight);
-    std::vector<color_t> pixelBuffer(imageWidth * imageHeight);
+    PrimaryView view;
+    view.eye = camera.origin;
+    view.screenOrigin = camera.screen.origin;
+    view.screenU = camera.screen.bottom_side;
+    view.screenV = camera.screen.left_side;
+    view.width = imageWidth;
+    view.height = imageHeight;
+    scene.prepareView(view);
 
-    const int tileSize = 32;
+    _rawColorBuffer.resize(imageWidth * imageHeight);
 
-    int numTilesX = (imageWidth + tileSize - 1) / tileSize;
-    int numTilesY = (imageHeight + tileSize - 1) / tileSize;
+    int numTilesX = (imageWidth + TILE_SIZE - 1) / TILE_SIZE;
+    int numTilesY = (imageHeight + TILE_SIZE - 1) / TILE_SIZE;
     int totalTiles = numTilesX * numTilesY;
 
-    std::atomic<int> nextTileIndex(0);
-
     int samplesPerPixel = 1;
+    double contrastThreshold = 0.0;
     for (const auto& postProcess : scene.getPostProcessEffects()) {
         if (postProcess->getTypeName() == "supersampling") {
             samplesPerPixel = static_cast<int>(postProcess->getParameter("samples"));
+            contrastThreshold = postProcess->getParameter("threshold");
             break;
         }
     }
-    auto renderTiles = [&]() {
-        while (true) {
-            int tileIndex = nextTileIndex.fetch_add(1);
-            if (tileIndex >= totalTiles)
-                break;
-
-            int tileY = tileIndex / numTilesX;
-            int tileX = tileIndex % numTilesX;
-
-            int startX = tileX * tileSize;
-            int startY = tileY * tileSize;
-            int endX = std::min(startX + tileSize, imageWidth);
-            int endY = std::min(startY + tileSize, imageHeight);
-
-            for (int y = startY; y < endY; ++y) {
-                if (!(y % 5 == 0) && lowRender)
-                    continue;
-
-                for (int x = startX; x < endX; ++x) {
-                    if (!(x % 5 == 0) && lowRender)
-                        continue;
-
-                    double u = static_cast<double>(x) / (imageWidth - 1);
-                    double v = static_cast<double>((imageHeight - 1) - y) / (imageHeight - 1);
+    // Single ray pixels are traced by small blocks sharing the hierarchy traversal
+    bool usePackets = !lowRender && (sampleIndex > 0 || samplesPerPixel <= 1);
+    // The first progressive sample goes through the pixel center, the next ones follow the sequence
+    auto pixelRay = [&](Sampler &sampler, int x, int y) {
+        double u = static_cast<double>(x) / (imageWidth - 1);
+        double v = static_cast<double>((imageHeight - 1) - y) / (imageHeight - 1);
+        if (sampleIndex > 0) {
+            sampler.startPixel(x, y);
+            sampler.startSample(sampleIndex - 1);
+            Math::Vector2D jitter = sampler.get2D();
+            u += (jitter.U - 0.5) / (imageWidth - 1);
+            v += (jitter.V - 0.5) / (imageHeight - 1);
+        }
+        return camera.ray(u, v, pixelSpread);
+    };
+    auto renderPacket = [&](int startX, int startY, int endX, int endY) {
+        Sampler sampler(_samplerPattern, _maxProgressiveSamples);
+        RayPacket packet;
+        Ray rays[RayPacket::SIZE];
+        int pixels[RayPacket::SIZE];
+        std::optional<HitInfo> hits[RayPacket::SIZE];
 
-                    Math::Vector3D pixelColor;
-                    if (lowRender) {
-                        pixelColor = scene.computeColor(camera.ray(u, v), true);
-                    } else if (samplesPerPixel > 1) {
-                        pixelColor = camera.supersampleRay(u, v, scene, samplesPerPixel);
-                    } else {
-                        pixelColor = scene.computeColor(camera.ray(u, v), false);
-                    }
+        packet.count = 0;
+        for (int y = startY; y < endY; ++y) {
+            for (int x = startX; x < endX; ++x) {
+                rays[packet.count] = pixelRay(sampler, x, y);
+                pixels[packet.count] = y * imageWidth + x;
+                packet.set(packet.count, rays[packet.count]);
+                packet.count++;
+            }
+        }
+        scene.tracePacket(packet, hits);
+        for (int lane = 0; lane < packet.count; ++lane)
+            _rawColorBuffer[pixels[lane]] = scene.computeColorFromHit(rays[lane], hits[lane]);
+    };
+    // Pilot samples for the whole tile first, so each pixel can be compared to its neighbours
+    auto renderAdaptive = [&](int startX, int startY, int endX, int endY) {
+        int tileWidth = endX - startX;
+        std::vector<PixelSamples> pilots((endY - startY) * tileWidth);
+        Sampler sampler(_samplerPattern, samplesPerPixel);
+        auto pixelUV = [&](int x, int y, double &u, double &v) {
+            u = static_cast<double>(x) / (imageWidth - 1);
+            v = static_cast<double>((imageHeight - 1) - y) / (imageHeight - 1);
+        };
 
-                    rawColorBuffer[y * imageWidth + x] = pixelColor;
+        for (int y = startY; y < endY; ++y) {
+            for (int x = startX; x < endX; ++x) {
+                double u, v;
+                pixelUV(x, y, u, v);
+                sampler.startPixel(x, y);
+                pilots[(y - startY) * tileWidth + x - startX] =
+                    camera.pilotSamples(u, v, scene, samplesPerPixel, sampler);
+            }
+        }
+        for (int y = startY; y < endY; ++y) {
+            for (int x = startX; x < endX; ++x) {
+                const PixelSamples &pilot = pilots[(y - startY) * tileWidth + x - startX];
+                bool converged = pilot.contrast() < contrastThreshold;
+                // Neighbours outside the tile are not traced yet, edges along tiles rely on the pilot spread
+                if (converged && x > startX)
+                    converged = pilot.contrastWith(*(&pilot - 1)) < contrastThreshold;
+                if (converged && x + 1 < endX)
+                    converged = pilot.contrastWith(*(&pilot + 1)) < contrastThreshold;
+                if (converged && y > startY)
+                    converged = pilot.contrastWith(*(&pilot - tileWidth)) < contrastThreshold;
+                if (converged && y + 1 < endY)
+                    converged = pilot.contrastWith(*(&pilot + tileWidth)) < contrastThreshold;
+                if (converged) {
+                    _rawColorBuffer[y * imageWidth + x] = pilot.mean();
+                    continue;
                 }
+                double u, v;
+                pixelUV(x, y, u, v);
+                sampler.startPixel(x, y);
+                _rawColorBuffer[y * imageWidth + x] =
+                    camera.refineSamples(u, v, scene, samplesPerPixel, pilot, sampler);
             }
         }
     };
+    auto renderTile = [&](int tileIndex) {
+        int tileY = tileIndex / numTilesX;
+        int tileX = tileIndex % numTilesX;
 
-    unsigned int numThreads = std::thread::hardware_concurrency();
-    numThreads = std::max(2u, std::min(numThreads, 16u));
+        int startX = tileX * TILE_SIZE;
+        int startY = tileY * TILE_SIZE;
+        int endX = std::min(startX + TILE_SIZE, imageWidth);
+        int endY = std::min(startY + TILE_SIZE, imageHeight);
 
-    std::vector<std::thread> threads;
-    threads.reserve(numThreads);
-    for (unsigned int i = 0; i < numThreads; ++i) {
-        threads.emplace_back(renderTiles);
-    }
-
-    for (auto& thread : threads) {
-        thread.join();
-    }
-
-    std::vector<Math::Vector3D> processedColorBuffer =
-        scene.applyPostProcessingToFrameBuffer(rawColorBuffer, imageWidth, imageHeight);
+        if (usePackets) {
+            for (int y = startY; y < endY; y += PACKET_HEIGHT) {
+                for (int x = startX; x < endX; x += PACKET_WIDTH)
+                    renderPacket(x, y, std::min(x + PACKET_WIDTH, endX),
+                        std::min(y + PACKET_HEIGHT, endY));
+            }
+            return;
+        }
+        if (!lowRender && samplesPerPixel > 1 && contrastThreshold > 0.0) {
+            renderAdaptive(startX, startY, endX, endY);
+            return;
+        }
+        Sampler sampler(_samplerPattern, samplesPerPixel);
+        for (int y = startY; y < endY; ++y) {
+            for (int x = startX; x < endX; ++x) {
+                // The buffer is reused, so pixels skipped in low render are cleared
+                if (lowRender && (x % 5 != 0 || y % 5 != 0)) {
+                    _rawColorBuffer[y * imageWidth + x] = Math::Vector3D();
+                    continue;
+                }
 
-    for (int y = 0; y < imageHeight; ++y) {
-        for (int x = 0; x < imageWidth; ++x) {
-            int index = y * imageWidth + x;
-            const Math::Vector3D& color = processedColorBuffer[index];
+                double u = static_cast<double>(x) / (imageWidth - 1);
+                double v = static_cast<double>((imageHeight - 1) - y) / (imageHeight - 1);
 
-            uint8_t r = static_cast<uint8_t>(255.999 * std::sqrt(std::max(0.0, std::min(1.0, color.X))));
-            uint8_t g = static_cast<uint8_t>(255.999 * std::sqrt(std::max(0.0, std::min(1.0, color.Y))));
-            uint8_t b = static_cast<uint8_t>(255.999 * std::sqrt(std::max(0.0, std::min(1.0, color.Z))));
+                Math::Vector3D pixelColor;
+                if (lowRender) {
+                    pixelColor = scene.computeColor(camera.ray(u, v), true);
+                } else if (samplesPerPixel > 1) {
+                    sampler.startPixel(x, y);
+                    pixelColor = camera.supersampleRay(u, v, scene, samplesPerPixel, sampler);
+                } else {
+                    pixelColor = scene.computeColor(camera.ray(u, v, pixelSpread), false);
+                }
 
-            pixelBuffer[index] = {r, g, b, 255};
+                _rawColorBuffer[y * imageWidth + x] = pixelColor;
+            }
         }
-    }
+    };
 
-    _displayManager->beginFrame();
-    _displayManager->drawImage(pixelBuffer, imageWidth, imageHeight);
-    _displayManager->endFrame();
+    _threadPool->run(totalTiles, renderTile);
+    return _rawColorBuffer;
 }
 
 }  // namespace RayTracer
@@ -7,24 +7,122 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "IRenderer.hpp"
 #include "../DisplayManager/IDisplayManager.hpp"
+#include "ThreadPool/RenderThreadPool.hpp"
+#include "Sampler/Sampler.hpp"
 
 namespace RayTracer {
 
 class Renderer : public IRenderer {
   public:
-    explicit Renderer(std::shared_ptr<IDisplayManager> displayManager);
+    /**
+     * @brief Creates a renderer without display, for file output
+     * @param threadCount Number of render threads, 0 to use every hardware thread
+     */
+    explicit Renderer(unsigned int threadCount = 0);
+    explicit Renderer(std::shared_ptr<IDisplayManager> displayManager,
+                      unsigned int threadCount = 0);
     ~Renderer();
 
+    /**
+     * @brief Restarts the render threads with a new count, 0 to use every hardware thread
+     */
+    void setThreadCount(unsigned int threadCount);
+    unsigned int getThreadCount() const { return _threadPool->getThreadCount(); }
+
+    /**
+     * @brief Renders the scene to the display
+     * Unless lowRender is set, progressive mode adds one sample per pixel each
+     * frame while the camera and scene stay unchanged, and redraws the
+     * converged image without tracing once the sample budget is reached
+     */
     void drawScene( const Scene& scene,
                     const Camera& camera,
                     const bool lowRender = false ) override;
 
+    /**
+     * @brief Enables or disables progressive accumulation in drawScene
+     */
+    void setProgressive(bool progressive);
+
+    /**
+     * @brief Sets how many samples per pixel progressive mode accumulates before stopping
+     */
+    void setMaxProgressiveSamples(int samples) { _maxProgressiveSamples = std::max(1, samples); }
+
+    /**
+     * @brief Sets the sequence placing supersampling and progressive samples in the pixels
+     */
+    void setSamplerPattern(Sampler::Pattern pattern);
+    Sampler::Pattern getSamplerPattern() const { return _samplerPattern; }
+
+    /**
+     * @brief Discards the accumulated samples, the next frame starts from scratch
+     */
+    void resetAccumulation();
+
+    /**
+     * @brief Renders the scene on the render threads using the tile scheduler
+     * @param sampleIndex 0 traces through the pixel centers, higher indices jitter
+     * one ray per pixel for progressive accumulation
+     * @return The raw colors, row by row from the top of the image, before post-processing.
+     * The buffer is reused by the next call
+     */
+    const std::vector<Math::Vector3D>& renderFrame( const Scene& scene,
+                                                    const Camera& camera,
+                                                    int imageWidth,
+                                                    int imageHeight,
+                                                    const bool lowRender = false,
+                                                    int sampleIndex = 0 );
+
+    /**
+     * @brief Renders and post-processes the scene, then writes it as PNG (.png) or binary PPM
+     * Does not need a display manager
+     */
+    void renderToFile( const Scene& scene,
+                       const Camera& camera,
+                       int imageWidth,
+                       int imageHeight,
+                       const std::string& filename );
+
   private:
+    static constexpr int TILE_SIZE = 32;
+    // Pixel block traced as one ray packet, PACKET_WIDTH * PACKET_HEIGHT <= RayPacket::SIZE
+    static constexpr int PACKET_WIDTH = 4;
+    static constexpr int PACKET_HEIGHT = 2;
+    static constexpr int DEFAULT_MAX_PROGRESSIVE_SAMPLES = 64;
+
+    void drawProgressive(const Scene& scene, const Camera& camera, int imageWidth, int imageHeight);
+    bool isAccumulationValid(const Scene& scene, const Camera& camera, int imageWidth, int imageHeight) const;
+    // Post-processes colors in place, then converts and draws them
+    void presentFrame(const Scene& scene, std::vector<Math::Vector3D>& colors,
+                      int imageWidth, int imageHeight);
+    // Runs post-processing work on the render threads
+    ParallelFor threadPoolFor() const;
+
     std::shared_ptr<IDisplayManager> _displayManager;
+    std::unique_ptr<RenderThreadPool> _threadPool;
+    std::vector<Math::Vector3D> _rawColorBuffer;
+    std::vector<Math::Vector3D> _postProcessScratch;
+    std::vector<color_t> _pixelBuffer;
+
+    bool _progressive = true;
+    int _maxProgressiveSamples = DEFAULT_MAX_PROGRESSIVE_SAMPLES;
+    Sampler::Pattern _samplerPattern = Sampler::Pattern::Sobol;
+    std::vector<Math::Vector3D> _accumulationBuffer;
+    std::vector<Math::Vector3D> _averageBuffer;
+    int _accumulatedSamples = 0;
+    int _accumulationWidth = 0;
+    int _accumulationHeight = 0;
+    uint64_t _accumulationRevision = 0;
+    Camera _accumulationCamera;
 };
 
 }  // namespace RayTracer
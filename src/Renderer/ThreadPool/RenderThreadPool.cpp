@@ -0,0 +1,123 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** RenderThreadPool - persistent workers with work-stealing task queues
+*/
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "Renderer/ThreadPool/RenderThreadPool.hpp"
+
+namespace RayTracer {
+
+RenderThreadPool::RenderThreadPool(unsigned int threadCount) {
+    unsigned int count = resolveThreadCount(threadCount);
+
+    for (unsigned int i = 0; i < count; i++)
+        _queues.push_back(std::make_unique<TaskQueue>());
+    _workers.reserve(count);
+    for (unsigned int i = 0; i < count; i++)
+        _workers.emplace_back(&RenderThreadPool::workerLoop, this, i);
+}
+
+RenderThreadPool::~RenderThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _wakeWorkers.notify_all();
+    for (auto &worker : _workers)
+        worker.join();
+}
+
+unsigned int RenderThreadPool::resolveThreadCount(unsigned int threadCount) {
+    if (threadCount > 0)
+        return threadCount;
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+void RenderThreadPool::run(int taskCount, const std::function<void(int)> &task) {
+    if (taskCount <= 0)
+        return;
+    size_t queueCount = _queues.size();
+
+    // Contiguous ranges keep neighbouring tasks on the same worker
+    for (size_t i = 0; i < queueCount; i++) {
+        int begin = static_cast<int>(static_cast<int64_t>(taskCount) * i / queueCount);
+        int end = static_cast<int>(static_cast<int64_t>(taskCount) * (i + 1) / queueCount);
+        std::lock_guard<std::mutex> lock(_queues[i]->mutex);
+        for (int t = begin; t < end; t++)
+            _queues[i]->tasks.push_back(t);
+    }
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    _task = &task;
+    _error = nullptr;
+    _activeWorkers = static_cast<unsigned int>(_workers.size());
+    _batch++;
+    _wakeWorkers.notify_all();
+    _batchDone.wait(lock, [this] { return _activeWorkers == 0; });
+    _task = nullptr;
+    if (_error)
+        std::rethrow_exception(_error);
+}
+
+bool RenderThreadPool::popTask(unsigned int index, int &task) {
+    {
+        TaskQueue &own = *_queues[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = own.tasks.front();
+            own.tasks.pop_front();
+            return true;
+        }
+    }
+    for (size_t offset = 1; offset < _queues.size(); offset++) {
+        TaskQueue &victim = *_queues[(index + offset) % _queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = victim.tasks.back();
+            victim.tasks.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+void RenderThreadPool::workerLoop(unsigned int index) {
+    uint64_t seenBatch = 0;
+
+    while (true) {
+        const std::function<void(int)> *task = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _wakeWorkers.wait(lock, [&] { return _stopping || _batch != seenBatch; });
+            if (_stopping)
+                return;
+            seenBatch = _batch;
+            task = _task;
+        }
+
+        int taskIndex = 0;
+        while (popTask(index, taskIndex)) {
+            try {
+                (*task)(taskIndex);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (!_error)
+                    _error = std::current_exception();
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (--_activeWorkers == 0)
+            _batchDone.notify_one();
+    }
+}
+
+}  // namespace RayTracer
@@ -0,0 +1,81 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** RenderThreadPool - persistent workers with work-stealing task queues
+*/
+
+#ifndef SRC_RENDERER_THREADPOOL_RENDERTHREADPOOL_HPP_
+    #define SRC_RENDERER_THREADPOOL_RENDERTHREADPOOL_HPP_
+    #include <condition_variable>
+    #include <cstdint>
+    #include <deque>
+    #include <exception>
+    #include <functional>
+    #include <memory>
+    #include <mutex>
+    #include <thread>
+    #include <vector>
+
+namespace RayTracer {
+
+/**
+ * @brief Pool of render threads kept alive between frames
+ *
+ * Each worker owns a queue seeded with a contiguous range of tasks, so
+ * neighbouring tiles stay on the same core. A worker pops from the front
+ * of its own queue and, once empty, steals from the back of the others.
+ */
+class RenderThreadPool {
+ public:
+    /**
+     * @brief Starts the workers
+     * @param threadCount Number of workers, 0 to use every hardware thread
+     */
+    explicit RenderThreadPool(unsigned int threadCount = 0);
+    ~RenderThreadPool();
+
+    RenderThreadPool(const RenderThreadPool &) = delete;
+    RenderThreadPool &operator=(const RenderThreadPool &) = delete;
+
+    /**
+     * @brief Runs task(0) to task(taskCount - 1) on the workers and waits for all of them
+     * The first exception thrown by a task is rethrown once every task is done
+     */
+    void run(int taskCount, const std::function<void(int)> &task);
+
+    /**
+     * @brief Gets the number of workers
+     */
+    unsigned int getThreadCount() const { return static_cast<unsigned int>(_workers.size()); }
+
+    /**
+     * @brief Resolves a requested thread count, 0 meaning every hardware thread
+     */
+    static unsigned int resolveThreadCount(unsigned int threadCount);
+
+ private:
+    struct TaskQueue {
+        std::mutex mutex;
+        std::deque<int> tasks;
+    };
+
+    void workerLoop(unsigned int index);
+    bool popTask(unsigned int index, int &task);
+
+    std::vector<std::thread> _workers;
+    std::vector<std::unique_ptr<TaskQueue>> _queues;
+    const std::function<void(int)> *_task = nullptr;
+    std::exception_ptr _error;
+    std::mutex _mutex;
+    std::condition_variable _wakeWorkers;
+    std::condition_variable _batchDone;
+    uint64_t _batch = 0;
+    unsigned int _activeWorkers = 0;
+    bool _stopping = false;
+};
+
+}  // namespace RayTracer
+
+#endif  // SRC_RENDERER_THREADPOOL_RENDERTHREADPOOL_HPP_
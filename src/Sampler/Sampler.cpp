@@ -0,0 +1,186 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** Sampler implementation
+*/
+#include <algorithm>
+#include <cmath>
+#include "Sampler/Sampler.hpp"
+
+namespace RayTracer {
+
+namespace {
+
+uint32_t mix(uint32_t value) {
+    value ^= value >> 16;
+    value *= 0x7feb352du;
+    value ^= value >> 15;
+    value *= 0x846ca68bu;
+    value ^= value >> 16;
+    return value;
+}
+
+uint32_t mix(uint32_t a, uint32_t b) {
+    return mix(a ^ mix(b + 0x9e3779b9u));
+}
+
+// Maps 32 random bits to [0, 1)
+double toUnit(uint32_t bits) {
+    return bits * (1.0 / 4294967296.0);
+}
+
+// Wraps a value of [0, 2) back to [0, 1)
+double wrap(double value) {
+    return value >= 1.0 ? value - 1.0 : value;
+}
+
+uint32_t reverseBits(uint32_t value) {
+    value = (value << 16) | (value >> 16);
+    value = ((value & 0x00ff00ffu) << 8) | ((value & 0xff00ff00u) >> 8);
+    value = ((value & 0x0f0f0f0fu) << 4) | ((value & 0xf0f0f0f0u) >> 4);
+    value = ((value & 0x33333333u) << 2) | ((value & 0xccccccccu) >> 2);
+    value = ((value & 0x55555555u) << 1) | ((value & 0xaaaaaaaau) >> 1);
+    return value;
+}
+
+// Hash based Owen scrambling: each bit is flipped depending on the bits above it
+uint32_t owenScramble(uint32_t value, uint32_t seed) {
+    value = reverseBits(value);
+    value ^= value * 0x3d20adeau;
+    value += seed;
+    value *= (seed >> 16) | 1u;
+    value ^= value * 0x05526c56u;
+    value ^= value * 0x53a22864u;
+    return reverseBits(value);
+}
+
+// Second dimension of the Sobol sequence, the first is reverseBits(index)
+uint32_t sobolSecond(uint32_t index) {
+    uint32_t result = 0;
+    for (uint32_t direction = 1u << 31; index != 0; index >>= 1, direction ^= direction >> 1) {
+        if (index & 1u)
+            result ^= direction;
+    }
+    return result;
+}
+
+double radicalInverse(uint32_t base, uint32_t index) {
+    double inverseBase = 1.0 / base;
+    double factor = inverseBase;
+    double result = 0.0;
+
+    while (index > 0) {
+        result += (index % base) * factor;
+        index /= base;
+        factor *= inverseBase;
+    }
+    return std::min(result, 1.0 - 1e-16);
+}
+
+constexpr uint32_t HALTON_BASES[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53};
+
+}  // namespace
+
+Sampler::Sampler(Pattern pattern, int samplesPerPixel)
+    : _pattern(pattern), _samplesPerPixel(std::max(1, samplesPerPixel)) {}
+
+void Sampler::startPixel(int x, int y, uint32_t frame) {
+    _x = x;
+    _y = y;
+    _frame = frame;
+    _seed = mix(static_cast<uint32_t>(x), mix(static_cast<uint32_t>(y), frame));
+    startSample(0);
+}
+
+void Sampler::startSample(int index) {
+    _index = static_cast<uint32_t>(std::max(0, index));
+    _dimension = 0;
+}
+
+double Sampler::get1D() {
+    if (_pattern == Pattern::Stratified)
+        return stratified(_dimension++, static_cast<uint32_t>(_samplesPerPixel));
+    return sample(_dimension++);
+}
+
+Math::Vector2D Sampler::get2D() {
+    uint32_t dimension = _dimension;
+
+    _dimension += 2;
+    if (_pattern == Pattern::Stratified) {
+        uint32_t side = std::max(1u, static_cast<uint32_t>(std::sqrt(_samplesPerPixel)));
+        uint32_t strata = side * side;
+        uint32_t cell = _index % strata;
+        uint32_t shift = mix(_seed, mix(_index / strata, dimension ^ 0x27d4eb2fu));
+        // Each run of side samples walks a diagonal of the grid, shifted per pixel,
+        // so the first samples of a pixel already cover every row and column
+        uint32_t column = (cell % side + shift) % side;
+        uint32_t row = (cell % side + cell / side + (shift >> 16)) % side;
+        double jitterU = toUnit(mix(_seed, mix(_index, dimension)));
+        double jitterV = toUnit(mix(_seed, mix(_index, dimension + 1)));
+        return Math::Vector2D((column + jitterU) / side, (row + jitterV) / side);
+    }
+    return Math::Vector2D(sample(dimension), sample(dimension + 1));
+}
+
+std::optional<Sampler::Pattern> Sampler::patternFromName(const std::string &name) {
+    if (name == "independent")
+        return Pattern::Independent;
+    if (name == "stratified")
+        return Pattern::Stratified;
+    if (name == "halton")
+        return Pattern::Halton;
+    if (name == "sobol")
+        return Pattern::Sobol;
+    if (name == "bluenoise")
+        return Pattern::BlueNoise;
+    return std::nullopt;
+}
+
+double Sampler::sample(uint32_t dimension) const {
+    switch (_pattern) {
+        case Pattern::Stratified:
+            return stratified(dimension, static_cast<uint32_t>(_samplesPerPixel));
+        case Pattern::Halton: {
+            constexpr uint32_t bases = sizeof(HALTON_BASES) / sizeof(HALTON_BASES[0]);
+            double shift = toUnit(mix(_seed, dimension));
+            return wrap(radicalInverse(HALTON_BASES[dimension % bases], _index) + shift);
+        }
+        case Pattern::Sobol: {
+            // Both dimensions of a pair walk the same shuffled index
+            uint32_t index = owenScramble(_index, mix(_seed, dimension / 2));
+            uint32_t bits = dimension % 2 == 0 ? reverseBits(index) : sobolSecond(index);
+            return toUnit(owenScramble(bits, mix(_seed ^ 0xa511e9b3u, dimension)));
+        }
+        case Pattern::BlueNoise:
+            return blueNoise(dimension);
+        case Pattern::Independent:
+        default:
+            return toUnit(mix(_seed, mix(_index, dimension)));
+    }
+}
+
+// Sample index falls in one of strata cells, shuffled per pixel, jittered inside it
+double Sampler::stratified(uint32_t dimension, uint32_t strata) const {
+    uint32_t round = _index / strata;
+    uint32_t cell = (_index + mix(_seed, mix(round, dimension ^ 0x27d4eb2fu))) % strata;
+    double jitter = toUnit(mix(_seed, mix(_index, dimension)));
+    return (cell + jitter) / strata;
+}
+
+double Sampler::blueNoise(uint32_t dimension) const {
+    // Interleaved gradient noise: neighbouring pixels get far apart values
+    double x = _x + 5.588238 * _frame + 19.0 * dimension;
+    double y = _y + 5.588238 * _frame + 47.0 * dimension;
+    double inner = 0.06711056 * x + 0.00583715 * y;
+    double noise = 52.9829189 * (inner - std::floor(inner));
+    noise -= std::floor(noise);
+    // Successive samples step by the R2 sequence, low discrepancy on each axis
+    double step = dimension % 2 == 0 ? 0.7548776662466927 : 0.5698402909980532;
+    double value = noise + step * _index;
+    return std::min(value - std::floor(value), 1.0 - 1e-16);
+}
+
+}  // namespace RayTracer
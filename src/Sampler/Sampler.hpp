@@ -0,0 +1,89 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** Sampler - deterministic sample sequences for stochastic effects
+*/
+
+#ifndef SRC_SAMPLER_SAMPLER_HPP_
+    #define SRC_SAMPLER_SAMPLER_HPP_
+    #include <cstdint>
+    #include <optional>
+    #include <string>
+    #include "Math/Vector2D/Vector2D.hpp"
+
+namespace RayTracer {
+
+/**
+ * @brief Sample points in [0, 1)^n for one pixel at a time
+ *
+ * A sampler only holds the state of the pixel and sample being drawn, so
+ * each render thread uses its own and nothing is shared between them.
+ * The values only depend on the pixel, the frame, the sample index and the
+ * dimension, which makes renders reproducible whatever the thread count.
+ * Each call to get1D() or get2D() consumes the next dimensions of the
+ * current sample; effects should draw them in a fixed order.
+ */
+class Sampler {
+ public:
+    enum class Pattern {
+        // Hashed white noise, the reference the others improve on
+        Independent,
+        // One jittered sample per cell of a samplesPerPixel grid
+        Stratified,
+        // Halton sequence with a random shift per pixel
+        Halton,
+        // Owen scrambled Sobol sequence, 2D pairs stay (0, 2)-nets
+        Sobol,
+        // Interleaved gradient noise across pixels, golden ratio steps across samples
+        BlueNoise
+    };
+
+    /**
+     * @param samplesPerPixel Samples a pixel takes, Stratified splits the pixel
+     * into that many cells
+     */
+    explicit Sampler(Pattern pattern = Pattern::Sobol, int samplesPerPixel = 1);
+
+    Pattern getPattern() const { return _pattern; }
+    int getSamplesPerPixel() const { return _samplesPerPixel; }
+
+    /**
+     * @brief Restarts the sequences for pixel (x, y) of frame, at sample 0
+     */
+    void startPixel(int x, int y, uint32_t frame = 0);
+
+    /**
+     * @brief Moves to sample index of the current pixel, at dimension 0
+     */
+    void startSample(int index);
+
+    // Next dimension of the current sample
+    double get1D();
+    // Next two dimensions of the current sample, stratified together
+    Math::Vector2D get2D();
+
+    /**
+     * @brief Pattern named independent, stratified, halton, sobol or bluenoise
+     */
+    static std::optional<Pattern> patternFromName(const std::string &name);
+
+ private:
+    double sample(uint32_t dimension) const;
+    double stratified(uint32_t dimension, uint32_t strata) const;
+    double blueNoise(uint32_t dimension) const;
+
+    Pattern _pattern;
+    int _samplesPerPixel;
+    int _x = 0;
+    int _y = 0;
+    uint32_t _frame = 0;
+    uint32_t _seed = 0;
+    uint32_t _index = 0;
+    uint32_t _dimension = 0;
+};
+
+}  // namespace RayTracer
+
+#endif  // SRC_SAMPLER_SAMPLER_HPP_
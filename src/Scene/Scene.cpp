@@ -13,6 +13,9 @@
 #include <memory>
 #include <typeinfo>
 #include <map>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include "Scene/Scene.hpp"
 #include "Light/PointLight/PointLight.hpp"
 #include "Light/DirectionalLight/DirectionalLight.hpp"
@@ -20,6 +23,35 @@
 
 namespace RayTracer {
 
+namespace {
+
+/**
+ * @brief Primitive that last blocked a shadow ray of a light on this thread
+ * Shadow rays of neighbouring pixels are mostly blocked by the same
+ * primitive, testing it first often skips the traversal. An entry is only
+ * used in the scene revision it was found in, revisions are unique across
+ * scenes so the primitive is still alive then.
+ */
+struct LastOccluder {
+    uint64_t revision = 0;
+    const ILight *light = nullptr;
+    IPrimitive *primitive = nullptr;
+};
+
+// Lights sharing a slot simply take turns
+constexpr int CACHED_LIGHTS = 16;
+thread_local LastOccluder lastOccluders[CACHED_LIGHTS];
+
+LastOccluder &lastOccluderOf(const ILight *light) {
+    return lastOccluders[(reinterpret_cast<uintptr_t>(light) / alignof(std::max_align_t))
+        % CACHED_LIGHTS];
+}
+
+// Revisions given out over every scene, 0 is never one
+std::atomic<uint64_t> lastRevision{0};
+
+}  // namespace
+
 /**
  * @brief Sets the camera for the scene
  * @param cam The camera to set
@@ -36,7 +68,10 @@ Camera Scene::getCamera() const { return _camera; }
  * @brief Sets the ambient light for the scene
  * @param light The ambient light to set
  */
-void Scene::setAmbientLight(const AmbientLight &light) { _ambientLight = light; }
+void Scene::setAmbientLight(const AmbientLight &light) {
+    _ambientLight = light;
+    markChanged();
+}
 
 /**
  * @brief Adds a primitive to the scene
@@ -44,6 +79,8 @@ void Scene::setAmbientLight(const AmbientLight &light) { _ambientLight = light;
  */
 void Scene::addPrimitive(const std::shared_ptr<IPrimitive> &primitive) {
     _primitives.push_back(primitive);
+    _bvh.clear();
+    markChanged();
 }
 
 /**
@@ -52,6 +89,7 @@ void Scene::addPrimitive(const std::shared_ptr<IPrimitive> &primitive) {
  */
 void Scene::addLight(const std::shared_ptr<ILight> &light) {
     _lights.push_back(light);
+    markChanged();
 }
 
 /**
@@ -60,6 +98,7 @@ void Scene::addLight(const std::shared_ptr<ILight> &light) {
  */
 void Scene::addShader(const std::shared_ptr<IShader> &shader) {
     _shaders.push_back(shader);
+    markChanged();
 }
 
 /**
@@ -68,6 +107,7 @@ void Scene::addShader(const std::shared_ptr<IShader> &shader) {
  */
 void Scene::addPostProcess(const std::shared_ptr<IPostProcess> &postProcess) {
     _postProcessEffects.push_back(postProcess);
+    markChanged();
 }
 
 /**
@@ -76,33 +116,120 @@ void Scene::addPostProcess(const std::shared_ptr<IPostProcess> &postProcess) {
  * @return Information about the closest hit, if any
  */
 std::optional<HitInfo> Scene::trace(const Ray &ray) const {
-    double closest = std::numeric_limits<double>::infinity();
+    std::optional<ClosestHit> closest = findClosestHit(ray);
+    if (!closest)
+        return std::nullopt;
+    auto hit = evaluateSurface(ray, *closest);
+    if (!hit)
+        hit = findFullHit(ray);
+    return hit;
+}
+
+/**
+ * @brief Traces a ray with full hit() tests, for when the winner of the
+ * distance-only search does not report its surface
+ * @param ray The ray to trace
+ * @return Information about the closest hit, if any
+ */
+std::optional<HitInfo> Scene::findFullHit(const Ray &ray) const {
     std::optional<HitInfo> closestHit;
 
+    if (_bvh.isBuilt()) {
+        closestHit = _bvh.hit(ray, 0.001, std::numeric_limits<double>::infinity());
+    } else {
+        const auto& primitivesToCheck = !_primitivesCache.empty() ?
+                                         _primitivesCache : _primitives;
+        double closest = std::numeric_limits<double>::infinity();
+
+        for (const auto &primitive : primitivesToCheck) {
+            auto hit = primitive->hit(ray, 0.001, closest);
+            if (hit) {
+                closestHit = hit;
+                closest = hit->distance;
+            }
+        }
+    }
+    if (!closestHit || !closestHit->primitive)
+        return std::nullopt;
+    applyDisplacementMapping(closestHit);
+    return closestHit;
+}
+
+/**
+ * @brief Finds the closest primitive along a ray, leaving its surface unevaluated
+ * @param ray The ray to trace
+ * @return The closest primitive and its distance, if any
+ */
+std::optional<ClosestHit> Scene::findClosestHit(const Ray &ray) const {
+    if (_bvh.isBuilt())
+        return _bvh.closestHit(ray, 0.001, std::numeric_limits<double>::infinity());
+
     const auto& primitivesToCheck = !_primitivesCache.empty() ?
                                      _primitivesCache : _primitives;
+    ClosestHit closest{std::numeric_limits<double>::infinity(), nullptr};
 
     for (const auto &primitive : primitivesToCheck) {
-        auto hit = primitive->hit(ray, 0.001, closest);
-        if (hit && hit->primitive) {
-            auto material = hit->primitive->getMaterial();
-            if (material->hasDisplacementMap()) {
-                applyDisplacementMapping(hit, material);
-            }
-            closest = hit->distance;
-            closestHit = hit;
+        auto distance = primitive->intersect(ray, 0.001, closest.distance);
+        if (distance)
+            closest = {*distance, primitive.get()};
+    }
+    if (!closest.primitive)
+        return std::nullopt;
+    return closest;
+}
+
+/**
+ * @brief Evaluates the surface of the closest hit: point, normal, UV and displacement
+ * @param ray The ray that was traced
+ * @param closest The primitive the ray hits first and its distance
+ * @return The hit information, nullopt if the primitive no longer reports the hit
+ */
+std::optional<HitInfo> Scene::evaluateSurface(const Ray &ray, const ClosestHit &closest) const {
+    auto hit = closest.primitive->surfaceAt(ray, 0.001, closest.distance);
+    if (!hit || !hit->primitive)
+        return std::nullopt;
+    applyDisplacementMapping(hit);
+    return hit;
+}
+
+/**
+ * @brief Traces a packet of coherent rays
+ * @param packet The rays to trace
+ * @param hits Output array of packet.count hits
+ */
+void Scene::tracePacket(const RayPacket &packet, std::optional<HitInfo> *hits) const {
+    if (!_bvh.isBuilt()) {
+        for (int lane = 0; lane < packet.count; lane++)
+            hits[lane] = trace(packet.getRay(lane));
+        return;
+    }
+    PacketHit packetHits;
+    _bvh.hitPacket(packet, 0.001, packetHits);
+
+    for (int lane = 0; lane < packet.count; lane++) {
+        IPrimitive *primitive = packetHits.primitive[lane];
+        if (!primitive) {
+            hits[lane] = std::nullopt;
+            continue;
         }
+        Ray ray = packet.getRay(lane);
+        hits[lane] = evaluateSurface(ray, ClosestHit{packetHits.distance[lane], primitive});
+        if (!hits[lane])
+            hits[lane] = trace(ray);
     }
-    return closestHit;
 }
 
 /**
  * @brief Applies displacement mapping to a hit point
+ *
+ * Only for primitives that could not tessellate their displacement at load,
+ * the point is moved and the normal bent but the silhouette stays the same.
  * @param hit The hit information to modify
- * @param material The material containing the displacement map
  */
-void Scene::applyDisplacementMapping(std::optional<HitInfo> &hit,
-                                   const std::shared_ptr<Material> &material) const {
+void Scene::applyDisplacementMapping(std::optional<HitInfo> &hit) const {
+    const auto &material = hit->primitive->getMaterial();
+    if (!material->hasDisplacementMap() || hit->primitive->hasDisplacedGeometry())
+        return;
     Math::Vector3D originalNormal = hit->normal;
     hit->hitPoint = material->displacePoint(hit->hitPoint, hit->normal, hit->uv);
     const double epsilon = 0.005;
@@ -149,29 +276,27 @@ const Math::Vector3D &lightDir, const std::shared_ptr<ILight> &light) const {
     double shadowBias = 0.001;
     Math::Point3D shadowOrigin = hitPoint + lightDir * shadowBias;
     Ray shadowRay(shadowOrigin, lightDir);
-    double maxDistance = calculateMaxShadowDistance(hitPoint, light);
+    double maxDistance = light->getDistance(hitPoint);
+    LastOccluder &cached = lastOccluderOf(light.get());
 
-    for (const auto &primitive : _primitives) {
-        auto shadowHit = primitive->hit(shadowRay, 0.001, maxDistance);
-        if (shadowHit) {
-            return true;
-        }
-    }
-    return false;
-}
+    if (cached.light == light.get() && cached.revision == _revision
+        && cached.primitive->occluded(shadowRay, 0.001, maxDistance))
+        return true;
 
-/**
- * @brief Calculates the maximum distance for shadow rays
- * @param hitPoint The hit point
- * @param light The light source
- * @return The maximum shadow ray distance
- */
-double Scene::calculateMaxShadowDistance(const Math::Point3D &hitPoint,
-                                       const std::shared_ptr<ILight> &light) const {
-    if (auto pointLight = dynamic_cast<PointLight*>(light.get())) {
-        return (pointLight->position - hitPoint).length();
+    IPrimitive *occluder = nullptr;
+    if (_bvh.isBuilt()) {
+        occluder = _bvh.findOccluder(shadowRay, 0.001, maxDistance);
+    } else {
+        for (const auto &primitive : _primitives) {
+            if (primitive->occluded(shadowRay, 0.001, maxDistance)) {
+                occluder = primitive.get();
+                break;
+            }
+        }
     }
-    return std::numeric_limits<double>::infinity();
+    if (occluder)
+        cached = LastOccluder{_revision, light.get(), occluder};
+    return occluder != nullptr;
 }
 
 /**
@@ -185,19 +310,32 @@ Math::Vector3D Scene::computeColor(const Ray &ray, const bool lowRender, const i
     if (depth > _maxReflectionDepth) {
         return Math::Vector3D(Math::Coords{0.0, 0.0, 0.0});
     }
-    auto hit = trace(ray);
+    return computeColorFromHit(ray, trace(ray), lowRender, depth);
+}
+
+/**
+ * @brief Computes the color for a ray whose closest hit is already known
+ * @param ray The ray that was traced
+ * @param hit The closest hit of the ray
+ * @param depth The current recursion depth
+ * @return The computed color
+ */
+Math::Vector3D Scene::computeColorFromHit(const Ray &ray, const std::optional<HitInfo> &hit,
+const bool lowRender, const int depth) const {
     if (!hit) {
         return Math::Vector3D(Math::Coords{0.0, 0.0, 0.0});
     }
-    auto material = hit->primitive->getMaterial();
-    Math::Vector3D baseColor = calculateBaseColor(material, hit->uv);
+    const auto &material = hit->primitive->getMaterial();
     if (lowRender)
-        return baseColor;
+        return calculateBaseColor(material, hit->uv);
 
-    Math::Vector3D surfaceNormal = calculateSurfaceNormal(material, hit);
-    double aoFactor = calculateAmbientOcclusion(material, hit->uv);
+    double footprint = material->hasShadingMaps() ? textureFootprint(ray, *hit) : 0.0;
+    Math::Vector3D baseColor = calculateBaseColor(material, hit->uv, footprint);
+    Math::Vector3D surfaceNormal = calculateSurfaceNormal(material, hit, footprint);
+    double aoFactor = calculateAmbientOcclusion(material, hit->uv, footprint);
     Math::Vector3D pixelColor = baseColor * _ambientLight.color * aoFactor;
-    pixelColor = applyLighting(pixelColor, hit, ray, surfaceNormal, baseColor, material, aoFactor);
+    pixelColor = applyLighting(pixelColor, hit, ray, surfaceNormal, baseColor, material, aoFactor,
+        footprint);
     pixelColor = applyReflectionAndRefraction(pixelColor, hit, ray, surfaceNormal, material, depth);
     for (const auto& shader : _shaders) {
         pixelColor = shader->apply(pixelColor, *hit, ray);
@@ -205,16 +343,37 @@ Math::Vector3D Scene::computeColor(const Ray &ray, const bool lowRender, const i
     return pixelColor;
 }
 
+/**
+ * @brief Estimates the UV width of the area a ray cone covers at its hit
+ *
+ * The cone is spread * distance wide at the hit, stretched by the angle it
+ * meets the surface at, and the primitive converts that world width to UVs.
+ * @param ray The ray that was traced, carrying its spread
+ * @param hit The hit of the ray
+ * @return The footprint in UV units, 0 when the ray carries no spread
+ */
+double Scene::textureFootprint(const Ray &ray, const HitInfo &hit) const {
+    if (ray.spread <= 0.0 || !hit.primitive)
+        return 0.0;
+    double length = ray.direction.length();
+    double cosine = std::abs(hit.normal.dot(ray.direction)) / length;
+    // Grazing angles would stretch the footprint over the whole texture
+    double width = ray.spread * hit.distance * length / std::max(cosine, 0.05);
+    return std::min(1.0, width * hit.primitive->getUVDensity(hit));
+}
+
 /**
  * @brief Calculates the base color of a material at a specific UV coordinate
  * @param material The material
  * @param uv The UV coordinate
+ * @param footprint The UV width the color is averaged over
  * @return The base color
  */
 Math::Vector3D Scene::calculateBaseColor(const std::shared_ptr<Material> &material,
-                                       const Math::Vector2D &uv) const {
+                                       const Math::Vector2D &uv,
+                                       double footprint) const {
     if (material->hasTexture()) {
-        return material->getColorAt(uv);
+        return material->getColorAt(uv, footprint);
     }
     return material->color;
 }
@@ -223,13 +382,15 @@ Math::Vector3D Scene::calculateBaseColor(const std::shared_ptr<Material> &materi
  * @brief Calculates the surface normal considering normal mapping
  * @param material The material
  * @param hit The hit information
+ * @param footprint The UV width the normal map is averaged over
  * @return The calculated surface normal
  */
 Math::Vector3D Scene::calculateSurfaceNormal(const std::shared_ptr<Material> &material,
-                                           const std::optional<HitInfo> &hit) const {
+                                           const std::optional<HitInfo> &hit,
+                                           double footprint) const {
     Math::Vector3D normal = hit->normal;
     if (material->hasNormalMap()) {
-        normal = material->getNormalAt(hit->uv, hit->normal);
+        normal = material->getNormalAt(hit->uv, hit->normal, footprint);
         normal = normal.normalize();
     }
     return normal;
@@ -239,12 +400,14 @@ Math::Vector3D Scene::calculateSurfaceNormal(const std::shared_ptr<Material> &ma
  * @brief Calculates the ambient occlusion factor
  * @param material The material
  * @param uv The UV coordinate
+ * @param footprint The UV width the map is averaged over
  * @return The ambient occlusion factor
  */
 double Scene::calculateAmbientOcclusion(const std::shared_ptr<Material> &material,
-                                      const Math::Vector2D &uv) const {
+                                      const Math::Vector2D &uv,
+                                      double footprint) const {
     if (material->hasAmbientOcclusionMap()) {
-        double aoValue = material->getAmbientOcclusionAt(uv);
+        double aoValue = material->getAmbientOcclusionAt(uv, footprint);
         return 0.1 + (aoValue * 0.9);
     }
     return 1.0;
@@ -259,6 +422,7 @@ double Scene::calculateAmbientOcclusion(const std::shared_ptr<Material> &materia
  * @param baseColor The base material color
  * @param material The material
  * @param aoFactor The ambient occlusion factor
+ * @param footprint The UV width the specular map is averaged over
  * @return The color with lighting applied
  */
 Math::Vector3D Scene::applyLighting(const Math::Vector3D &basePixelColor,
@@ -267,7 +431,8 @@ Math::Vector3D Scene::applyLighting(const Math::Vector3D &basePixelColor,
                                   const Math::Vector3D &normal,
                                   const Math::Vector3D &baseColor,
                                   const std::shared_ptr<Material> &material,
-                                  double aoFactor) const {
+                                  double aoFactor,
+                                  double footprint) const {
     Math::Vector3D pixelColor = basePixelColor;
     for (const auto &light : _lights) {
         Math::Vector3D lightDir = light->getLightDirection(hit->hitPoint);
@@ -276,7 +441,8 @@ Math::Vector3D Scene::applyLighting(const Math::Vector3D &basePixelColor,
         double diffuseFactor = calculateDiffuseFactor(normal, lightDir, shadowed, aoFactor);
         Math::Vector3D diffuse = baseColor * lightColor * diffuseFactor;
         Math::Vector3D specular = calculateSpecular(hit->hitPoint, ray.origin, lightDir,
-                                                  normal, lightColor, material, hit->uv);
+                                                  normal, lightColor, material, hit->uv,
+                                                  footprint);
         pixelColor += diffuse * 0.6 + specular * 0.4;
     }
     pixelColor.X = std::min(1.0, pixelColor.X);
@@ -328,6 +494,7 @@ double Scene::calculateDiffuseFactor(const Math::Vector3D &normal,
  * @param lightColor The color of the light
  * @param material The material
  * @param uv The UV coordinate
+ * @param footprint The UV width the specular map is averaged over
  * @return The specular lighting component
  */
 Math::Vector3D Scene::calculateSpecular(const Math::Point3D &hitPoint,
@@ -336,12 +503,13 @@ Math::Vector3D Scene::calculateSpecular(const Math::Point3D &hitPoint,
                                       const Math::Vector3D &normal,
                                       const Math::Vector3D &lightColor,
                                       const std::shared_ptr<Material> &material,
-                                      const Math::Vector2D &uv) const {
+                                      const Math::Vector2D &uv,
+                                      double footprint) const {
     Math::Vector3D viewDir = (viewerPos - hitPoint).normalize();
     Math::Vector3D halfwayDir = (lightDir + viewDir).normalize();
     double specularFactor = std::pow(std::max(0.0, normal.dot(halfwayDir)), material->shininess);
     if (material->hasSpecularMap()) {
-        double specMapValue = material->getSpecularAt(uv);
+        double specMapValue = material->getSpecularAt(uv, footprint);
         specularFactor *= specMapValue * 1.5;
     }
     return lightColor * specularFactor;
@@ -479,16 +647,20 @@ Math::Vector3D Scene::calculateSnellRefraction( const Ray &ray,
  */
 std::vector<Math::Vector3D> Scene::applyPostProcessingToFrameBuffer(
     const std::vector<Math::Vector3D>& frameBuffer, int width, int height) const {
+    std::vector<Math::Vector3D> processedBuffer = frameBuffer;
+    std::vector<Math::Vector3D> scratch;
 
-        std::vector<Math::Vector3D> processedBuffer = frameBuffer;
-
-    for (const auto& effect : _postProcessEffects) {
-        processedBuffer = effect->processFrameBuffer(processedBuffer, width, height);
-    }
-
+    applyPostProcessing(processedBuffer, scratch, width, height, serialFor);
     return processedBuffer;
 }
 
+void Scene::applyPostProcessing(std::vector<Math::Vector3D>& frame,
+    std::vector<Math::Vector3D>& scratch, int width, int height,
+    const ParallelFor& parallelFor,
+    const std::function<void(int, int)>& output) const {
+    applyPostProcessChain(_postProcessEffects, frame, scratch, width, height, parallelFor, output);
+}
+
 void Scene::writeColor(const Math::Vector3D &color) const {
     double r = std::sqrt(std::max(0.0, std::min(1.0, color.X)));
     double g = std::sqrt(std::max(0.0, std::min(1.0, color.Y)));
@@ -498,7 +670,7 @@ void Scene::writeColor(const Math::Vector3D &color) const {
     int ig = static_cast<int>(255.999 * g);
     int ib = static_cast<int>(255.999 * b);
 
-    std::cout << ir << " " << ig << " " << ib << std::endl;
+    std::cout << ir << " " << ig << " " << ib << "\n";
 }
 
 void Scene::getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) const {
@@ -512,7 +684,7 @@ void Scene::getLibConfigParams(std::shared_ptr<libconfig::Setting> setting) cons
 
     for (const auto& primitive : getPrimitives()) {
         std::string typeName = primitive->getTypeName();
-        if (typeName == "composites")
+        if (typeName == "composites" || typeName == "meshes")
             continue;
         if (primitiveTypes.find(typeName) == primitiveTypes.end())
             primitiveTypes[typeName] = &primitives.add(typeName, libconfig::Setting::TypeList);
@@ -589,4 +761,44 @@ void Scene::updatePrimitiveCache() {
     }
 }
 
+/**
+ * @brief Builds the bounding volume hierarchy queried by trace() and isInShadow()
+ */
+void Scene::buildAccelerationStructure() {
+    tessellateDisplacement();
+    _bvh.build(_primitives);
+}
+
+/**
+ * @brief Bakes displacement maps into the geometry of the primitives able to
+ */
+void Scene::tessellateDisplacement() {
+    // Each primitive checks its own material, composites their children's
+    for (const auto &primitive : _primitives)
+        primitive->tessellateDisplacement();
+}
+
+/**
+ * @brief Updates the hierarchy bounds after primitives were moved
+ */
+void Scene::refitAccelerationStructure() {
+    if (_bvh.isBuilt())
+        _bvh.refit();
+}
+
+/**
+ * @brief Moves the scene to a new revision, unique across every scene
+ */
+void Scene::markChanged() {
+    _revision = ++lastRevision;
+}
+
+/**
+ * @brief Lets every primitive prepare for the primary rays of a frame
+ */
+void Scene::prepareView(const PrimaryView &view) const {
+    for (const auto &primitive : _primitives)
+        primitive->prepareView(view);
+}
+
 }  // namespace RayTracer
@@ -9,6 +9,7 @@
 #ifndef SRC_SCENE_SCENE_HPP_
   #define SRC_SCENE_SCENE_HPP_
   #include <algorithm>
+  #include <cstdint>
   #include <limits>
   #include <memory>
   #include <vector>
@@ -19,7 +20,10 @@
   #include "Light/AmbientLight/AmbientLight.hpp"
   #include "Light/ILight.hpp"
   #include "Primitive/IPrimitive.hpp"
+  #include "Primitive/BVH/BVH.hpp"
   #include "Ray/Ray.hpp"
+  #include "Ray/RayPacket.hpp"
+  #include "Ray/PrimaryView.hpp"
   #include "Shader/IShader.hpp"
   #include "PostProcess/IPostProcess.hpp"
   #include "Scene/SceneDirector/ObjModelInfo.hpp"
@@ -32,6 +36,7 @@ class Scene {
  private:
     std::vector<std::shared_ptr<IPrimitive>> _primitives;
     std::vector<std::shared_ptr<IPrimitive>> _primitivesCache;
+    BVH _bvh;
     std::vector<std::shared_ptr<ILight>> _lights;
     std::vector<std::shared_ptr<IShader>> _shaders;
     std::vector<std::shared_ptr<IPostProcess>> _postProcessEffects;
@@ -41,21 +46,26 @@ class Scene {
     int _imageWidth = WIDTH;
     int _imageHeight = HEIGHT;
     std::vector<RayTracer::ObjModelInfo> objModelInfos;
+    uint64_t _revision = 0;
 
     Math::Vector3D createTangentVector(const Math::Vector3D &normal) const;
-    void applyDisplacementMapping(std::optional<HitInfo> &hit,
-                                const std::shared_ptr<Material> &material) const;
-
-    double calculateMaxShadowDistance(const Math::Point3D &hitPoint,
-                                    const std::shared_ptr<ILight> &light) const;
+    std::optional<ClosestHit> findClosestHit(const Ray &ray) const;
+    std::optional<HitInfo> evaluateSurface(const Ray &ray, const ClosestHit &closest) const;
+    std::optional<HitInfo> findFullHit(const Ray &ray) const;
+    void applyDisplacementMapping(std::optional<HitInfo> &hit) const;
+    void tessellateDisplacement();
 
     // Helper methods for material and lighting
+    double textureFootprint(const Ray &ray, const HitInfo &hit) const;
     Math::Vector3D calculateBaseColor(const std::shared_ptr<Material> &material,
-                                    const Math::Vector2D &uv) const;
+                                    const Math::Vector2D &uv,
+                                    double footprint = 0.0) const;
     Math::Vector3D calculateSurfaceNormal(const std::shared_ptr<Material> &material,
-                                        const std::optional<HitInfo> &hit) const;
+                                        const std::optional<HitInfo> &hit,
+                                        double footprint = 0.0) const;
     double calculateAmbientOcclusion(const std::shared_ptr<Material> &material,
-                                   const Math::Vector2D &uv) const;
+                                   const Math::Vector2D &uv,
+                                   double footprint = 0.0) const;
     Math::Vector3D getLightColor(const std::shared_ptr<ILight> &light,
                                const Math::Point3D &hitPoint) const;
     double calculateDiffuseFactor(const Math::Vector3D &normal,
@@ -68,14 +78,16 @@ class Scene {
                                    const Math::Vector3D &normal,
                                    const Math::Vector3D &lightColor,
                                    const std::shared_ptr<Material> &material,
-                                   const Math::Vector2D &uv) const;
+                                   const Math::Vector2D &uv,
+                                   double footprint = 0.0) const;
     Math::Vector3D applyLighting(const Math::Vector3D &basePixelColor,
                                const std::optional<HitInfo> &hit,
                                const Ray &ray,
                                const Math::Vector3D &normal,
                                const Math::Vector3D &baseColor,
                                const std::shared_ptr<Material> &material,
-                               double aoFactor) const;
+                               double aoFactor,
+                               double footprint = 0.0) const;
 
     // Helper methods for reflection and refraction
     Math::Vector3D calculateReflection(const Ray &ray,
@@ -154,11 +166,22 @@ class Scene {
 
     /**
      * @brief Traces a ray through the scene and finds the closest hit
+     * The closest primitive is found from distances alone, then only its
+     * surface (normal, UV, displacement) is evaluated
      * @param ray The ray to trace
      * @return Information about the closest hit, if any
      */
     std::optional<HitInfo> trace(const Ray &ray) const;
 
+    /**
+     * @brief Traces a packet of coherent rays, returning the same hits as trace() per lane
+     * Visibility is resolved for the whole packet through the hierarchy, then
+     * the hit of each lane is completed on the primitive it found
+     * @param packet The rays to trace
+     * @param hits Output array of packet.count hits
+     */
+    void tracePacket(const RayPacket &packet, std::optional<HitInfo> *hits) const;
+
     /**
      * @brief Checks if a point is in shadow from a light
      * @param hitPoint The point to check
@@ -180,6 +203,18 @@ class Scene {
       const bool lowRender = false,
       const int depth = 0) const;
 
+    /**
+     * @brief Computes the color for a ray whose closest hit is already known
+     * @param ray The ray that was traced
+     * @param hit The result of trace() for this ray
+     * @param depth The current recursion depth
+     * @return The computed color
+     */
+    Math::Vector3D computeColorFromHit(const Ray &ray,
+      const std::optional<HitInfo> &hit,
+      const bool lowRender = false,
+      const int depth = 0) const;
+
     /**
      * @brief Applies post-processing effects to a frame buffer
      * @param frameBuffer The original frame buffer
@@ -190,6 +225,20 @@ class Scene {
     std::vector<Math::Vector3D> applyPostProcessingToFrameBuffer(
         const std::vector<Math::Vector3D>& frameBuffer, int width, int height) const;
 
+    /**
+     * @brief Applies post-processing effects to frame, in place
+     * @param scratch Buffer the effects work in, keep it between frames to avoid allocations
+     * @param parallelFor Runs the parts of each effect, e.g. on the render threads
+     * @param output Called on each block of finished pixels, as output(firstIndex, count),
+     * in the same pass as the trailing per-pixel effects
+     *
+     * Consecutive per-pixel effects are fused, see applyPostProcessChain().
+     */
+    void applyPostProcessing(std::vector<Math::Vector3D>& frame,
+        std::vector<Math::Vector3D>& scratch, int width, int height,
+        const ParallelFor& parallelFor,
+        const std::function<void(int, int)>& output = nullptr) const;
+
     /**
      * @brief Writes a color to the standard output
      * @param color The color to write
@@ -260,6 +309,36 @@ class Scene {
      */
     void updatePrimitiveCache();
 
+    /**
+     * @brief Builds the bounding volume hierarchy queried by trace() and isInShadow()
+     * Until it is built, or after a primitive is added, every primitive is tested linearly.
+     * Displacement maps are first tessellated into the primitives supporting it
+     */
+    void buildAccelerationStructure();
+
+    /**
+     * @brief Updates the hierarchy bounds after primitives were moved
+     */
+    void refitAccelerationStructure();
+
+    /**
+     * @brief Lets every primitive prepare for the primary rays of a frame
+     * @param view Where the primary rays start and which pixels they cross
+     */
+    void prepareView(const PrimaryView &view) const;
+
+    /**
+     * @brief Signals that the scene content changed, e.g. a primitive was moved
+     */
+    void markChanged();
+
+    /**
+     * @brief Gets a counter increased every time the scene content changes
+     * Renderers compare it between frames to know when cached images are stale.
+     * No two scenes share a revision, 0 is only the one of an empty scene
+     */
+    uint64_t getRevision() const { return _revision; }
+
     /**
      * @brief Sets the obj model infos for the scene
      * @param infos The obj model infos to set
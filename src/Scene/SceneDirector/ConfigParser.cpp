@@ -35,6 +35,7 @@
 #include "Exception/InvalidOperationException.hpp"
 #include "Exception/ValueRangeException.hpp"
 #include "Texture/ImageTexture/ImageTexture.hpp"
+#include "Texture/TextureCache/TextureCache.hpp"
 #include "Texture/NormalMap/NormalMap.hpp"
 #include "Texture/ProceduralTexture/ChessboardTexture.hpp"
 #include "Texture/ProceduralTexture/PerlinNoiseTexture.hpp"
@@ -305,11 +306,53 @@ void LightsParser::parseDirectionalLights(const libconfig::Setting& lights, std:
     }
 }
 
+namespace {
+
+// Material entries loaded from an image, with the components their map keeps per texel
+const std::pair<const char*, int> IMAGE_MAPS[] = {
+    {"texture", 4}, {"normalMap", 4}, {"displacementMap", 1},
+    {"specularMap", 1}, {"aoMap", 1}, {"ambientOcclusionMap", 1}
+};
+
+void collectTextureRequests(const libconfig::Setting& setting,
+    std::vector<std::pair<std::string, int>>& requests) {
+    if (setting.isGroup() && setting.exists("material") && setting["material"].isGroup()) {
+        const libconfig::Setting& material = setting["material"];
+        for (const auto& [name, components] : IMAGE_MAPS) {
+            if (material.exists(name) && material[name].exists("path")) {
+                std::pair<std::string, int> request(static_cast<const char*>(material[name]["path"]),
+                    components);
+                if (std::find(requests.begin(), requests.end(), request) == requests.end())
+                    requests.push_back(request);
+            }
+        }
+    }
+    if (setting.isGroup() || setting.isList()) {
+        for (int i = 0; i < setting.getLength(); ++i)
+            collectTextureRequests(setting[i], requests);
+    }
+}
+
+}  // namespace
+
+std::vector<std::shared_ptr<const TextureStorage>> PrimitivesParser::preloadTextures(
+    const libconfig::Setting& setting) {
+    std::vector<std::pair<std::string, int>> requests;
+
+    collectTextureRequests(setting, requests);
+    if (requests.empty())
+        return {};
+    std::cout << "Decoding " << requests.size() << " texture images" << std::endl;
+    return TextureCache::getInstance().preload(requests);
+}
+
 void PrimitivesParser::parse(const libconfig::Setting& setting, std::shared_ptr<SceneBuilder> builder) {
     auto pluginManager = PrimitivePluginManager::getInstance();
     if (!pluginManager->loadAllPlugins("plugins/primitives")) {
         throw ConfigParseException("Failed to load primitive plugins");
     }
+    // Held until the materials below take their own references
+    auto preloadedTextures = preloadTextures(setting);
 
     auto loadedPluginNames = pluginManager->getLoadedPluginNames();
 
@@ -17,6 +17,7 @@
 #include "Math/Vector3D/Vector3D.hpp"
 #include "Math/Point3D/Point3D.hpp"
 #include "Scene/SceneBuilder/SceneBuilder.hpp"
+#include "Texture/TextureStorage/TextureStorage.hpp"
 
 namespace RayTracer {
 
@@ -84,6 +85,8 @@ class PrimitivesParser : public ConfigParser {
          const libconfig::Setting& setting,
          const std::vector<std::string>& requiredParams);
    std::shared_ptr<Material> extractMaterialFromSetting(const libconfig::Setting& setting);
+   // Decodes every image the materials below setting name, on several threads
+   std::vector<std::shared_ptr<const TextureStorage>> preloadTextures(const libconfig::Setting& setting);
    void processImportedPrimitive(const std::string& importAlias, std::shared_ptr<SceneBuilder> builder);
 };
 
@@ -70,6 +70,7 @@ const std::string& filename) {
         if (!scene) {
             throw SceneImportException(filename, "Failed to parse scene file - no scene was created");
         }
+        scene->buildAccelerationStructure();
         return scene;
     } catch (const IException& ex) {
         throw;
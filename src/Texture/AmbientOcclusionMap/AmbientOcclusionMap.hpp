@@ -5,6 +5,7 @@
 #include <vector>
 #include "../../Math/Vector3D/Vector3D.hpp"
 #include "../../Math/Vector2D/Vector2D.hpp"
+#include "../TextureStorage/TextureStorage.hpp"
 
 namespace RayTracer {
 
@@ -13,10 +14,7 @@ namespace RayTracer {
  */
 class AmbientOcclusionMap {
  private:
-    std::vector<unsigned char> mapData;
-    int width;
-    int height;
-    int channels;
+    std::shared_ptr<const TextureStorage> storage;
     double strength;  // Strength of occlusion effect (0.0 - 1.0)
     bool bilinearFilter;
 
@@ -31,12 +29,6 @@ class AmbientOcclusionMap {
      */
     void createDefaultMap();
 
-    /**
-     * Store image data from the loaded buffer
-     * @param data Pointer to the image data
-     */
-    void storeMapData(unsigned char* data);
-
     /**
      * Apply post-processing effects to the occlusion value
      * @param occlusion Raw occlusion value (0.0 - 1.0)
@@ -44,41 +36,6 @@ class AmbientOcclusionMap {
      */
     double applyOcclusionEffect(double occlusion) const;
 
-    /**
-     * Sample using nearest neighbor filtering
-     * @param u U coordinate (0.0 - 1.0)
-     * @param v V coordinate (0.0 - 1.0)
-     * @return Occlusion value at the given coordinates
-     */
-    double nearestNeighbor(double u, double v) const;
-
-    /**
-     * Sample using bilinear filtering
-     * @param u U coordinate (0.0 - 1.0)
-     * @param v V coordinate (0.0 - 1.0)
-     * @return Occlusion value at the given coordinates with bilinear interpolation
-     */
-    double bilinearSample(double u, double v) const;
-
-    /**
-     * Normalize texture coordinate to [0, 1] range
-     * @param coord Input coordinate
-     * @return Normalized coordinate
-     */
-    double normalizeCoordinate(double coord) const;
-
-    /**
-     * Interpolate values for bilinear filtering
-     * @param tx X interpolation factor
-     * @param ty Y interpolation factor
-     * @param v00 Top-left value
-     * @param v01 Top-right value
-     * @param v10 Bottom-left value
-     * @param v11 Bottom-right value
-     * @return Interpolated value
-     */
-    double interpolateValues(double tx, double ty, double v00, double v01, double v10, double v11) const;
-
  public:
     /**
      * Constructor
@@ -98,9 +55,10 @@ class AmbientOcclusionMap {
     /**
      * Get occlusion value at the given UV coordinates
      * @param uv UV coordinates
+     * @param footprint Width in UV units of the area seen, 0 for the full resolution
      * @return Occlusion value (0.0 - 1.0, where 0 = fully occluded)
      */
-    virtual double getOcclusionAt(const Math::Vector2D& uv) const;
+    virtual double getOcclusionAt(const Math::Vector2D& uv, double footprint = 0.0) const;
 
     /**
      * Clone this ambient occlusion map
@@ -5,6 +5,7 @@
 #include <vector>
 #include "../../Math/Vector3D/Vector3D.hpp"
 #include "../../Math/Vector2D/Vector2D.hpp"
+#include "../TextureStorage/TextureStorage.hpp"
 
 namespace RayTracer {
 
@@ -13,10 +14,7 @@ namespace RayTracer {
  */
 class DisplacementMap {
  private:
-    std::vector<unsigned char> mapData;
-    int width;
-    int height;
-    int channels;
+    std::shared_ptr<const TextureStorage> storage;
     double strength;  // Strength of displacement effect (0.0 - 1.0)
     bool bilinearFilter;
     std::string filepath;
@@ -32,35 +30,6 @@ class DisplacementMap {
      */
     void createDefaultMap();
 
-    /**
-     * Store image data from the loaded buffer
-     * @param data Pointer to the image data
-     */
-    void storeMapData(unsigned char* data);
-
-    /**
-     * Sample using nearest neighbor filtering
-     * @param u U coordinate (0.0 - 1.0)
-     * @param v V coordinate (0.0 - 1.0)
-     * @return Displacement value at the given coordinates
-     */
-    double nearestNeighbor(double u, double v) const;
-
-    /**
-     * Sample using bilinear filtering
-     * @param u U coordinate (0.0 - 1.0)
-     * @param v V coordinate (0.0 - 1.0)
-     * @return Displacement value at the given coordinates with bilinear interpolation
-     */
-    double bilinearSample(double u, double v) const;
-
-    /**
-     * Normalize texture coordinate to [0, 1] range
-     * @param coord Input coordinate
-     * @return Normalized coordinate
-     */
-    double normalizeCoordinate(double coord) const;
-
     /**
      * Apply post-processing effects to the displacement value
      * @param displacement Raw displacement value (0.0 - 1.0)
@@ -68,18 +37,6 @@ class DisplacementMap {
      */
     double applyEffects(double displacement) const;
 
-    /**
-     * Interpolate values for bilinear filtering
-     * @param tx X interpolation factor
-     * @param ty Y interpolation factor
-     * @param v00 Top-left value
-     * @param v01 Top-right value
-     * @param v10 Bottom-left value
-     * @param v11 Bottom-right value
-     * @return Interpolated value
-     */
-    double interpolateValues(double tx, double ty, double v00, double v01, double v10, double v11) const;
-
  public:
     /**
      * Constructor
@@ -29,6 +29,17 @@ class ITexture {
      */
     virtual Math::Vector3D getColorAt(const Math::Vector2D& uv) const = 0;
 
+    /**
+     * Get color averaged over the area a ray footprint covers
+     * @param uv UV coordinates
+     * @param footprint Width of the covered area in UV units, 0 for a point
+     * @return Filtered color, the point color for textures without prefiltering
+     */
+    virtual Math::Vector3D getFilteredColorAt(const Math::Vector2D& uv, double footprint) const {
+        (void)footprint;
+        return getColorAt(uv);
+    }
+
     /**
      * Clone the texture
      * @return A new texture instance with the same properties
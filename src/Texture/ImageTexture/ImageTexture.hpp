@@ -12,6 +12,7 @@
     #include <string>
     #include <vector>
     #include "../ATexture.hpp"
+    #include "../TextureStorage/TextureStorage.hpp"
 
 namespace RayTracer {
 
@@ -20,28 +21,9 @@ namespace RayTracer {
  */
 class ImageTexture : public ATexture {
  private:
-    std::vector<unsigned char> imageData;
-    int width;
-    int height;
-    int channels;
+    std::shared_ptr<const TextureStorage> storage;
     bool bilinearFilter;
 
-    /**
-     * Nearest neighbor sampling method
-     * @param u U coordinate (0.0 - 1.0)
-     * @param v V coordinate (0.0 - 1.0)
-     * @return Color at the given UV coordinates
-     */
-    Math::Vector3D nearestNeighbor(double u, double v) const;
-
-    /**
-     * Bilinear sampling method
-     * @param u U coordinate (0.0 - 1.0)
-     * @param v V coordinate (0.0 - 1.0)
-     * @return Color at the given UV coordinates with bilinear filtering
-     */
-    Math::Vector3D bilinearSample(double u, double v) const;
-
     /**
      * Load image data from file
      * @param filepath Path to the image file
@@ -53,34 +35,6 @@ class ImageTexture : public ATexture {
      */
     void createDefaultTexture();
 
-    /**
-     * Store image data from the loaded buffer
-     * @param data Pointer to the image data
-     */
-    void storeImageData(unsigned char* data);
-
-    /**
-     * Normalize texture coordinate to [0, 1] range
-     * @param coord Input coordinate
-     * @return Normalized coordinate
-     */
-    double normalizeCoordinate(double coord) const;
-
-    /**
-     * Interpolate channel value for bilinear filtering
-     * @param channelOffset Channel offset (0 for R, 1 for G, 2 for B)
-     * @param tx X interpolation factor
-     * @param ty Y interpolation factor
-     * @param idx00 Index of top-left pixel
-     * @param idx01 Index of top-right pixel
-     * @param idx10 Index of bottom-left pixel
-     * @param idx11 Index of bottom-right pixel
-     * @return Interpolated channel value
-     */
-    double interpolateChannel(int channelOffset, double tx, double ty,
-                              size_t idx00, size_t idx01,
-                              size_t idx10, size_t idx11) const;
-
  public:
     /**
      * Constructor
@@ -101,6 +55,14 @@ class ImageTexture : public ATexture {
      */
     Math::Vector3D getColorAt(const Math::Vector2D& uv) const override;
 
+    /**
+     * Get color averaged over a footprint, from the mip levels of the image
+     * @param uv UV coordinates
+     * @param footprint Width of the covered area in UV units
+     * @return Filtered color at the given coordinates
+     */
+    Math::Vector3D getFilteredColorAt(const Math::Vector2D& uv, double footprint) const override;
+
     /**
      * Clone the texture
      * @return A new texture instance with the same properties
@@ -13,6 +13,7 @@
 #include <vector>
 #include "../../Math/Vector3D/Vector3D.hpp"
 #include "../../Math/Vector2D/Vector2D.hpp"
+#include "../TextureStorage/TextureStorage.hpp"
 
 namespace RayTracer {
 
@@ -21,10 +22,7 @@ namespace RayTracer {
  */
 class NormalMap {
  private:
-    std::vector<unsigned char> mapData;
-    int width;
-    int height;
-    int channels;
+    std::shared_ptr<const TextureStorage> storage;
     double strength;  // Strength of normal mapping effect (0.0 - 1.0)
     bool bilinearFilter;
     std::string filepath;
@@ -40,35 +38,6 @@ class NormalMap {
      */
     void createDefaultNormalMap();
 
-    /**
-     * Store image data from the loaded buffer
-     * @param data Pointer to the image data
-     */
-    void storeMapData(unsigned char* data);
-
-    /**
-     * Sample the normal map using nearest neighbor filtering
-     * @param u U coordinate (0.0 - 1.0)
-     * @param v V coordinate (0.0 - 1.0)
-     * @return Normal vector in RGB format (0-1 range)
-     */
-    Math::Vector3D nearestNeighbor(double u, double v) const;
-
-    /**
-     * Sample the normal map using bilinear filtering
-     * @param u U coordinate (0.0 - 1.0)
-     * @param v V coordinate (0.0 - 1.0)
-     * @return Normal vector in RGB format (0-1 range) with bilinear interpolation
-     */
-    Math::Vector3D bilinearSample(double u, double v) const;
-
-    /**
-     * Extract normal vector from image data at the specified index
-     * @param idx Index in the image data array
-     * @return Normal vector in RGB format (0-1 range)
-     */
-    Math::Vector3D extractNormalFromIndex(size_t idx) const;
-
     /**
      * Process a normal vector from image space to tangent space
      * @param normal Normal vector in RGB format (0-1 range)
@@ -82,29 +51,6 @@ class NormalMap {
      */
     void applyStrength(Math::Vector3D& normal) const;
 
-    /**
-     * Normalize texture coordinate to [0, 1] range
-     * @param coord Input coordinate
-     * @return Normalized coordinate
-     */
-    double normalizeCoordinate(double coord) const;
-
-    /**
-     * Interpolate normals for bilinear filtering
-     * @param tx X interpolation factor
-     * @param ty Y interpolation factor
-     * @param c00 Top-left normal
-     * @param c01 Top-right normal
-     * @param c10 Bottom-left normal
-     * @param c11 Bottom-right normal
-     * @return Interpolated normal
-     */
-    Math::Vector3D interpolateNormals(double tx, double ty,
-                                      const Math::Vector3D& c00,
-                                      const Math::Vector3D& c01,
-                                      const Math::Vector3D& c10,
-                                      const Math::Vector3D& c11) const;
-
  public:
     /**
      * Constructor
@@ -122,9 +68,10 @@ class NormalMap {
     /**
      * Get perturbed normal at the given UV coordinates
      * @param uv UV coordinates
+     * @param footprint Width in UV units of the area seen, 0 for the full resolution
      * @return Perturbed normal vector
      */
-    virtual Math::Vector3D getNormalAt(const Math::Vector2D& uv) const;
+    virtual Math::Vector3D getNormalAt(const Math::Vector2D& uv, double footprint = 0.0) const;
 
     /**
      * Clone this normal map
@@ -12,6 +12,7 @@
 #include <vector>
 #include "../../Math/Vector3D/Vector3D.hpp"
 #include "../../Math/Vector2D/Vector2D.hpp"
+#include "../TextureStorage/TextureStorage.hpp"
 
 namespace RayTracer {
 
@@ -20,36 +21,10 @@ namespace RayTracer {
  */
 class SpecularMap {
  private:
-    std::vector<unsigned char> mapData;
-    int width;
-    int height;
-    int channels;
+    std::shared_ptr<const TextureStorage> storage;
     bool bilinearFilter;
     std::string filepath;
 
-    /**
-     * Sample the specular map using nearest neighbor filtering
-     * @param u U coordinate (0.0 - 1.0)
-     * @param v V coordinate (0.0 - 1.0)
-     * @return Specular value at the given coordinates
-     */
-    double nearestNeighbor(double u, double v) const;
-
-    /**
-     * Sample the specular map using bilinear filtering
-     * @param u U coordinate (0.0 - 1.0)
-     * @param v V coordinate (0.0 - 1.0)
-     * @return Specular value at the given coordinates with bilinear interpolation
-     */
-    double bilinearSample(double u, double v) const;
-
-    /**
-     * Normalize texture coordinate to [0, 1] range
-     * @param coord Input coordinate
-     * @return Normalized coordinate
-     */
-    double normalizeCoordinate(double coord) const;
-
     /**
      * Load map data from file
      * @param filepath Path to the specular map image file
@@ -61,24 +36,6 @@ class SpecularMap {
      */
     void createDefaultMap();
 
-    /**
-     * Store image data from the loaded buffer
-     * @param data Pointer to the image data
-     */
-    void storeMapData(unsigned char* data);
-
-    /**
-     * Interpolate values for bilinear filtering
-     * @param tx X interpolation factor
-     * @param ty Y interpolation factor
-     * @param v00 Top-left value
-     * @param v01 Top-right value
-     * @param v10 Bottom-left value
-     * @param v11 Bottom-right value
-     * @return Interpolated value
-     */
-    double interpolateValues(double tx, double ty, double v00, double v01, double v10, double v11) const;
-
  public:
     /**
      * Constructor
@@ -95,9 +52,10 @@ class SpecularMap {
     /**
      * Get specular value at the given UV coordinates
      * @param uv UV coordinates
+     * @param footprint Width in UV units of the area seen, 0 for the full resolution
      * @return Specular value (0.0 - 1.0)
      */
-    virtual double getSpecularAt(const Math::Vector2D& uv) const;
+    virtual double getSpecularAt(const Math::Vector2D& uv, double footprint = 0.0) const;
 
     /**
      * Clone this specular map
@@ -0,0 +1,151 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** TextureCache implementation
+*/
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "../../../tests/external/stb_image.h"
+#include "TextureCache.hpp"
+
+namespace RayTracer {
+
+std::shared_ptr<const TextureStorage> TextureCache::decode(const std::string& path, int components) {
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+    unsigned char* data = stbi_load(path.c_str(), &width, &height, &channels, 0);
+    if (!data) {
+        return nullptr;
+    }
+    auto storage = std::make_shared<const TextureStorage>(data, width, height, channels, components);
+    stbi_image_free(data);
+    return storage;
+}
+
+std::shared_ptr<const TextureStorage> TextureCache::load(const std::string& path, int components) {
+    std::string key = path + '\n' + std::to_string(components);
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    auto it = _entries.find(key);
+    if (it != _entries.end()) {
+        Entry& entry = it->second;
+        if (entry.pending.valid()) {
+            auto pending = entry.pending;
+            lock.unlock();
+            return pending.get();
+        }
+        if (entry.retained) {
+            _recent.splice(_recent.begin(), _recent, entry.position);
+            return entry.retained;
+        }
+        // Evicted, but still used by a map
+        if (auto storage = entry.alive.lock()) {
+            retain(key, entry, storage);
+            evict();
+            return storage;
+        }
+    }
+
+    std::promise<std::shared_ptr<const TextureStorage>> promise;
+    _entries[key].pending = promise.get_future().share();
+    lock.unlock();
+    auto storage = decode(path, components);
+    lock.lock();
+
+    Entry& entry = _entries[key];
+    entry.pending = {};
+    if (storage) {
+        retain(key, entry, storage);
+        evict();
+    } else {
+        // Failures are not cached, the file may show up later
+        _entries.erase(key);
+    }
+    promise.set_value(storage);
+    return storage;
+}
+
+std::vector<std::shared_ptr<const TextureStorage>> TextureCache::preload(
+    const std::vector<std::pair<std::string, int>>& requests) {
+    std::vector<std::shared_ptr<const TextureStorage>> storages(requests.size());
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        for (size_t i = next++; i < requests.size(); i = next++)
+            storages[i] = load(requests[i].first, requests[i].second);
+    };
+    size_t threadCount = std::min<size_t>(requests.size(),
+        std::max(1u, std::thread::hardware_concurrency()));
+    std::vector<std::thread> threads;
+
+    for (size_t i = 1; i < threadCount; ++i)
+        threads.emplace_back(worker);
+    worker();
+    for (auto& thread : threads)
+        thread.join();
+    return storages;
+}
+
+void TextureCache::retain(const std::string& key, Entry& entry,
+    std::shared_ptr<const TextureStorage> storage) {
+    _retainedBytes += storage->getMemorySize();
+    entry.alive = storage;
+    entry.retained = std::move(storage);
+    _recent.push_front(key);
+    entry.position = _recent.begin();
+}
+
+void TextureCache::evict() {
+    // The most recent entry stays, even alone over the budget
+    while (_retainedBytes > _budget && _recent.size() > 1) {
+        Entry& entry = _entries[_recent.back()];
+        _retainedBytes -= entry.retained->getMemorySize();
+        entry.retained.reset();
+        if (entry.alive.expired())
+            _entries.erase(_recent.back());
+        _recent.pop_back();
+    }
+}
+
+void TextureCache::setMemoryBudget(size_t bytes) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _budget = bytes;
+    evict();
+}
+
+size_t TextureCache::getMemoryBudget() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _budget;
+}
+
+size_t TextureCache::getRetainedBytes() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _retainedBytes;
+}
+
+void TextureCache::clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _recent.clear();
+    _retainedBytes = 0;
+    for (auto it = _entries.begin(); it != _entries.end();) {
+        // Decodes in flight put their entry back when they finish
+        if (it->second.pending.valid()) {
+            it->second.retained.reset();
+            it->second.alive.reset();
+            ++it;
+        } else {
+            it = _entries.erase(it);
+        }
+    }
+}
+
+}  // namespace RayTracer
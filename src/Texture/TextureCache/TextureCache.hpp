@@ -0,0 +1,91 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** TextureCache - process wide cache of decoded texture images
+*/
+
+#ifndef SRC_TEXTURE_TEXTURECACHE_TEXTURECACHE_HPP_
+    #define SRC_TEXTURE_TEXTURECACHE_TEXTURECACHE_HPP_
+    #include <cstddef>
+    #include <future>
+    #include <list>
+    #include <memory>
+    #include <mutex>
+    #include <string>
+    #include <unordered_map>
+    #include <utility>
+    #include <vector>
+    #include "Texture/TextureStorage/TextureStorage.hpp"
+
+namespace RayTracer {
+
+/**
+ * @brief Decodes each image file once and shares its texels between maps
+ *
+ * Entries are keyed by path and component count. The cache keeps the most
+ * recently used storages alive within a memory budget; older ones are only
+ * kept by the maps still using them, and found again while they are.
+ * Loading is thread safe, concurrent requests for one file wait for a
+ * single decode.
+ */
+class TextureCache {
+ public:
+    static constexpr size_t DEFAULT_MEMORY_BUDGET = 512ull * 1024 * 1024;
+
+    static TextureCache& getInstance() {
+        static TextureCache instance;
+        return instance;
+    }
+    TextureCache(const TextureCache&) = delete;
+    void operator=(const TextureCache&) = delete;
+
+    /**
+     * @brief Texels of the image at path, decoded on the first request
+     * @param components Floats per texel, see TextureStorage
+     * @return nullptr if the file cannot be decoded
+     */
+    std::shared_ptr<const TextureStorage> load(const std::string& path, int components);
+
+    /**
+     * @brief Decodes the (path, components) requests on several threads
+     * @return The storages in request order, hold them until the maps are built
+     * so a small budget cannot evict them in between
+     */
+    std::vector<std::shared_ptr<const TextureStorage>> preload(
+        const std::vector<std::pair<std::string, int>>& requests);
+
+    // Bytes of texels the cache keeps alive for later requests
+    void setMemoryBudget(size_t bytes);
+    size_t getMemoryBudget() const;
+    size_t getRetainedBytes() const;
+
+    // Forgets every entry, storages still used by maps stay alive
+    void clear();
+
+ private:
+    TextureCache() = default;
+
+    struct Entry {
+        std::shared_future<std::shared_ptr<const TextureStorage>> pending;
+        std::shared_ptr<const TextureStorage> retained;
+        std::weak_ptr<const TextureStorage> alive;
+        std::list<std::string>::iterator position;
+    };
+
+    static std::shared_ptr<const TextureStorage> decode(const std::string& path, int components);
+    void retain(const std::string& key, Entry& entry, std::shared_ptr<const TextureStorage> storage);
+    void evict();
+
+    mutable std::mutex _mutex;
+    std::unordered_map<std::string, Entry> _entries;
+    // Retained entries, most recently used first
+    std::list<std::string> _recent;
+    size_t _retainedBytes = 0;
+    size_t _budget = DEFAULT_MEMORY_BUDGET;
+};
+
+}  // namespace RayTracer
+
+#endif  // SRC_TEXTURE_TEXTURECACHE_TEXTURECACHE_HPP_
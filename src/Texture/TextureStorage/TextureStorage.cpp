@@ -0,0 +1,165 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** TextureStorage implementation
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "TextureStorage.hpp"
+
+namespace RayTracer {
+
+namespace {
+
+// Spreads the 3 low bits of value to bits 0, 2 and 4
+int spreadBits(int value) {
+    return (value & 1) | ((value & 2) << 1) | ((value & 4) << 2);
+}
+
+}  // namespace
+
+TextureStorage::TextureStorage(const unsigned char *data, int width, int height, int channels,
+    int components) : _components(components) {
+    std::vector<float> linear(static_cast<size_t>(width) * height * components);
+
+    // Missing channels repeat the previous one, a gray image gives a gray color
+    for (size_t i = 0; i < static_cast<size_t>(width) * height; ++i) {
+        for (int c = 0; c < components; ++c)
+            linear[i * components + c] = data[i * channels + std::min(c, channels - 1)] / 255.0f;
+    }
+    addLevel(linear, width, height);
+    while (width > 1 || height > 1) {
+        int nextWidth = std::max(1, width / 2);
+        int nextHeight = std::max(1, height / 2);
+        std::vector<float> next(static_cast<size_t>(nextWidth) * nextHeight * components);
+
+        // Box filter of the 2x2 texels below, the last row or column is reused on odd sizes
+        for (int y = 0; y < nextHeight; ++y) {
+            int y0 = std::min(2 * y, height - 1) * width;
+            int y1 = std::min(2 * y + 1, height - 1) * width;
+            for (int x = 0; x < nextWidth; ++x) {
+                int x0 = std::min(2 * x, width - 1);
+                int x1 = std::min(2 * x + 1, width - 1);
+                for (int c = 0; c < components; ++c) {
+                    next[(static_cast<size_t>(y) * nextWidth + x) * components + c] = 0.25f *
+                        (linear[(y0 + x0) * components + c] + linear[(y0 + x1) * components + c]
+                        + linear[(y1 + x0) * components + c] + linear[(y1 + x1) * components + c]);
+                }
+            }
+        }
+        addLevel(next, nextWidth, nextHeight);
+        linear.swap(next);
+        width = nextWidth;
+        height = nextHeight;
+    }
+}
+
+void TextureStorage::addLevel(const std::vector<float>& linear, int width, int height) {
+    Level level;
+    level.width = width;
+    level.height = height;
+    level.tilesX = (width + TILE_SIZE - 1) / TILE_SIZE;
+    level.offset = _texels.size();
+
+    int tilesY = (height + TILE_SIZE - 1) / TILE_SIZE;
+    _texels.resize(level.offset
+        + static_cast<size_t>(level.tilesX) * tilesY * TILE_SIZE * TILE_SIZE * _components);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            std::copy_n(linear.begin() + (static_cast<size_t>(y) * width + x) * _components,
+                _components, _texels.begin() + address(level, x, y));
+        }
+    }
+    _levels.push_back(level);
+}
+
+size_t TextureStorage::address(const Level& level, int x, int y) const {
+    size_t tile = static_cast<size_t>(y / TILE_SIZE) * level.tilesX + x / TILE_SIZE;
+    size_t inTile = spreadBits(x % TILE_SIZE) | (spreadBits(y % TILE_SIZE) << 1);
+
+    return level.offset + (tile * TILE_SIZE * TILE_SIZE + inTile) * _components;
+}
+
+Math::Vector3D TextureStorage::texel(int level, int x, int y) const {
+    const Level& texels = _levels[std::clamp(level, 0, getLevelCount() - 1)];
+    const float *value = &_texels[address(texels, std::clamp(x, 0, texels.width - 1),
+        std::clamp(y, 0, texels.height - 1))];
+
+    if (_components == 1)
+        return Math::Vector3D(Math::Coords{value[0], value[0], value[0]});
+    return Math::Vector3D(Math::Coords{value[0], value[1], value[2]});
+}
+
+double TextureStorage::wrapCoordinate(double coord) {
+    if (std::isnan(coord) || std::isinf(coord)) {
+        return 0.0;
+    }
+
+    double result = std::fmod(coord, 1.0);
+    if (result < 0) {
+        result += 1.0;
+    }
+    return result;
+}
+
+Math::Vector3D TextureStorage::sample(const Math::Vector2D& uv, double footprint,
+    bool bilinear) const {
+    double u = wrapCoordinate(uv.U);
+    double v = 1.0 - wrapCoordinate(uv.V);
+    // Level whose texels are as wide as the footprint
+    double lod = footprint > 0.0 ?
+        std::log2(footprint * std::max(getWidth(), getHeight())) : 0.0;
+
+    if (!(lod > 0.0))
+        return bilinear ? bilinearSample(_levels.front(), u, v) : nearestSample(_levels.front(), u, v);
+    lod = std::min(lod, static_cast<double>(getLevelCount() - 1));
+    if (!bilinear)
+        return nearestSample(_levels[static_cast<int>(std::lround(lod))], u, v);
+
+    int fine = static_cast<int>(lod);
+    int coarse = std::min(fine + 1, getLevelCount() - 1);
+    double t = lod - fine;
+    return bilinearSample(_levels[fine], u, v) * (1.0 - t) + bilinearSample(_levels[coarse], u, v) * t;
+}
+
+Math::Vector3D TextureStorage::nearestSample(const Level& level, double u, double v) const {
+    int x = std::clamp(static_cast<int>(u * level.width), 0, level.width - 1);
+    int y = std::clamp(static_cast<int>(v * level.height), 0, level.height - 1);
+    const float *value = &_texels[address(level, x, y)];
+
+    if (_components == 1)
+        return Math::Vector3D(Math::Coords{value[0], value[0], value[0]});
+    return Math::Vector3D(Math::Coords{value[0], value[1], value[2]});
+}
+
+Math::Vector3D TextureStorage::bilinearSample(const Level& level, double u, double v) const {
+    double x = u * (level.width - 1);
+    double y = v * (level.height - 1);
+    int x0 = static_cast<int>(std::floor(x));
+    int y0 = static_cast<int>(std::floor(y));
+    int x1 = std::min(x0 + 1, level.width - 1);
+    int y1 = std::min(y0 + 1, level.height - 1);
+    double tx = x - x0;
+    double ty = y - y0;
+    const float *t00 = &_texels[address(level, x0, y0)];
+    const float *t01 = &_texels[address(level, x1, y0)];
+    const float *t10 = &_texels[address(level, x0, y1)];
+    const float *t11 = &_texels[address(level, x1, y1)];
+    double w00 = (1 - tx) * (1 - ty);
+    double w01 = tx * (1 - ty);
+    double w10 = (1 - tx) * ty;
+    double w11 = tx * ty;
+    double result[3];
+
+    for (int c = 0; c < std::min(_components, 3); ++c)
+        result[c] = w00 * t00[c] + w01 * t01[c] + w10 * t10[c] + w11 * t11[c];
+    if (_components == 1)
+        return Math::Vector3D(Math::Coords{result[0], result[0], result[0]});
+    return Math::Vector3D(Math::Coords{result[0], result[1], result[2]});
+}
+
+}  // namespace RayTracer
@@ -0,0 +1,79 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** TextureStorage - mipmapped, tiled texels shared by the image based textures
+*/
+
+#ifndef SRC_TEXTURE_TEXTURESTORAGE_TEXTURESTORAGE_HPP_
+    #define SRC_TEXTURE_TEXTURESTORAGE_TEXTURESTORAGE_HPP_
+    #include <cstddef>
+    #include <vector>
+    #include "Math/Vector2D/Vector2D.hpp"
+    #include "Math/Vector3D/Vector3D.hpp"
+
+namespace RayTracer {
+
+/**
+ * @brief Texels of an image converted to floats once, with their mip chain
+ *
+ * Each level is stored as TILE_SIZE x TILE_SIZE tiles whose texels follow a
+ * Morton order, so the four texels of a bilinear lookup usually share a
+ * cache line. The storage is immutable once built, textures and their clones
+ * share it.
+ */
+class TextureStorage {
+ public:
+    static constexpr int TILE_SIZE = 8;
+
+    /**
+     * @param data Row-major texels of channels bytes each
+     * @param components Floats kept per texel: 1 for maps that only read
+     * their first channel, 4 for colors (the fourth one is padding)
+     */
+    TextureStorage(const unsigned char *data, int width, int height, int channels,
+        int components);
+
+    int getWidth() const { return _levels.front().width; }
+    int getHeight() const { return _levels.front().height; }
+    int getLevelCount() const { return static_cast<int>(_levels.size()); }
+    // Bytes of texels over all levels
+    size_t getMemorySize() const { return _texels.size() * sizeof(float); }
+
+    /**
+     * @brief Filtered color at uv, wrapped to [0, 1) with v pointing up
+     *
+     * @param footprint Width in uv units of what the lookup covers, e.g. a
+     * pixel seen through a ray differential; 0 samples the full resolution
+     * @param bilinear Bilinear taps, blended between two levels (trilinear)
+     * when footprint covers more than a texel; the nearest texel otherwise
+     * @return Components in [0, 1]; one component maps return it in X, Y and Z
+     */
+    Math::Vector3D sample(const Math::Vector2D& uv, double footprint, bool bilinear) const;
+
+    // Texel (x, y) of level, clamped to its size
+    Math::Vector3D texel(int level, int x, int y) const;
+
+ private:
+    struct Level {
+        int width;
+        int height;
+        int tilesX;
+        size_t offset;
+    };
+
+    std::vector<Level> _levels;
+    std::vector<float> _texels;
+    int _components;
+
+    void addLevel(const std::vector<float>& linear, int width, int height);
+    size_t address(const Level& level, int x, int y) const;
+    Math::Vector3D nearestSample(const Level& level, double u, double v) const;
+    Math::Vector3D bilinearSample(const Level& level, double u, double v) const;
+    static double wrapCoordinate(double coord);
+};
+
+}  // namespace RayTracer
+
+#endif  // SRC_TEXTURE_TEXTURESTORAGE_TEXTURESTORAGE_HPP_
@@ -0,0 +1,107 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** ObjectTransform implementation
+*/
+#include <cmath>
+#include "Transformation/ObjectTransform/ObjectTransform.hpp"
+#include "Transformation/Rotate/Rotate.hpp"
+
+namespace RayTracer {
+
+namespace {
+
+Math::Matrix3x3 rotationMatrix(int axis, double degrees) {
+    Math::Matrix3x3 result;
+    if (degrees == 0.0)
+        return result;
+    double cosA = std::cos(toRadians(degrees));
+    double sinA = std::sin(toRadians(degrees));
+    int a = (axis + 1) % 3;
+    int b = (axis + 2) % 3;
+    result.m[a][a] = cosA;
+    result.m[a][b] = -sinA;
+    result.m[b][a] = sinA;
+    result.m[b][b] = cosA;
+    return result;
+}
+
+}  // namespace
+
+void ObjectTransform::setRotation(double rotationX, double rotationY, double rotationZ) {
+    Math::Matrix3x3 linear = rotationMatrix(2, rotationZ)
+        * rotationMatrix(1, rotationY) * rotationMatrix(0, rotationX);
+    Math::Vector3D zero(Math::Coords{0.0, 0.0, 0.0});
+
+    _objectToWorld = Math::Matrix3x4(linear, zero);
+    // The inverse of a rotation is its transpose, exact unlike a general inverse
+    _worldToObject = Math::Matrix3x4(linear.transpose(), zero);
+    _identity = rotationX == 0.0 && rotationY == 0.0 && rotationZ == 0.0;
+}
+
+Ray ObjectTransform::toObject(const Ray &ray) const {
+    if (_identity)
+        return ray;
+    // t is unchanged by the transform, so is the cone width at t
+    Ray result(_worldToObject * ray.origin, _worldToObject * ray.direction);
+    result.spread = ray.spread;
+    return result;
+}
+
+RayPacket ObjectTransform::toObject(const RayPacket &packet) const {
+    if (_identity)
+        return packet;
+    RayPacket result;
+    const double (&m)[3][3] = _worldToObject.linear.m;
+    const Math::Vector3D &t = _worldToObject.translation;
+
+    result.count = packet.count;
+    for (int lane = 0; lane < packet.count; lane++) {
+        double ox = packet.originX[lane];
+        double oy = packet.originY[lane];
+        double oz = packet.originZ[lane];
+        double dx = packet.directionX[lane];
+        double dy = packet.directionY[lane];
+        double dz = packet.directionZ[lane];
+        result.originX[lane] = m[0][0] * ox + m[0][1] * oy + m[0][2] * oz + t.X;
+        result.originY[lane] = m[1][0] * ox + m[1][1] * oy + m[1][2] * oz + t.Y;
+        result.originZ[lane] = m[2][0] * ox + m[2][1] * oy + m[2][2] * oz + t.Z;
+        result.directionX[lane] = m[0][0] * dx + m[0][1] * dy + m[0][2] * dz;
+        result.directionY[lane] = m[1][0] * dx + m[1][1] * dy + m[1][2] * dz;
+        result.directionZ[lane] = m[2][0] * dx + m[2][1] * dy + m[2][2] * dz;
+        result.inverseX[lane] = RayPacket::safeInverse(result.directionX[lane]);
+        result.inverseY[lane] = RayPacket::safeInverse(result.directionY[lane]);
+        result.inverseZ[lane] = RayPacket::safeInverse(result.directionZ[lane]);
+        result.spread[lane] = packet.spread[lane];
+    }
+    return result;
+}
+
+Math::Point3D ObjectTransform::pointToWorld(const Math::Point3D &point) const {
+    if (_identity)
+        return point;
+    return _objectToWorld * point;
+}
+
+Math::Vector3D ObjectTransform::vectorToWorld(const Math::Vector3D &vector) const {
+    if (_identity)
+        return vector;
+    return _objectToWorld * vector;
+}
+
+Math::Vector3D ObjectTransform::normalToWorld(const Math::Vector3D &normal) const {
+    return vectorToWorld(normal);
+}
+
+Math::AABB ObjectTransform::boxToWorld(const Math::AABB &box) const {
+    if (_identity || !box.isBounded())
+        return box;
+    Math::AABB result;
+    for (int i = 0; i < 8; i++)
+        result.expand(_objectToWorld * box.corner(i));
+    return result;
+}
+
+}  // namespace RayTracer
@@ -0,0 +1,54 @@
+// Copyright <2025> Epitech
+/*
+** EPITECH PROJECT, 2025
+** Raytracer
+** File description:
+** ObjectTransform - cached world/object matrices of a primitive
+*/
+
+#ifndef SRC_TRANSFORMATION_OBJECTTRANSFORM_OBJECTTRANSFORM_HPP_
+#define SRC_TRANSFORMATION_OBJECTTRANSFORM_OBJECTTRANSFORM_HPP_
+#include "Math/AABB/AABB.hpp"
+#include "Math/Matrix3x4/Matrix3x4.hpp"
+#include "Ray/Ray.hpp"
+#include "Ray/RayPacket.hpp"
+
+namespace RayTracer {
+
+/**
+ * @brief World-to-object and object-to-world matrices of a primitive
+ * They are rebuilt by setRotation() when the primitive rotates, so hit() only
+ * does matrix products instead of recomputing sines and cosines per ray
+ */
+class ObjectTransform {
+ public:
+    ObjectTransform() = default;
+
+    /**
+     * @brief Rebuilds the matrices from the total rotation angles in degrees
+     * Objects rotate by X then Y then Z, rays are brought back by -Z then -Y then -X
+     */
+    void setRotation(double rotationX, double rotationY, double rotationZ);
+
+    bool isIdentity() const { return _identity; }
+
+    Ray toObject(const Ray &ray) const;
+    RayPacket toObject(const RayPacket &packet) const;
+    Math::Point3D pointToWorld(const Math::Point3D &point) const;
+    Math::Vector3D vectorToWorld(const Math::Vector3D &vector) const;
+    // Rotations keep normals perpendicular to the surface, so they map like vectors
+    Math::Vector3D normalToWorld(const Math::Vector3D &normal) const;
+    Math::AABB boxToWorld(const Math::AABB &box) const;
+
+    const Math::Matrix3x4 &getWorldToObject() const { return _worldToObject; }
+    const Math::Matrix3x4 &getObjectToWorld() const { return _objectToWorld; }
+
+ private:
+    Math::Matrix3x4 _worldToObject;
+    Math::Matrix3x4 _objectToWorld;
+    bool _identity = true;
+};
+
+}  // namespace RayTracer
+
+#endif  // SRC_TRANSFORMATION_OBJECTTRANSFORM_OBJECTTRANSFORM_HPP_
@@ -5,9 +5,11 @@
 ** File description:
 ** Rotate transformation implementation
 */
+#include <cmath>
 #include <stdexcept>
 #include <string>
 #include "Transformation/Rotate/Rotate.hpp"
+#include "Transformation/ObjectTransform/ObjectTransform.hpp"
 #include "Math/Vector3D/Vector3D.hpp"
 #include "Math/Point3D/Point3D.hpp"
 
@@ -15,63 +17,43 @@
 namespace RayTracer {
 
 Rotate::Rotate(const std::string& axis, double angle)
-: axis(axis), angle(angle) {
+: axis(axis.empty() ? '\0' : axis[0]), angle(angle),
+cosAngle(std::cos(toRadians(angle))), sinAngle(std::sin(toRadians(angle))) {
     if (axis != "x" && axis != "y" && axis != "z")
         throw std::invalid_argument("Rotation axis must be x, y, or z");
 }
 
 Math::Vector3D Rotate::applyToVector(const Math::Vector3D& v) const {
-    double radians = angle * M_PI / 180.0;
-    double cosA = std::cos(radians);
-    double sinA = std::sin(radians);
-
-    if (axis == "x") {
-        double rad = toRadians(angle);
-        double cosA = std::cos(rad);
-        double sinA = std::sin(rad);
-        const Math::Coords coords{v.X, v.Y * cosA - v.Z * sinA, v.Y * sinA + v.Z * cosA};
-
-        return Math::Vector3D(coords);
-
-    } else if (axis == "y") {
-        double rad = toRadians(angle);
-        double cosA = std::cos(rad);
-        double sinA = std::sin(rad);
-        const Math::Coords coords{v.X * cosA + v.Z * sinA, v.Y, v.Z * cosA - v.X * sinA};
-
-        return Math::Vector3D(coords);
-    } else {
-        double rad = toRadians(angle);
-        double cosA = std::cos(rad);
-        double sinA = std::sin(rad);
-        const Math::Coords coords{v.X * cosA - v.Y * sinA, v.X * sinA + v.Y * cosA, v.Z};
-
-        return Math::Vector3D(coords);
-    }
+    if (axis == 'x')
+        return Math::Vector3D(Math::Coords{v.X,
+            v.Y * cosAngle - v.Z * sinAngle, v.Y * sinAngle + v.Z * cosAngle});
+    if (axis == 'y')
+        return Math::Vector3D(Math::Coords{v.X * cosAngle + v.Z * sinAngle,
+            v.Y, v.Z * cosAngle - v.X * sinAngle});
+    return Math::Vector3D(Math::Coords{v.X * cosAngle - v.Y * sinAngle,
+        v.X * sinAngle + v.Y * cosAngle, v.Z});
 }
 
 Math::Point3D Rotate::applyToPoint(const Math::Point3D& p) const {
-    double radians = angle * M_PI / 180.0;
-    double cosA = std::cos(radians);
-    double sinA = std::sin(radians);
+    Math::Vector3D v = applyToVector(Math::Vector3D(Math::Coords{p.X, p.Y, p.Z}));
+    return Math::Point3D(Math::Coords{v.X, v.Y, v.Z});
+}
 
-    if (axis == "x") {
-        const Math::Coords coords_vec{p.X, p.Y, p.Z};
-        Math::Vector3D v = Rotate("x", angle).applyToVector(Math::Vector3D(coords_vec));
-        const Math::Coords coords_point{v.X, v.Y, v.Z};
-        return Math::Point3D(coords_point);
-    } else if (axis == "y") {
-        const Math::Coords coords_vec{p.X, p.Y, p.Z};
-        Math::Vector3D v = Rotate("y", angle).applyToVector(Math::Vector3D(coords_vec));
-        const Math::Coords coords_point{v.X, v.Y, v.Z};
-        return Math::Point3D(coords_point);
-    } else {
-        const Math::Coords coords_vec{p.X, p.Y, p.Z};
-        Math::Vector3D v = Rotate("z", angle).applyToVector(Math::Vector3D(coords_vec));
-        const Math::Coords coords_point{v.X, v.Y, v.Z};
-        return Math::Point3D(coords_point);
-    }
+Math::AABB Rotate::applyToBox(const Math::AABB& box) const {
+    if (!box.isBounded())
+        return box;
+    Math::AABB result;
+    for (int i = 0; i < 8; i++)
+        result.expand(applyToPoint(box.corner(i)));
+    return result;
 }
 
+Math::AABB rotateBoundingBox(const Math::AABB& box,
+double rotationX, double rotationY, double rotationZ) {
+    ObjectTransform transform;
+
+    transform.setRotation(rotationX, rotationY, rotationZ);
+    return transform.boxToWorld(box);
+}
 
 }  // namespace RayTracer
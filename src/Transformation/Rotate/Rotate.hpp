@@ -10,6 +10,7 @@
     #define SRC_TRANSFORMATION_ROTATE_ROTATE_HPP_
     #include <string>
     #include "Transformation/ITransformation.hpp"
+    #include "Math/AABB/AABB.hpp"
 
 namespace RayTracer {
 
@@ -17,8 +18,10 @@ inline double toRadians(double degrees) { return degrees * M_PI / 180.0; }
 
 class Rotate : public ITransformation {
  private:
-    std::string axis;
+    char axis;
     double angle;
+    double cosAngle;
+    double sinAngle;
 
  public:
     Rotate(const std::string& axis, double angle);
@@ -26,8 +29,14 @@ class Rotate : public ITransformation {
 
     Math::Vector3D applyToVector(const Math::Vector3D& vector) const override;
     Math::Point3D applyToPoint(const Math::Point3D& point) const override;
+    Math::AABB applyToBox(const Math::AABB& box) const;
 };
 
+// Maps object-space bounds to world space, rotating by X then Y then Z
+// like ObjectTransform::boxToWorld()
+Math::AABB rotateBoundingBox(const Math::AABB& box,
+    double rotationX, double rotationY, double rotationZ);
+
 }  // namespace RayTracer
 
 #endif  // SRC_TRANSFORMATION_ROTATE_ROTATE_HPP_
@@ -48,7 +48,14 @@ struct HitInfo {
     Math::Point3D hitPoint;
     Math::Vector3D normal;
     Math::Vector2D uv;
-    std::shared_ptr<IPrimitive> primitive;
+    // Not owning: the scene keeps its primitives alive, so hits stay free of refcounting
+    IPrimitive *primitive = nullptr;
+};
+
+// Result of a closest-hit search: the surface to evaluate and how far it is
+struct ClosestHit {
+    double distance;
+    IPrimitive *primitive = nullptr;
 };
 
 }  // namespace RayTracer
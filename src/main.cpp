@@ -45,8 +45,9 @@
 // Primitives
 #include "Primitive/CompositePrimitive/CompositePrimitive.hpp"
 
-// Lights and Materials
+// Lights, Materials and Textures
 #include "Material/Material.hpp"
+#include "Texture/TextureCache/TextureCache.hpp"
 #include "Light/DirectionalLight/DirectionalLight.hpp"
 #include "Light/AmbientLight/AmbientLight.hpp"
 #include "Light/PointLight/PointLight.hpp"
@@ -57,49 +58,13 @@
 #include "Ray/Ray.hpp"
 
 
-void renderToPPM(const RayTracer::Scene& scene, const RayTracer::Camera& camera,
-                 int width, int height, const std::string& filename) {
-    std::ofstream outFile(filename);
-    if (!outFile.is_open()) {
-        throw RayTracer::FileIOException(filename, "open", "Could not open file for writing");
-    }
-
-    outFile << "P3\n" << width << " " << height << "\n255\n";
-
-    std::streambuf* oldCoutStreamBuf = std::cout.rdbuf();
-    std::cout.rdbuf(outFile.rdbuf());
-
-    int samplesPerPixel = 1;
-    for (const auto& postProcess : scene.getPostProcessEffects()) {
-        if (postProcess->getTypeName() == "supersampling") {
-            samplesPerPixel = static_cast<int>(postProcess->getParameter("samples"));
-            break;
-        }
-    }
-
-    const_cast<RayTracer::Scene&>(scene).setImageDimensions(width, height);
-    for (int j = height - 1; j >= 0; j--) {
-        for (int i = 0; i < width; i++) {
-            double u = static_cast<double>(i) / (width - 1);
-            double v = static_cast<double>(j) / (height - 1);
-            Math::Vector3D pixelColor;
-            if (samplesPerPixel > 1) {
-                pixelColor = camera.supersampleRay(u, v, scene, samplesPerPixel);
-            } else {
-                RayTracer::Ray ray = camera.ray(u, v);
-                pixelColor = scene.computeColor(ray, false);
-            }
-            scene.writeColor(pixelColor);
-        }
-    }
-    std::cout.rdbuf(oldCoutStreamBuf);
-    outFile.close();
-}
-
 int main(int argc, char **argv) {
     const int image_width = WIDTH;
     const int image_height = HEIGHT;
     bool displayMode = false;
+    unsigned int threadCount = 0;
+    bool progressive = true;
+    RayTracer::Sampler::Pattern samplerPattern = RayTracer::Sampler::Pattern::Sobol;
     std::string outputFile = "output.ppm";
 
     RayTracer::SceneDirector director;
@@ -115,14 +80,38 @@ int main(int argc, char **argv) {
                 sceneFile = argv[++i];
             } else if (arg == "--output" && i + 1 < argc) {
                 outputFile = argv[++i];
+            } else if (arg == "--threads" && i + 1 < argc) {
+                int requested = std::stoi(argv[++i]);
+                if (requested < 0 || requested > 4096)
+                    throw RayTracer::ValueRangeException("threads", requested, 0, 4096);
+                threadCount = static_cast<unsigned int>(requested);
+            } else if (arg == "--sampler" && i + 1 < argc) {
+                std::string name = argv[++i];
+                auto pattern = RayTracer::Sampler::patternFromName(name);
+                if (!pattern)
+                    throw RayTracer::InvalidOperationException("--sampler " + name,
+                        "expected independent, stratified, halton, sobol or bluenoise");
+                samplerPattern = *pattern;
+            } else if (arg == "--texture-budget" && i + 1 < argc) {
+                int megabytes = std::stoi(argv[++i]);
+                if (megabytes < 0 || megabytes > (1 << 20))
+                    throw RayTracer::ValueRangeException("texture-budget", megabytes, 0, 1 << 20);
+                RayTracer::TextureCache::getInstance().setMemoryBudget(
+                    static_cast<size_t>(megabytes) * 1024 * 1024);
+            } else if (arg == "--no-progressive") {
+                progressive = false;
             } else if (arg == "--graphic") {
                 displayMode = true;
             } else if (arg == "--help") {
                 std::cout << "Usage: ./raytracer [options]\n"
                           << "Options:\n"
                           << "  --file <filename>    Specify scene file (default: scenes/default_scene.cfg)\n"
-                          << "  --output <filename>  Specify output PPM file (default: output.ppm)\n"
+                          << "  --output <filename>  Specify output image, PNG if it ends in .png, PPM otherwise (default: output.ppm)\n"
+                          << "  --threads <count>    Number of render threads (default: 0, every hardware thread)\n"
                           << "  --graphic            Render in a window (doesn't create a .ppm)\n"
+                          << "  --sampler <pattern>  Sample placement: independent, stratified, halton, sobol or bluenoise (default: sobol)\n"
+                          << "  --texture-budget <MiB> Memory the texture cache keeps decoded images in (default: 512)\n"
+                          << "  --no-progressive     In a window, redraw every frame instead of refining a still image\n"
                           << "  --help               Display this help message\n";
                 return 0;
             } else if (i == 1 && arg[0] != '-') {
@@ -136,15 +125,20 @@ int main(int argc, char **argv) {
             throw RayTracer::SceneImportException(sceneFile, "Scene creation failed without specific error");
         auto camera = std::make_shared<RayTracer::Camera>(scene->getCamera());
 
-        if (!displayMode)
-            renderToPPM(*scene, *camera, image_width, image_height, outputFile);
+        if (!displayMode) {
+            RayTracer::Renderer renderer(threadCount);
+            renderer.setSamplerPattern(samplerPattern);
+            renderer.renderToFile(*scene, *camera, image_width, image_height, outputFile);
+        }
 
         if (displayMode) {
             auto displayManager = std::make_shared<RayTracer::SFMLDisplayManager>();
             displayManager->initialize(image_width, image_height, "Raytracer", false);
 
             auto eventsManager = std::make_shared<RayTracer::SFMLEventsManager>(displayManager->getWindow());
-            RayTracer::Renderer renderer(displayManager);
+            RayTracer::Renderer renderer(displayManager, threadCount);
+            renderer.setProgressive(progressive);
+            renderer.setSamplerPattern(samplerPattern);
 
             RayTracer::InputManager inputManager(eventsManager, image_width, image_height);
 
@@ -153,6 +147,7 @@ int main(int argc, char **argv) {
             while (displayManager->isWindowOpen()) {
                 scene->setCamera(*camera);
                 scene->updatePrimitiveCache();
+                scene->refitAccelerationStructure();
                 renderer.drawScene(*scene, *camera, inputManager.isMoving());
                 inputManager.processInput(scene, camera);
                 if (eventsManager->isKeyPressed("ESCAPE"))
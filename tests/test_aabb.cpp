@@ -0,0 +1,96 @@
+/*
+** EPITECH PROJECT, 2025
+** B-OOP-400 Raytracer
+** File description:
+** Test for AABB class
+*/
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include "../src/Math/AABB/AABB.hpp"
+#include "../src/Math/Point3D/Point3D.hpp"
+#include "../src/Math/Vector3D/Vector3D.hpp"
+#include "../src/Transformation/Rotate/Rotate.hpp"
+
+namespace RayTracerTest {
+
+class AABBTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        unitBox = Math::AABB(Math::Point3D(Math::Coords{-1, -1, -1}),
+            Math::Point3D(Math::Coords{1, 1, 1}));
+    }
+
+    Math::AABB unitBox;
+};
+
+TEST_F(AABBTest, DefaultIsEmptyTest) {
+    Math::AABB box;
+
+    EXPECT_TRUE(box.isEmpty());
+    EXPECT_FALSE(box.isBounded());
+    EXPECT_DOUBLE_EQ(0.0, box.surfaceArea());
+}
+
+TEST_F(AABBTest, ExpandTest) {
+    Math::AABB box;
+    box.expand(Math::Point3D(Math::Coords{1, 2, 3}));
+    box.expand(Math::Point3D(Math::Coords{-1, 0, 5}));
+
+    EXPECT_DOUBLE_EQ(-1.0, box.min.X);
+    EXPECT_DOUBLE_EQ(0.0, box.min.Y);
+    EXPECT_DOUBLE_EQ(3.0, box.min.Z);
+    EXPECT_DOUBLE_EQ(1.0, box.max.X);
+    EXPECT_DOUBLE_EQ(2.0, box.max.Y);
+    EXPECT_DOUBLE_EQ(5.0, box.max.Z);
+
+    Math::AABB merged = box;
+    merged.expand(Math::AABB());
+    EXPECT_DOUBLE_EQ(box.min.X, merged.min.X);
+    EXPECT_DOUBLE_EQ(box.max.Z, merged.max.Z);
+}
+
+TEST_F(AABBTest, MeasuresTest) {
+    EXPECT_TRUE(unitBox.isBounded());
+    EXPECT_DOUBLE_EQ(24.0, unitBox.surfaceArea());
+    EXPECT_DOUBLE_EQ(0.0, unitBox.centroid().X);
+
+    Math::AABB wide(Math::Point3D(Math::Coords{0, 0, 0}),
+        Math::Point3D(Math::Coords{1, 4, 2}));
+    EXPECT_EQ(1, wide.longestAxis());
+    EXPECT_DOUBLE_EQ(4.0, wide.corner(7).Y);
+    EXPECT_DOUBLE_EQ(0.0, wide.corner(0).Y);
+}
+
+TEST_F(AABBTest, InfiniteTest) {
+    Math::AABB box = Math::AABB::infinite();
+
+    EXPECT_FALSE(box.isEmpty());
+    EXPECT_FALSE(box.isBounded());
+}
+
+TEST_F(AABBTest, IntersectTest) {
+    Math::Point3D origin(Math::Coords{0, 0, -5});
+    Math::Vector3D invDirection(Math::Coords{1.0 / 0.0, 1.0 / 0.0, 1.0});
+    double entry = 0.0;
+
+    EXPECT_TRUE(unitBox.intersect(origin, invDirection, 0.0, 100.0, entry));
+    EXPECT_DOUBLE_EQ(4.0, entry);
+    EXPECT_FALSE(unitBox.intersect(origin, invDirection, 0.0, 3.0, entry));
+
+    Math::Point3D missOrigin(Math::Coords{3, 0, -5});
+    EXPECT_FALSE(unitBox.intersect(missOrigin, invDirection, 0.0, 100.0, entry));
+}
+
+TEST_F(AABBTest, RotatedBoundsTest) {
+    Math::AABB flat(Math::Point3D(Math::Coords{-2, -0.5, -0.5}),
+        Math::Point3D(Math::Coords{2, 0.5, 0.5}));
+    Math::AABB rotated = RayTracer::rotateBoundingBox(flat, 0.0, 0.0, 90.0);
+
+    EXPECT_NEAR(-0.5, rotated.min.X, 1e-9);
+    EXPECT_NEAR(0.5, rotated.max.X, 1e-9);
+    EXPECT_NEAR(-2.0, rotated.min.Y, 1e-9);
+    EXPECT_NEAR(2.0, rotated.max.Y, 1e-9);
+}
+
+}  // namespace RayTracerTest
@@ -0,0 +1,103 @@
+/*
+** EPITECH PROJECT, 2025
+** B-OOP-400 Raytracer
+** File description:
+** Test for BlurPostProcess class
+*/
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "../src/PostProcess/BlurPostProcess/BlurPostProcess.hpp"
+#include "../src/Renderer/ThreadPool/RenderThreadPool.hpp"
+
+namespace RayTracerTest {
+
+class BlurPostProcessTest : public ::testing::Test {
+ protected:
+    static std::vector<Math::Vector3D> randomFrame(int width, int height) {
+        std::mt19937 generator(7);
+        std::uniform_real_distribution<double> channel(0.0, 1.0);
+        std::vector<Math::Vector3D> frame(width * height);
+        for (Math::Vector3D &pixel : frame)
+            pixel = Math::Vector3D(Math::Coords{channel(generator), channel(generator),
+                channel(generator)});
+        return frame;
+    }
+
+    // The full 2D Gaussian kernel the blur used before it was split in two passes
+    static std::vector<Math::Vector3D> reference(const std::vector<Math::Vector3D> &frame,
+        int width, int height, double radius) {
+        std::vector<Math::Vector3D> result(frame.size());
+        int half = static_cast<int>(radius * 2 + 1) / 2;
+        double sigma = radius / 3.0;
+        double twoSigmaSquared = 2.0 * sigma * sigma;
+
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                double sumR = 0.0;
+                double sumG = 0.0;
+                double sumB = 0.0;
+                double weightSum = 0.0;
+                for (int ky = -half; ky <= half; ++ky) {
+                    for (int kx = -half; kx <= half; ++kx) {
+                        int sampleX = x + kx;
+                        int sampleY = y + ky;
+                        if (sampleX < 0 || sampleX >= width || sampleY < 0 || sampleY >= height)
+                            continue;
+                        double weight = std::exp(-(kx * kx + ky * ky) / twoSigmaSquared);
+                        const Math::Vector3D &sample = frame[sampleY * width + sampleX];
+                        sumR += sample.X * weight;
+                        sumG += sample.Y * weight;
+                        sumB += sample.Z * weight;
+                        weightSum += weight;
+                    }
+                }
+                result[y * width + x] = Math::Vector3D(
+                    Math::Coords{sumR / weightSum, sumG / weightSum, sumB / weightSum});
+            }
+        }
+        return result;
+    }
+};
+
+TEST_F(BlurPostProcessTest, SeparableMatchesFullKernelTest) {
+    const int width = 37;
+    const int height = 41;
+    std::vector<Math::Vector3D> frame = randomFrame(width, height);
+
+    // Kernels wider than the frame renormalize at both borders at once
+    for (double radius : {1.0, 2.5, 3.0, 7.0, 25.0}) {
+        RayTracer::BlurPostProcess blur(radius);
+        std::vector<Math::Vector3D> expected = reference(frame, width, height, radius);
+        std::vector<Math::Vector3D> blurred = blur.processFrameBuffer(frame, width, height);
+        ASSERT_EQ(expected.size(), blurred.size());
+        for (size_t i = 0; i < expected.size(); i++) {
+            EXPECT_NEAR(expected[i].X, blurred[i].X, 1e-12) << "radius " << radius << " pixel " << i;
+            EXPECT_NEAR(expected[i].Y, blurred[i].Y, 1e-12) << "radius " << radius << " pixel " << i;
+            EXPECT_NEAR(expected[i].Z, blurred[i].Z, 1e-12) << "radius " << radius << " pixel " << i;
+        }
+    }
+}
+
+TEST_F(BlurPostProcessTest, ParallelBandsMatchSerialTest) {
+    const int width = 23;
+    const int height = 70;
+    std::vector<Math::Vector3D> frame = randomFrame(width, height);
+    RayTracer::BlurPostProcess blur(4.0);
+    RayTracer::RenderThreadPool pool(4);
+
+    std::vector<Math::Vector3D> serial = blur.processFrameBuffer(frame, width, height);
+    std::vector<Math::Vector3D> parallel = frame;
+    std::vector<Math::Vector3D> scratch;
+    blur.processInPlace(parallel, scratch, width, height,
+        [&pool](int count, const std::function<void(int)> &task) { pool.run(count, task); });
+    for (size_t i = 0; i < serial.size(); i++) {
+        EXPECT_EQ(serial[i].X, parallel[i].X);
+        EXPECT_EQ(serial[i].Y, parallel[i].Y);
+        EXPECT_EQ(serial[i].Z, parallel[i].Z);
+    }
+}
+
+}  // namespace RayTracerTest
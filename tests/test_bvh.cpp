@@ -0,0 +1,183 @@
+/*
+** EPITECH PROJECT, 2025
+** B-OOP-400 Raytracer
+** File description:
+** Test file for the BVH acceleration structure
+*/
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include "../src/Primitive/BVH/BVH.hpp"
+#include "../src/Primitive/Sphere/Sphere.hpp"
+#include "../src/Primitive/Plane/Plane.hpp"
+#include "../src/Primitive/Box/Box.hpp"
+#include "../src/Ray/Ray.hpp"
+
+namespace RayTracerTest {
+
+class BVHTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        for (int i = 0; i < 20; i++) {
+            Math::Point3D center(Math::Coords{i * 3.0, 0.0, -10.0});
+            primitives.push_back(std::make_shared<RayTracer::Sphere>(center, 1.0));
+        }
+        primitives.push_back(std::make_shared<RayTracer::Plane>(
+            Math::Point3D(Math::Coords{0, -5, 0}),
+            Math::Vector3D(Math::Coords{0, 1, 0})));
+        bvh.build(primitives);
+    }
+
+    std::vector<std::shared_ptr<RayTracer::IPrimitive>> primitives;
+    RayTracer::BVH bvh;
+};
+
+TEST_F(BVHTest, BuildTest) {
+    EXPECT_TRUE(bvh.isBuilt());
+    EXPECT_NEAR(-1.0, bvh.getBounds().min.X, 1e-9);
+    EXPECT_NEAR(58.0, bvh.getBounds().max.X, 1e-9);
+
+    bvh.clear();
+    EXPECT_FALSE(bvh.isBuilt());
+}
+
+TEST_F(BVHTest, ClosestHitMatchesLinearTest) {
+    for (int i = 0; i < 60; i++) {
+        RayTracer::Ray ray(Math::Point3D(Math::Coords{i - 2.0, 0.3, 0.0}),
+            Math::Vector3D(Math::Coords{0.05, -0.1, -1.0}));
+        std::optional<RayTracer::HitInfo> expected;
+        double closest = 1e9;
+
+        for (const auto &primitive : primitives) {
+            auto hit = primitive->hit(ray, 0.001, closest);
+            if (hit) {
+                expected = hit;
+                closest = hit->distance;
+            }
+        }
+        auto hit = bvh.hit(ray, 0.001, 1e9);
+        ASSERT_EQ(expected.has_value(), hit.has_value());
+        if (hit) {
+            EXPECT_DOUBLE_EQ(expected->distance, hit->distance);
+            EXPECT_EQ(expected->primitive, hit->primitive);
+        }
+    }
+}
+
+TEST_F(BVHTest, DistanceOnlyClosestHitTest) {
+    primitives.push_back(std::make_shared<RayTracer::Box>(
+        Math::Point3D(Math::Coords{30, 0, -6}), Math::Vector3D(Math::Coords{2, 2, 1})));
+    bvh.build(primitives);
+    for (int i = 0; i < 60; i++) {
+        RayTracer::Ray ray(Math::Point3D(Math::Coords{i - 2.0, 0.3, 0.0}),
+            Math::Vector3D(Math::Coords{0.05, -0.1, -1.0}));
+        auto hit = bvh.hit(ray, 0.001, 1e9);
+        auto closest = bvh.closestHit(ray, 0.001, 1e9);
+
+        ASSERT_EQ(hit.has_value(), closest.has_value());
+        if (!hit)
+            continue;
+        EXPECT_DOUBLE_EQ(hit->distance, closest->distance);
+        EXPECT_EQ(hit->primitive, closest->primitive);
+        // hit() on the winner within that distance finds the same surface
+        EXPECT_TRUE(closest->primitive->hit(ray, 0.001, closest->distance).has_value());
+    }
+}
+
+TEST_F(BVHTest, UnboundedPrimitiveTest) {
+    RayTracer::Ray ray(Math::Point3D(Math::Coords{-50, 0, 0}),
+        Math::Vector3D(Math::Coords{0, -1, 0}));
+    auto hit = bvh.hit(ray, 0.001, 1e9);
+
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_DOUBLE_EQ(5.0, hit->distance);
+    EXPECT_TRUE(bvh.anyHit(ray, 0.001, 1e9));
+    EXPECT_FALSE(bvh.anyHit(ray, 0.001, 4.0));
+}
+
+TEST_F(BVHTest, AnyHitTest) {
+    RayTracer::Ray ray(Math::Point3D(Math::Coords{9, 0, 0}),
+        Math::Vector3D(Math::Coords{0, 0, -1}));
+
+    EXPECT_TRUE(bvh.anyHit(ray, 0.001, 100.0));
+    EXPECT_FALSE(bvh.anyHit(ray, 0.001, 5.0));
+}
+
+TEST_F(BVHTest, FindOccluderTest) {
+    RayTracer::Ray ray(Math::Point3D(Math::Coords{9, 0, 0}),
+        Math::Vector3D(Math::Coords{0, 0, -1}));
+
+    EXPECT_EQ(primitives[3].get(), bvh.findOccluder(ray, 0.001, 100.0));
+    EXPECT_TRUE(primitives[3]->occluded(ray, 0.001, 100.0));
+    EXPECT_FALSE(primitives[3]->occluded(ray, 0.001, 5.0));
+    EXPECT_EQ(nullptr, bvh.findOccluder(ray, 0.001, 5.0));
+
+    RayTracer::Ray down(Math::Point3D(Math::Coords{-50, 0, 0}),
+        Math::Vector3D(Math::Coords{0, -1, 0}));
+    EXPECT_EQ(primitives.back().get(), bvh.findOccluder(down, 0.001, 1e9));
+}
+
+TEST_F(BVHTest, RefitAfterTranslateTest) {
+    RayTracer::Ray ray(Math::Point3D(Math::Coords{0, 20, 0}),
+        Math::Vector3D(Math::Coords{0, 0, -1}));
+    EXPECT_FALSE(bvh.hit(ray, 0.001, 100.0).has_value());
+
+    primitives[0]->translate(Math::Vector3D(Math::Coords{0, 20, 0}));
+    bvh.refit();
+    auto hit = bvh.hit(ray, 0.001, 100.0);
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_NEAR(9.0, hit->distance, 1e-9);
+}
+
+TEST_F(BVHTest, SahBuildMatchesLinearTest) {
+    std::vector<std::shared_ptr<RayTracer::IPrimitive>> cluster;
+    for (int i = 0; i < 400; i++) {
+        double x = (i % 20) * 0.7 + ((i * 7) % 5) * 0.05;
+        double y = (i / 20) * 0.6 - ((i * 3) % 4) * 0.1;
+        double radius = 0.1 + (i % 3) * 0.1;
+        cluster.push_back(std::make_shared<RayTracer::Sphere>(
+            Math::Point3D(Math::Coords{x, y, -8.0 - (i % 7)}), radius));
+    }
+    RayTracer::BVH clusterBvh;
+    clusterBvh.build(cluster);
+
+    for (int i = 0; i < 200; i++) {
+        RayTracer::Ray ray(Math::Point3D(Math::Coords{(i % 20) * 0.7, (i / 10) * 0.6, 0.0}),
+            Math::Vector3D(Math::Coords{0.013 * (i % 5), -0.02 * (i % 3), -1.0}));
+        std::optional<RayTracer::HitInfo> expected;
+        double closest = 1e9;
+
+        for (const auto &primitive : cluster) {
+            auto hit = primitive->hit(ray, 0.001, closest);
+            if (hit) {
+                expected = hit;
+                closest = hit->distance;
+            }
+        }
+        auto hit = clusterBvh.hit(ray, 0.001, 1e9);
+        ASSERT_EQ(expected.has_value(), hit.has_value());
+        if (hit) {
+            EXPECT_DOUBLE_EQ(expected->distance, hit->distance);
+        }
+        EXPECT_EQ(expected.has_value(), clusterBvh.anyHit(ray, 0.001, 1e9));
+    }
+}
+
+TEST_F(BVHTest, RotatedBoxBoundsTest) {
+    auto box = std::make_shared<RayTracer::Box>(
+        Math::Point3D(Math::Coords{0, 0, 0}),
+        Math::Vector3D(Math::Coords{2, 0.5, 0.5}));
+    box->rotateZ(90.0);
+    RayTracer::BVH boxBvh;
+    boxBvh.build({box});
+
+    RayTracer::Ray ray(Math::Point3D(Math::Coords{0, 1.5, 5}),
+        Math::Vector3D(Math::Coords{0, 0, -1}));
+    auto expected = box->hit(ray, 0.001, 100.0);
+    auto hit = boxBvh.hit(ray, 0.001, 100.0);
+    ASSERT_EQ(expected.has_value(), hit.has_value());
+    EXPECT_TRUE(hit.has_value());
+}
+
+}  // namespace RayTracerTest
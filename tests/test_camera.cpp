@@ -0,0 +1,92 @@
+/*
+** EPITECH PROJECT, 2025
+** B-OOP-400 Raytracer
+** File description:
+** Test for Camera adaptive supersampling
+*/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include "../src/Camera/Camera.hpp"
+#include "../src/Scene/Scene.hpp"
+#include "../src/Light/PointLight/PointLight.hpp"
+#include "../src/Primitive/Sphere/Sphere.hpp"
+
+namespace RayTracerTest {
+
+TEST(PixelSamplesTest, EmptyTest) {
+    RayTracer::PixelSamples samples;
+    EXPECT_EQ(0, samples.count);
+    EXPECT_EQ(0.0, samples.mean().X);
+    EXPECT_EQ(0.0, samples.mean().Y);
+    EXPECT_EQ(0.0, samples.mean().Z);
+    EXPECT_EQ(0.0, samples.contrast());
+}
+
+TEST(PixelSamplesTest, ContrastInDisplaySpaceTest) {
+    RayTracer::PixelSamples samples;
+    samples.add(Math::Vector3D(Math::Coords{0.25, 0.0, 1.0}));
+    EXPECT_EQ(0.0, samples.contrast());
+    samples.add(Math::Vector3D(Math::Coords{0.0, 0.81, 4.0}));
+
+    EXPECT_EQ(2, samples.count);
+    // The mean stays linear and unclamped
+    EXPECT_DOUBLE_EQ(0.125, samples.mean().X);
+    EXPECT_DOUBLE_EQ(0.405, samples.mean().Y);
+    EXPECT_DOUBLE_EQ(2.5, samples.mean().Z);
+    // The spread is gamma corrected and clamped: 0.5 on red, 0.9 on green, 0 on blue
+    EXPECT_DOUBLE_EQ(0.9, samples.contrast());
+
+    RayTracer::PixelSamples other;
+    other.add(Math::Vector3D(Math::Coords{0.125, 0.09, 1.0}));
+    // Means of 0.405 and 0.09 on green are about 0.636 and 0.3 once displayed
+    EXPECT_NEAR(std::sqrt(0.405) - 0.3, samples.contrastWith(other), 1e-12);
+    EXPECT_DOUBLE_EQ(samples.contrastWith(other), other.contrastWith(samples));
+    EXPECT_EQ(0.0, samples.contrastWith(samples));
+}
+
+TEST(PixelSamplesTest, PilotCountTest) {
+    EXPECT_EQ(1, RayTracer::Camera::pilotCount(0));
+    EXPECT_EQ(1, RayTracer::Camera::pilotCount(1));
+    EXPECT_EQ(1, RayTracer::Camera::pilotCount(2));
+    EXPECT_EQ(2, RayTracer::Camera::pilotCount(4));
+    EXPECT_EQ(3, RayTracer::Camera::pilotCount(6));
+    EXPECT_EQ(4, RayTracer::Camera::pilotCount(8));
+    EXPECT_EQ(4, RayTracer::Camera::pilotCount(64));
+}
+
+TEST(PixelSamplesTest, RefineMatchesSupersampleTest) {
+    RayTracer::Scene scene;
+    scene.setImageDimensions(11, 11);
+    scene.addPrimitive(std::make_shared<RayTracer::Sphere>(Math::Point3D(Math::Coords{0, 0, -5}), 1.0));
+    scene.addLight(std::make_shared<RayTracer::PointLight>(Math::Point3D(Math::Coords{2, 3, 0}),
+        Math::Vector3D(Math::Coords{1, 1, 1})));
+    RayTracer::Camera camera;
+
+    // The pixel at u = 0.6 straddles the silhouette, its samples disagree
+    for (auto pattern : {RayTracer::Sampler::Pattern::Stratified, RayTracer::Sampler::Pattern::Sobol,
+        RayTracer::Sampler::Pattern::Independent}) {
+        for (int samplesPerPixel : {1, 4, 9, 16}) {
+            RayTracer::Sampler sampler(pattern, samplesPerPixel);
+            sampler.startPixel(6, 5);
+            RayTracer::PixelSamples pilot = camera.pilotSamples(0.6, 0.5, scene, samplesPerPixel, sampler);
+            EXPECT_EQ(std::min(samplesPerPixel, RayTracer::Camera::pilotCount(samplesPerPixel)), pilot.count);
+            // With a threshold of 0 no pixel converges on its pilots
+            EXPECT_FALSE(pilot.contrast() < 0.0);
+            if (samplesPerPixel >= 8) {
+                EXPECT_GT(pilot.contrast(), 0.0);
+            }
+            sampler.startPixel(6, 5);
+            Math::Vector3D refined = camera.refineSamples(0.6, 0.5, scene, samplesPerPixel, pilot, sampler);
+            sampler.startPixel(6, 5);
+            Math::Vector3D full = camera.supersampleRay(0.6, 0.5, scene, samplesPerPixel, sampler);
+            EXPECT_EQ(full.X, refined.X) << samplesPerPixel;
+            EXPECT_EQ(full.Y, refined.Y) << samplesPerPixel;
+            EXPECT_EQ(full.Z, refined.Z) << samplesPerPixel;
+        }
+    }
+}
+
+}  // namespace RayTracerTest
@@ -0,0 +1,151 @@
+/*
+** EPITECH PROJECT, 2025
+** B-OOP-400 Raytracer
+** File description:
+** Test for Fractal primitive and fractal types
+*/
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../src/Primitive/Fractal/Fractal.hpp"
+#include "../src/Primitive/SdfMarcher/SdfMarcher.hpp"
+
+namespace RayTracerTest {
+
+class FractalTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        for (int i = 0; i < RayTracer::IFractalType::BATCH_SIZE; i++)
+            points.push_back(Math::Point3D(Math::Coords{-0.9 + 0.25 * i, 0.4 - 0.1 * i, 0.05 * i}));
+    }
+
+    const std::vector<std::string> typeNames = {"mandelbrot", "julia", "mandelbox",
+        "menger_sponge", "sierpinski_tetrahedron", "quaternion_julia"};
+    const Math::Point3D center{Math::Coords{0.1, -0.2, 0.3}};
+    std::vector<Math::Point3D> points;
+};
+
+TEST_F(FractalTest, BatchMatchesScalarTest) {
+    for (const std::string &name : typeNames) {
+        auto type = RayTracer::FractalTypeFactory::getInstance().createFractalType(name);
+        for (double power : {2.0, 3.0}) {
+            for (int count : {1, 3, RayTracer::IFractalType::BATCH_SIZE}) {
+                double distances[RayTracer::IFractalType::BATCH_SIZE];
+                type->distanceEstimatorN(points.data(), count, distances, center, 12, 4.0, power);
+                for (int i = 0; i < count; i++)
+                    EXPECT_EQ(type->distanceEstimator(points[i], center, 12, 4.0, power), distances[i])
+                        << name << " power " << power << " point " << i;
+            }
+        }
+    }
+}
+
+TEST_F(FractalTest, PacketMatchesScalarTest) {
+    for (const std::string &name : typeNames) {
+        RayTracer::Fractal fractal(Math::Point3D(Math::Coords{0, 0, 0}), 1.5, name, 12, 4.0);
+        RayTracer::RayPacket packet;
+        packet.count = RayTracer::RayPacket::SIZE;
+        for (int lane = 0; lane < packet.count; lane++)
+            packet.set(lane, RayTracer::Ray(Math::Point3D(Math::Coords{0, 0, 5}),
+                Math::Vector3D({-0.15 + 0.04 * lane, 0.1 - 0.03 * lane, -1})));
+
+        std::optional<RayTracer::HitInfo> expected[RayTracer::RayPacket::SIZE];
+        for (int lane = 0; lane < packet.count; lane++)
+            expected[lane] = fractal.hit(packet.getRay(lane), 0.001, 1e30);
+        RayTracer::PacketHit hits;
+        fractal.hitPacket(packet, 0.001, hits);
+        for (int lane = 0; lane < packet.count; lane++) {
+            ASSERT_EQ(expected[lane].has_value(), hits.primitive[lane] != nullptr) << name;
+            if (!expected[lane])
+                continue;
+            EXPECT_EQ(expected[lane]->distance, hits.distance[lane]) << name;
+            // The distance marched for the packet is shaded without marching again
+            auto hit = fractal.surfaceAt(packet.getRay(lane), 0.001, hits.distance[lane]);
+            ASSERT_TRUE(hit.has_value());
+            EXPECT_EQ(expected[lane]->distance, hit->distance);
+            EXPECT_NEAR(expected[lane]->normal.X, hit->normal.X, 1e-12);
+        }
+    }
+}
+
+TEST_F(FractalTest, AnalyticGradientTest) {
+    const double step = 1e-7;
+    // Outside both shapes, where the estimates are not clamped
+    const std::vector<Math::Point3D> samples = {Math::Point3D(Math::Coords{-4, 1, 2.5}),
+        Math::Point3D(Math::Coords{6, 0, 0}), Math::Point3D(Math::Coords{0.2, 0.3, 4})};
+
+    for (const char *name : {"menger_sponge", "mandelbox"}) {
+        auto type = RayTracer::FractalTypeFactory::getInstance().createFractalType(name);
+        for (const Math::Point3D &p : samples) {
+            double distance;
+            Math::Vector3D gradient;
+            ASSERT_TRUE(type->distanceWithGradient(p, center, 12, 4.0, 2.0, distance, gradient)) << name;
+            EXPECT_NEAR(type->distanceEstimator(p, center, 12, 4.0, 2.0), distance, 1e-12);
+            auto at = [&](double x, double y, double z) {
+                return type->distanceEstimator(Math::Point3D(Math::Coords{p.X + x, p.Y + y, p.Z + z}),
+                    center, 12, 4.0, 2.0);
+            };
+            EXPECT_NEAR((at(step, 0, 0) - at(-step, 0, 0)) / (2 * step), gradient.X, 1e-5) << name;
+            EXPECT_NEAR((at(0, step, 0) - at(0, -step, 0)) / (2 * step), gradient.Y, 1e-5) << name;
+            EXPECT_NEAR((at(0, 0, step) - at(0, 0, -step)) / (2 * step), gradient.Z, 1e-5) << name;
+        }
+    }
+    auto mandelbrot = RayTracer::FractalTypeFactory::getInstance().createFractalType("mandelbrot");
+    double distance;
+    Math::Vector3D gradient;
+    EXPECT_FALSE(mandelbrot->distanceWithGradient(samples[0], center, 12, 4.0, 2.0, distance, gradient));
+}
+
+TEST_F(FractalTest, TetrahedralNormalTest) {
+    RayTracer::Fractal sponge(Math::Point3D(Math::Coords{0, 0, 0}), 1.8, "menger_sponge", 3, 4.0);
+    sponge.setMengerScale(1.0);
+    RayTracer::Ray ray(Math::Point3D(Math::Coords{0.3, 0.2, 5}), Math::Vector3D({0, 0, -1}));
+
+    auto hit = sponge.hit(ray, 0.001, 100.0);
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_NEAR(4.0, hit->distance, 1e-3);
+    EXPECT_NEAR(0.0, hit->normal.X, 1e-6);
+    EXPECT_NEAR(0.0, hit->normal.Y, 1e-6);
+    EXPECT_NEAR(1.0, hit->normal.Z, 1e-6);
+}
+
+TEST_F(FractalTest, DistanceCacheMatchesExactTest) {
+    RayTracer::PrimaryView view;
+    view.eye = Math::Point3D(Math::Coords{0.3, 0.4, 4});
+    view.screenOrigin = Math::Point3D(Math::Coords{-1.5, -1.5, 2});
+    view.screenU = Math::Vector3D({3, 0, 0});
+    view.screenV = Math::Vector3D({0, 3, 0});
+    view.width = 16;
+    view.height = 12;
+
+    for (const char *name : {"mandelbrot", "julia"}) {
+        RayTracer::Fractal exact(Math::Point3D(Math::Coords{0, 0, 0}), 1.5, name, 12, 4.0);
+        RayTracer::Fractal cached(Math::Point3D(Math::Coords{0, 0, 0}), 1.5, name, 12, 4.0);
+        cached.setDistanceCache(true);
+        EXPECT_TRUE(cached.hasDistanceCache());
+        EXPECT_TRUE(std::dynamic_pointer_cast<RayTracer::Fractal>(cached.clone())->hasDistanceCache());
+        exact.prepareView(view);
+        cached.prepareView(view);
+        int hits = 0;
+        // Twice, the second pass reads the bricks the first one filled
+        for (int pass = 0; pass < 2; pass++) {
+            for (int y = 0; y < view.height; y++) {
+                for (int x = 0; x < view.width; x++) {
+                    RayTracer::Ray ray = view.pixelRay(x + 0.5, y + 0.5);
+                    auto expected = exact.hit(ray, 0.001, 1e30);
+                    auto hit = cached.hit(ray, 0.001, 1e30);
+                    ASSERT_EQ(expected.has_value(), hit.has_value()) << name;
+                    if (!expected)
+                        continue;
+                    hits++;
+                    EXPECT_NEAR(expected->distance, hit->distance, 1e-3) << name;
+                }
+            }
+        }
+        EXPECT_GT(hits, 0) << name;
+    }
+}
+
+}  // namespace RayTracerTest
@@ -0,0 +1,80 @@
+/*
+** EPITECH PROJECT, 2025
+** B-OOP-400 Raytracer
+** File description:
+** Test for ImageWriter class
+*/
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "../src/Renderer/ImageWriter/ImageWriter.hpp"
+#include "../src/Exception/FileIOException.hpp"
+
+namespace RayTracerTest {
+
+static std::vector<uint8_t> readBytes(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(file),
+        std::istreambuf_iterator<char>());
+}
+
+class ImageWriterTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        frameBuffer = {
+            Math::Vector3D(Math::Coords{1, 0, 0}), Math::Vector3D(Math::Coords{0, 1, 0}),
+            Math::Vector3D(Math::Coords{0, 0, 1}), Math::Vector3D(Math::Coords{0.25, 2, -1})
+        };
+    }
+
+    std::vector<Math::Vector3D> frameBuffer;
+};
+
+TEST_F(ImageWriterTest, ToRGB8AppliesGammaAndClampTest) {
+    std::vector<uint8_t> rgb = RayTracer::ImageWriter::toRGB8(frameBuffer);
+
+    ASSERT_EQ(12u, rgb.size());
+    EXPECT_EQ(255, rgb[0]);
+    EXPECT_EQ(0, rgb[1]);
+    EXPECT_EQ(127, rgb[9]);
+    EXPECT_EQ(255, rgb[10]);
+    EXPECT_EQ(0, rgb[11]);
+}
+
+TEST_F(ImageWriterTest, WritePPMTest) {
+    std::string path = "test_imagewriter.ppm";
+    RayTracer::ImageWriter::write(path, frameBuffer, 2, 2);
+    std::vector<uint8_t> bytes = readBytes(path);
+    std::remove(path.c_str());
+
+    std::string header = "P6\n2 2\n255\n";
+    ASSERT_EQ(header.size() + 12, bytes.size());
+    EXPECT_EQ(header, std::string(bytes.begin(), bytes.begin() + header.size()));
+    EXPECT_EQ(255, bytes[header.size()]);
+    EXPECT_EQ(255, bytes[header.size() + 4]);
+}
+
+TEST_F(ImageWriterTest, WritePNGTest) {
+    std::string path = "test_imagewriter.png";
+    RayTracer::ImageWriter::write(path, frameBuffer, 2, 2);
+    std::vector<uint8_t> bytes = readBytes(path);
+    std::remove(path.c_str());
+
+    ASSERT_GT(bytes.size(), 33u);
+    EXPECT_EQ(std::string("\x89PNG\r\n\x1a\n"), std::string(bytes.begin(), bytes.begin() + 8));
+    EXPECT_EQ("IHDR", std::string(bytes.begin() + 12, bytes.begin() + 16));
+    EXPECT_EQ(2, bytes[19]);
+    EXPECT_EQ(2, bytes[23]);
+    EXPECT_EQ("IEND", std::string(bytes.end() - 8, bytes.end() - 4));
+}
+
+TEST_F(ImageWriterTest, UnwritablePathThrowsTest) {
+    EXPECT_THROW(RayTracer::ImageWriter::write("missing_dir/out.ppm", frameBuffer, 2, 2),
+        RayTracer::FileIOException);
+}
+
+}  // namespace RayTracerTest
@@ -0,0 +1,76 @@
+/*
+** EPITECH PROJECT, 2025
+** B-OOP-400 Raytracer
+** File description:
+** Test for Matrix3x4 class
+*/
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include "../src/Math/Matrix3x4/Matrix3x4.hpp"
+
+namespace RayTracerTest {
+
+class Matrix3x4Test : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        Math::Matrix3x3 linear(Math::Vector3D({2.0, 1.0, 0.0}),
+            Math::Vector3D({0.0, 1.0, 3.0}),
+            Math::Vector3D({1.0, 0.0, 1.0}));
+        affine = Math::Matrix3x4(linear, Math::Vector3D({1.0, -2.0, 4.0}));
+    }
+
+    Math::Matrix3x4 affine;
+};
+
+TEST_F(Matrix3x4Test, DefaultIsIdentityTest) {
+    Math::Matrix3x4 identity;
+    Math::Point3D p(Math::Coords{1.5, -2.0, 3.0});
+
+    Math::Point3D result = identity * p;
+    EXPECT_DOUBLE_EQ(1.5, result.X);
+    EXPECT_DOUBLE_EQ(-2.0, result.Y);
+    EXPECT_DOUBLE_EQ(3.0, result.Z);
+}
+
+TEST_F(Matrix3x4Test, PointAndVectorTest) {
+    Math::Point3D p = affine * Math::Point3D(Math::Coords{1.0, 1.0, 1.0});
+    Math::Vector3D v = affine * Math::Vector3D({1.0, 1.0, 1.0});
+
+    EXPECT_DOUBLE_EQ(4.0, p.X);
+    EXPECT_DOUBLE_EQ(2.0, p.Y);
+    EXPECT_DOUBLE_EQ(6.0, p.Z);
+    EXPECT_DOUBLE_EQ(3.0, v.X);
+    EXPECT_DOUBLE_EQ(4.0, v.Y);
+    EXPECT_DOUBLE_EQ(2.0, v.Z);
+}
+
+TEST_F(Matrix3x4Test, InverseTest) {
+    Math::Matrix3x4 inverse = affine.inverse();
+    Math::Point3D p(Math::Coords{0.5, -1.0, 2.0});
+
+    Math::Point3D back = inverse * (affine * p);
+    EXPECT_NEAR(0.5, back.X, 1e-12);
+    EXPECT_NEAR(-1.0, back.Y, 1e-12);
+    EXPECT_NEAR(2.0, back.Z, 1e-12);
+
+    Math::Matrix3x4 product = affine * inverse;
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++)
+            EXPECT_NEAR(i == j ? 1.0 : 0.0, product.linear.m[i][j], 1e-12);
+    }
+    EXPECT_NEAR(0.0, product.translation.X, 1e-12);
+    EXPECT_NEAR(0.0, product.translation.Y, 1e-12);
+    EXPECT_NEAR(0.0, product.translation.Z, 1e-12);
+}
+
+TEST_F(Matrix3x4Test, SingularInverseTest) {
+    Math::Matrix3x3 flat(Math::Vector3D({1.0, 0.0, 0.0}),
+        Math::Vector3D({0.0, 1.0, 0.0}),
+        Math::Vector3D({0.0, 0.0, 0.0}));
+    Math::Matrix3x4 singular(flat, Math::Vector3D({0.0, 0.0, 0.0}));
+
+    EXPECT_THROW(singular.inverse(), std::runtime_error);
+}
+
+}  // namespace RayTracerTest
@@ -0,0 +1,79 @@
+/*
+** EPITECH PROJECT, 2025
+** B-OOP-400 Raytracer
+** File description:
+** Test for ObjectTransform class
+*/
+
+#include <gtest/gtest.h>
+#include "../src/Transformation/ObjectTransform/ObjectTransform.hpp"
+#include "../src/Transformation/Rotate/Rotate.hpp"
+#include "../src/Ray/RayPacket.hpp"
+
+namespace RayTracerTest {
+
+class ObjectTransformTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        transform.setRotation(30.0, -45.0, 60.0);
+    }
+
+    RayTracer::ObjectTransform transform;
+};
+
+TEST_F(ObjectTransformTest, DefaultIsIdentityTest) {
+    RayTracer::ObjectTransform identity;
+    RayTracer::Ray ray(Math::Point3D(Math::Coords{1, 2, 3}), Math::Vector3D({0, 0, -1}));
+
+    EXPECT_TRUE(identity.isIdentity());
+    RayTracer::Ray local = identity.toObject(ray);
+    EXPECT_DOUBLE_EQ(1.0, local.origin.X);
+    EXPECT_DOUBLE_EQ(-1.0, local.direction.Z);
+}
+
+TEST_F(ObjectTransformTest, MatchesSequentialRotationsTest) {
+    RayTracer::Ray ray(Math::Point3D(Math::Coords{1, -2, 5}), Math::Vector3D({0.3, 0.2, -1}));
+
+    // Primitives used to bring rays to object space one axis at a time
+    Math::Point3D origin = ray.origin;
+    Math::Vector3D direction = ray.direction;
+    RayTracer::Rotate rotateZ("z", -60.0);
+    RayTracer::Rotate rotateY("y", 45.0);
+    RayTracer::Rotate rotateX("x", -30.0);
+    origin = rotateX.applyToPoint(rotateY.applyToPoint(rotateZ.applyToPoint(origin)));
+    direction = rotateX.applyToVector(rotateY.applyToVector(rotateZ.applyToVector(direction)));
+
+    RayTracer::Ray local = transform.toObject(ray);
+    EXPECT_FALSE(transform.isIdentity());
+    EXPECT_NEAR(origin.X, local.origin.X, 1e-12);
+    EXPECT_NEAR(origin.Y, local.origin.Y, 1e-12);
+    EXPECT_NEAR(origin.Z, local.origin.Z, 1e-12);
+    EXPECT_NEAR(direction.X, local.direction.X, 1e-12);
+    EXPECT_NEAR(direction.Y, local.direction.Y, 1e-12);
+    EXPECT_NEAR(direction.Z, local.direction.Z, 1e-12);
+
+    Math::Vector3D normal = transform.normalToWorld(local.direction);
+    EXPECT_NEAR(ray.direction.X, normal.X, 1e-12);
+    EXPECT_NEAR(ray.direction.Y, normal.Y, 1e-12);
+    EXPECT_NEAR(ray.direction.Z, normal.Z, 1e-12);
+}
+
+TEST_F(ObjectTransformTest, PacketMatchesScalarTest) {
+    RayTracer::RayPacket packet;
+    packet.count = 3;
+    for (int lane = 0; lane < packet.count; lane++)
+        packet.set(lane, RayTracer::Ray(Math::Point3D(Math::Coords{1.0 * lane, 2, 3}),
+            Math::Vector3D({0.1 * lane, 1, -1})));
+
+    RayTracer::RayPacket local = transform.toObject(packet);
+    ASSERT_EQ(packet.count, local.count);
+    for (int lane = 0; lane < packet.count; lane++) {
+        RayTracer::Ray expected = transform.toObject(packet.getRay(lane));
+        EXPECT_DOUBLE_EQ(expected.origin.X, local.originX[lane]);
+        EXPECT_DOUBLE_EQ(expected.origin.Z, local.originZ[lane]);
+        EXPECT_DOUBLE_EQ(expected.direction.Y, local.directionY[lane]);
+        EXPECT_DOUBLE_EQ(RayTracer::RayPacket::safeInverse(expected.direction.X), local.inverseX[lane]);
+    }
+}
+
+}  // namespace RayTracerTest
@@ -0,0 +1,62 @@
+/*
+** EPITECH PROJECT, 2025
+** B-OOP-400 Raytracer
+** File description:
+** Test for Polynomial root solvers
+*/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include "../src/Math/Polynomial/Polynomial.hpp"
+
+namespace RayTracerTest {
+
+TEST(PolynomialTest, QuadraticTest) {
+    double roots[2];
+    ASSERT_EQ(2, Math::Polynomial::solveQuadratic(1.0, -3.0, 2.0, roots));
+    std::sort(roots, roots + 2);
+    EXPECT_NEAR(1.0, roots[0], 1e-12);
+    EXPECT_NEAR(2.0, roots[1], 1e-12);
+
+    EXPECT_EQ(0, Math::Polynomial::solveQuadratic(1.0, 0.0, 1.0, roots));
+    ASSERT_EQ(1, Math::Polynomial::solveQuadratic(0.0, 2.0, -4.0, roots));
+    EXPECT_DOUBLE_EQ(2.0, roots[0]);
+}
+
+TEST(PolynomialTest, CubicTest) {
+    double roots[3];
+    // (x - 1)(x + 2)(x - 3)
+    ASSERT_EQ(3, Math::Polynomial::solveCubic(1.0, -2.0, -5.0, 6.0, roots));
+    std::sort(roots, roots + 3);
+    EXPECT_NEAR(-2.0, roots[0], 1e-9);
+    EXPECT_NEAR(1.0, roots[1], 1e-9);
+    EXPECT_NEAR(3.0, roots[2], 1e-9);
+
+    // x^3 + x + 2 = (x + 1)(x^2 - x + 2)
+    ASSERT_EQ(1, Math::Polynomial::solveCubic(1.0, 0.0, 1.0, 2.0, roots));
+    EXPECT_NEAR(-1.0, roots[0], 1e-9);
+}
+
+TEST(PolynomialTest, QuarticTest) {
+    double roots[4];
+    // 2(x - 1)(x + 1)(x - 2)(x - 4)
+    ASSERT_EQ(4, Math::Polynomial::solveQuartic(2.0, -12.0, 14.0, 12.0, -16.0, roots));
+    std::sort(roots, roots + 4);
+    EXPECT_NEAR(-1.0, roots[0], 1e-9);
+    EXPECT_NEAR(1.0, roots[1], 1e-9);
+    EXPECT_NEAR(2.0, roots[2], 1e-9);
+    EXPECT_NEAR(4.0, roots[3], 1e-9);
+
+    EXPECT_EQ(0, Math::Polynomial::solveQuartic(1.0, 0.0, 2.0, 0.0, 1.0, roots));
+}
+
+TEST(PolynomialTest, QuarticDoubleRootTest) {
+    double roots[4];
+    // (x - 3)^2 (x^2 + 1), a tangent ray only touches the surface
+    int count = Math::Polynomial::solveQuartic(1.0, -6.0, 10.0, -6.0, 9.0, roots);
+    ASSERT_GE(count, 1);
+    for (int i = 0; i < count; i++)
+        EXPECT_NEAR(3.0, roots[i], 1e-4);
+}
+
+}  // namespace RayTracerTest
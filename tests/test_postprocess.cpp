@@ -0,0 +1,93 @@
+/*
+** EPITECH PROJECT, 2025
+** B-OOP-400 Raytracer
+** File description:
+** Test for the fused post-processing chain
+*/
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <vector>
+#include "../src/PostProcess/IPostProcess.hpp"
+#include "../src/PostProcess/BlurPostProcess/BlurPostProcess.hpp"
+#include "../src/PostProcess/ChromaticAberrationPostProcess/ChromaticAberrationPostProcess.hpp"
+#include "../src/PostProcess/GrayscalePostProcess/GrayscalePostProcess.hpp"
+#include "../src/PostProcess/NegativePostProcess/NegativePostProcess.hpp"
+#include "../src/Renderer/ThreadPool/RenderThreadPool.hpp"
+
+namespace RayTracerTest {
+
+class PostProcessChainTest : public ::testing::Test {
+ protected:
+    using Chain = std::vector<std::shared_ptr<RayTracer::IPostProcess>>;
+
+    void SetUp() override {
+        std::mt19937 generator(11);
+        std::uniform_real_distribution<double> channel(0.0, 1.0);
+        frame.resize(width * height);
+        for (Math::Vector3D &pixel : frame)
+            pixel = Math::Vector3D(Math::Coords{channel(generator), channel(generator),
+                channel(generator)});
+    }
+
+    // Each effect on its own, one frame buffer after the other
+    std::vector<Math::Vector3D> oneByOne(const Chain &chain) const {
+        std::vector<Math::Vector3D> result = frame;
+        for (const auto &effect : chain)
+            result = effect->processFrameBuffer(result, width, height);
+        return result;
+    }
+
+    // Runs chain fused on the pool, and checks the output sees every finished pixel once
+    void expectFusedMatches(const Chain &chain) {
+        std::vector<Math::Vector3D> expected = oneByOne(chain);
+        std::vector<Math::Vector3D> fused = frame;
+        std::vector<Math::Vector3D> scratch;
+        std::vector<Math::Vector3D> output(frame.size());
+        std::vector<int> outputCount(frame.size(), 0);
+
+        RayTracer::applyPostProcessChain(chain, fused, scratch, width, height,
+            [this](int count, const std::function<void(int)> &task) { pool.run(count, task); },
+            [&](int firstIndex, int count) {
+                for (int i = firstIndex; i < firstIndex + count; i++) {
+                    output[i] = fused[i];
+                    outputCount[i]++;
+                }
+            });
+        for (size_t i = 0; i < expected.size(); i++) {
+            EXPECT_NEAR(expected[i].X, fused[i].X, 1e-12) << "pixel " << i;
+            EXPECT_NEAR(expected[i].Y, fused[i].Y, 1e-12) << "pixel " << i;
+            EXPECT_NEAR(expected[i].Z, fused[i].Z, 1e-12) << "pixel " << i;
+            ASSERT_EQ(1, outputCount[i]) << "pixel " << i;
+            EXPECT_EQ(fused[i].X, output[i].X);
+            EXPECT_EQ(fused[i].Y, output[i].Y);
+            EXPECT_EQ(fused[i].Z, output[i].Z);
+        }
+    }
+
+    const int width = 45;
+    const int height = 38;
+    std::vector<Math::Vector3D> frame;
+    RayTracer::RenderThreadPool pool{4};
+};
+
+TEST_F(PostProcessChainTest, PerPixelEffectsAroundBlurTest) {
+    expectFusedMatches({std::make_shared<RayTracer::GrayscalePostProcess>(0.6),
+        std::make_shared<RayTracer::BlurPostProcess>(2.0),
+        std::make_shared<RayTracer::NegativePostProcess>(0.8),
+        std::make_shared<RayTracer::GrayscalePostProcess>(0.3)});
+}
+
+TEST_F(PostProcessChainTest, EndsWithNeighbourhoodEffectTest) {
+    // The output then needs a pass of its own after the blur
+    expectFusedMatches({std::make_shared<RayTracer::NegativePostProcess>(1.0),
+        std::make_shared<RayTracer::ChromaticAberrationPostProcess>(2.0),
+        std::make_shared<RayTracer::BlurPostProcess>(3.0)});
+}
+
+TEST_F(PostProcessChainTest, EmptyChainStillOutputsTest) {
+    expectFusedMatches({});
+}
+
+}  // namespace RayTracerTest
@@ -0,0 +1,127 @@
+/*
+** EPITECH PROJECT, 2025
+** B-OOP-400 Raytracer
+** File description:
+** Test file for ray packet tracing
+*/
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+#include "../src/Primitive/BVH/BVH.hpp"
+#include "../src/Primitive/Sphere/Sphere.hpp"
+#include "../src/Primitive/Plane/Plane.hpp"
+#include "../src/Primitive/Box/Box.hpp"
+#include "../src/Primitive/Torus/Torus.hpp"
+#include "../src/Primitive/TriangleMesh/TriangleMesh.hpp"
+#include "../src/Ray/RayPacket.hpp"
+
+namespace RayTracerTest {
+
+class RayPacketTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        for (int i = 0; i < 12; i++) {
+            Math::Point3D center(Math::Coords{i * 2.5 - 14.0, (i % 3) - 1.0, -12.0 - i});
+            auto sphere = std::make_shared<RayTracer::Sphere>(center, 1.0 + (i % 2) * 0.5);
+            if (i % 4 == 0)
+                sphere->rotateY(30.0);
+            primitives.push_back(sphere);
+        }
+        auto box = std::make_shared<RayTracer::Box>(Math::Point3D(Math::Coords{3, 2, -8}),
+            Math::Vector3D(Math::Coords{1, 1.5, 0.5}));
+        box->rotateX(25.0);
+        box->rotateZ(40.0);
+        primitives.push_back(box);
+        primitives.push_back(std::make_shared<RayTracer::Box>(Math::Point3D(Math::Coords{-4, -2, -7}),
+            Math::Vector3D(Math::Coords{1, 1, 1})));
+        auto plane = std::make_shared<RayTracer::Plane>(Math::Point3D(Math::Coords{0, -4, 0}),
+            Math::Vector3D(Math::Coords{0, 1, 0}));
+        plane->rotateZ(10.0);
+        primitives.push_back(plane);
+        primitives.push_back(std::make_shared<RayTracer::Torus>(
+            Math::Point3D(Math::Coords{0, 3, -15}), Math::Vector3D(Math::Coords{0, 0, 1}), 2.0, 0.5));
+
+        RayTracer::MeshData data;
+        data.positionsX = {-2.0f, 2.0f, 2.0f, -2.0f};
+        data.positionsY = {-2.0f, -2.0f, 2.0f, 2.0f};
+        data.positionsZ = {0.0f, 0.0f, 0.0f, 0.0f};
+        data.indices = {0, 1, 2, 0, 2, 3};
+        auto mesh = std::make_shared<RayTracer::TriangleMesh>(std::move(data),
+            std::make_shared<RayTracer::Material>());
+        mesh->translate(Math::Vector3D(Math::Coords{6, -1, -9}));
+        mesh->rotateY(-20.0);
+        primitives.push_back(mesh);
+        bvh.build(primitives);
+    }
+
+    std::vector<std::shared_ptr<RayTracer::IPrimitive>> primitives;
+    RayTracer::BVH bvh;
+};
+
+TEST_F(RayPacketTest, SetComputesSafeInverseTest) {
+    RayTracer::RayPacket packet;
+    RayTracer::Ray primary(Math::Point3D(Math::Coords{1, 2, 3}),
+        Math::Vector3D(Math::Coords{0.5, 0.0, -2.0}));
+    primary.spread = 0.003;
+    packet.set(0, primary);
+    packet.count = 1;
+
+    EXPECT_DOUBLE_EQ(2.0, packet.inverseX[0]);
+    EXPECT_DOUBLE_EQ(-0.5, packet.inverseZ[0]);
+    EXPECT_TRUE(std::isfinite(packet.inverseY[0]));
+    RayTracer::Ray ray = packet.getRay(0);
+    EXPECT_DOUBLE_EQ(2.0, ray.origin.Y);
+    EXPECT_DOUBLE_EQ(-2.0, ray.direction.Z);
+    EXPECT_DOUBLE_EQ(0.003, ray.spread);
+}
+
+TEST_F(RayPacketTest, PacketMatchesScalarTest) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> spread(-0.9, 0.9);
+
+    for (int packetIndex = 0; packetIndex < 300; packetIndex++) {
+        RayTracer::RayPacket packet;
+        RayTracer::Ray rays[RayTracer::RayPacket::SIZE];
+        // Partial packets exercise the scalar tail of the kernels
+        packet.count = 1 + packetIndex % RayTracer::RayPacket::SIZE;
+        for (int lane = 0; lane < packet.count; lane++) {
+            rays[lane] = RayTracer::Ray(Math::Point3D(Math::Coords{0, 0, 2}),
+                Math::Vector3D(Math::Coords{spread(generator), spread(generator) * 0.6, -1.0}));
+            packet.set(lane, rays[lane]);
+        }
+        RayTracer::PacketHit hits;
+        bvh.hitPacket(packet, 0.001, hits);
+
+        for (int lane = 0; lane < packet.count; lane++) {
+            auto expected = bvh.hit(rays[lane], 0.001, 1e9);
+            ASSERT_EQ(expected.has_value(), hits.primitive[lane] != nullptr)
+                << "packet " << packetIndex << " lane " << lane;
+            if (!expected)
+                continue;
+            EXPECT_NEAR(expected->distance, hits.distance[lane], 1e-6);
+            EXPECT_EQ(expected->primitive, hits.primitive[lane]);
+        }
+    }
+}
+
+TEST_F(RayPacketTest, PacketKeepsCloserHitsTest) {
+    RayTracer::RayPacket packet;
+    packet.set(0, RayTracer::Ray(Math::Point3D(Math::Coords{-11.5, 0, 0}),
+        Math::Vector3D(Math::Coords{0, 0, -1})));
+    packet.count = 1;
+    RayTracer::PacketHit hits(5.0);
+
+    primitives[1]->hitPacket(packet, 0.001, hits);
+    EXPECT_EQ(nullptr, hits.primitive[0]);
+    EXPECT_DOUBLE_EQ(5.0, hits.distance[0]);
+
+    RayTracer::PacketHit farHits;
+    primitives[1]->hitPacket(packet, 0.001, farHits);
+    EXPECT_EQ(primitives[1].get(), farHits.primitive[0]);
+    EXPECT_NEAR(11.5, farHits.distance[0], 1e-9);
+}
+
+}  // namespace RayTracerTest
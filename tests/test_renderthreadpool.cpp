@@ -0,0 +1,65 @@
+/*
+** EPITECH PROJECT, 2025
+** B-OOP-400 Raytracer
+** File description:
+** Test for RenderThreadPool class
+*/
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+#include "../src/Renderer/ThreadPool/RenderThreadPool.hpp"
+
+namespace RayTracerTest {
+
+TEST(RenderThreadPoolTest, ThreadCountTest) {
+    RayTracer::RenderThreadPool pool(3);
+    EXPECT_EQ(3u, pool.getThreadCount());
+    EXPECT_GE(RayTracer::RenderThreadPool::resolveThreadCount(0), 1u);
+    EXPECT_EQ(7u, RayTracer::RenderThreadPool::resolveThreadCount(7));
+}
+
+TEST(RenderThreadPoolTest, RunsEveryTaskOnceTest) {
+    RayTracer::RenderThreadPool pool(4);
+
+    // Several batches on the same workers, with more and fewer tasks than threads
+    for (int taskCount : {1, 3, 1000, 0, 57}) {
+        std::vector<std::atomic<int>> counts(taskCount);
+        pool.run(taskCount, [&counts](int task) { counts[task]++; });
+        for (int i = 0; i < taskCount; i++)
+            EXPECT_EQ(1, counts[i].load()) << "task " << i << " of " << taskCount;
+    }
+}
+
+TEST(RenderThreadPoolTest, UnevenTasksAreStolenTest) {
+    RayTracer::RenderThreadPool pool(2);
+    std::atomic<int> done(0);
+
+    // Every slow task lands in the first worker queue
+    pool.run(64, [&done](int task) {
+        if (task < 32) {
+            volatile double sink = 0;
+            for (int i = 0; i < 20000; i++)
+                sink = sink + i;
+        }
+        done++;
+    });
+    EXPECT_EQ(64, done.load());
+}
+
+TEST(RenderThreadPoolTest, TaskExceptionIsRethrownTest) {
+    RayTracer::RenderThreadPool pool(2);
+    std::atomic<int> done(0);
+
+    EXPECT_THROW(pool.run(10, [&done](int task) {
+        done++;
+        if (task == 4)
+            throw std::runtime_error("tile failed");
+    }), std::runtime_error);
+    EXPECT_EQ(10, done.load());
+    pool.run(5, [&done](int) { done++; });
+    EXPECT_EQ(15, done.load());
+}
+
+}  // namespace RayTracerTest
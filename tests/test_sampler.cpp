@@ -0,0 +1,147 @@
+/*
+** EPITECH PROJECT, 2025
+** B-OOP-400 Raytracer
+** File description:
+** Test for Sampler class
+*/
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <set>
+#include <vector>
+#include "../src/Sampler/Sampler.hpp"
+
+namespace RayTracerTest {
+
+class SamplerTest : public ::testing::Test {
+ protected:
+    const std::vector<RayTracer::Sampler::Pattern> patterns = {
+        RayTracer::Sampler::Pattern::Independent, RayTracer::Sampler::Pattern::Stratified,
+        RayTracer::Sampler::Pattern::Halton, RayTracer::Sampler::Pattern::Sobol,
+        RayTracer::Sampler::Pattern::BlueNoise};
+
+    // Mean squared error of the integral of a disk edge over many pixels
+    static double integrationError(RayTracer::Sampler::Pattern pattern, int samples) {
+        RayTracer::Sampler sampler(pattern, samples);
+        double error = 0.0;
+        for (int pixel = 0; pixel < 256; pixel++) {
+            sampler.startPixel(pixel % 16, pixel / 16);
+            double covered = 0.0;
+            for (int i = 0; i < samples; i++) {
+                sampler.startSample(i);
+                Math::Vector2D point = sampler.get2D();
+                covered += point.U * point.U + point.V * point.V < 1.0 ? 1.0 : 0.0;
+            }
+            double difference = covered / samples - M_PI / 4.0;
+            error += difference * difference;
+        }
+        return error / 256;
+    }
+};
+
+TEST_F(SamplerTest, DeterministicAndInRangeTest) {
+    for (auto pattern : patterns) {
+        RayTracer::Sampler first(pattern, 16);
+        RayTracer::Sampler second(pattern, 16);
+        first.startPixel(12, 7, 3);
+        second.startPixel(40, 2, 3);
+        second.startPixel(12, 7, 3);
+        for (int i = 0; i < 64; i++) {
+            first.startSample(i);
+            second.startSample(i);
+            for (int dimension = 0; dimension < 6; dimension++) {
+                double value = first.get1D();
+                EXPECT_EQ(value, second.get1D());
+                EXPECT_GE(value, 0.0);
+                EXPECT_LT(value, 1.0);
+            }
+        }
+    }
+}
+
+TEST_F(SamplerTest, PixelsAndFramesDifferTest) {
+    for (auto pattern : patterns) {
+        RayTracer::Sampler sampler(pattern, 4);
+        std::set<double> values;
+        for (uint32_t frame = 0; frame < 2; frame++) {
+            for (int x = 0; x < 8; x++) {
+                sampler.startPixel(x, 3, frame);
+                values.insert(sampler.get1D());
+            }
+        }
+        EXPECT_GT(values.size(), 12u);
+    }
+}
+
+TEST_F(SamplerTest, StratifiedCoversEveryCellTest) {
+    RayTracer::Sampler sampler(RayTracer::Sampler::Pattern::Stratified, 16);
+    sampler.startPixel(5, 9);
+    std::set<int> cells;
+    std::set<int> strata;
+    for (int i = 0; i < 16; i++) {
+        sampler.startSample(i);
+        Math::Vector2D point = sampler.get2D();
+        cells.insert(static_cast<int>(point.U * 4) * 4 + static_cast<int>(point.V * 4));
+        strata.insert(static_cast<int>(sampler.get1D() * 16));
+    }
+    EXPECT_EQ(16u, cells.size());
+    EXPECT_EQ(16u, strata.size());
+}
+
+TEST_F(SamplerTest, StratifiedPrefixSpansBothAxesTest) {
+    RayTracer::Sampler sampler(RayTracer::Sampler::Pattern::Stratified, 16);
+    for (int pixel = 0; pixel < 64; pixel++) {
+        sampler.startPixel(pixel % 8, pixel / 8);
+        // The 4 pilot samples of an adaptive pixel fall in 4 rows and 4 columns
+        std::set<int> columns;
+        std::set<int> rows;
+        for (int i = 0; i < 4; i++) {
+            sampler.startSample(i);
+            Math::Vector2D point = sampler.get2D();
+            columns.insert(static_cast<int>(point.U * 4));
+            rows.insert(static_cast<int>(point.V * 4));
+        }
+        EXPECT_EQ(4u, columns.size());
+        EXPECT_EQ(4u, rows.size());
+    }
+}
+
+TEST_F(SamplerTest, SobolPrefixesAreNetsTest) {
+    RayTracer::Sampler sampler(RayTracer::Sampler::Pattern::Sobol);
+    for (int pixel = 0; pixel < 8; pixel++) {
+        sampler.startPixel(pixel, 1);
+        sampler.startSample(0);
+        sampler.get2D();
+        // Each of the 16 elementary intervals of every shape gets one of the first 16 points
+        std::set<int> columns;
+        std::set<int> rows;
+        std::set<int> squares;
+        for (int i = 0; i < 16; i++) {
+            sampler.startSample(i);
+            sampler.get2D();
+            Math::Vector2D point = sampler.get2D();
+            columns.insert(static_cast<int>(point.U * 16));
+            rows.insert(static_cast<int>(point.V * 16));
+            squares.insert(static_cast<int>(point.U * 4) * 4 + static_cast<int>(point.V * 4));
+        }
+        EXPECT_EQ(16u, columns.size());
+        EXPECT_EQ(16u, rows.size());
+        EXPECT_EQ(16u, squares.size());
+    }
+}
+
+TEST_F(SamplerTest, ConvergesFasterThanIndependentTest) {
+    double reference = integrationError(RayTracer::Sampler::Pattern::Independent, 16);
+    EXPECT_LT(integrationError(RayTracer::Sampler::Pattern::Stratified, 16), reference * 0.5);
+    EXPECT_LT(integrationError(RayTracer::Sampler::Pattern::Halton, 16), reference * 0.5);
+    EXPECT_LT(integrationError(RayTracer::Sampler::Pattern::Sobol, 16), reference * 0.5);
+    EXPECT_LT(integrationError(RayTracer::Sampler::Pattern::BlueNoise, 16), reference * 0.5);
+}
+
+TEST_F(SamplerTest, PatternFromNameTest) {
+    EXPECT_EQ(RayTracer::Sampler::Pattern::Sobol, RayTracer::Sampler::patternFromName("sobol"));
+    EXPECT_EQ(RayTracer::Sampler::Pattern::BlueNoise, RayTracer::Sampler::patternFromName("bluenoise"));
+    EXPECT_FALSE(RayTracer::Sampler::patternFromName("sobel").has_value());
+}
+
+}  // namespace RayTracerTest
@@ -0,0 +1,239 @@
+/*
+** EPITECH PROJECT, 2025
+** B-OOP-400 Raytracer
+** File description:
+** Test for SdfMarcher
+*/
+
+#include <gtest/gtest.h>
+#include "../src/Primitive/SdfMarcher/SdfMarcher.hpp"
+#include "../src/Primitive/SdfMarcher/ConeMarchPrepass.hpp"
+#include "../src/Primitive/SdfMarcher/DistanceCache.hpp"
+
+namespace RayTracerTest {
+
+class SdfMarcherTest : public ::testing::Test {
+ protected:
+    static double unitSphere(const Math::Point3D &p) {
+        return Math::Vector3D(Math::Coords{p.X, p.Y, p.Z}).length() - 1.0;
+    }
+
+    RayTracer::Ray ray{Math::Point3D(Math::Coords{-10, 0, 0}), Math::Vector3D({1, 0, 0})};
+};
+
+TEST_F(SdfMarcherTest, HitsSphereTest) {
+    RayTracer::SdfMarchSettings settings;
+    settings.epsilon = 1e-6;
+    auto hit = RayTracer::SdfMarcher(settings).march(ray, 0.0, 100.0, unitSphere);
+
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_NEAR(9.0, hit->t, 1e-5);
+    EXPECT_FALSE(RayTracer::SdfMarcher(settings).march(ray, 0.0, 5.0, unitSphere).has_value());
+}
+
+TEST_F(SdfMarcherTest, RelaxationNeverSkipsSurfaceTest) {
+    // A thin slab right behind a sphere the relaxed steps overshoot
+    auto scene = [](const Math::Point3D &p) {
+        double slab = std::abs(p.X - 1.05) - 0.01;
+        return std::min(unitSphere(Math::Point3D(Math::Coords{p.X, p.Y - 1.02, p.Z})), slab);
+    };
+    RayTracer::SdfMarchSettings settings;
+    settings.epsilon = 1e-6;
+    settings.relaxation = 1.9;
+    auto hit = RayTracer::SdfMarcher(settings).march(ray, 0.0, 100.0, scene);
+
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_NEAR(11.04, hit->t, 1e-5);
+}
+
+TEST_F(SdfMarcherTest, RelaxationSavesStepsTest) {
+    RayTracer::SdfMarchSettings plain;
+    plain.epsilon = 1e-6;
+    plain.relaxation = 1.0;
+    RayTracer::SdfMarchSettings relaxed = plain;
+    relaxed.relaxation = 1.2;
+    // Grazing rays are where plain sphere tracing crawls
+    RayTracer::Ray grazing(Math::Point3D(Math::Coords{-10, 0.99, 0}), Math::Vector3D({1, 0, 0}));
+    auto slow = RayTracer::SdfMarcher(plain).march(grazing, 0.0, 20.0, unitSphere);
+    auto fast = RayTracer::SdfMarcher(relaxed).march(grazing, 0.0, 20.0, unitSphere);
+
+    ASSERT_TRUE(slow.has_value());
+    ASSERT_TRUE(fast.has_value());
+    EXPECT_NEAR(slow->t, fast->t, 1e-4);
+    EXPECT_LT(fast->steps, slow->steps);
+}
+
+TEST_F(SdfMarcherTest, StepBudgetTest) {
+    RayTracer::SdfMarchSettings settings;
+    settings.maxSteps = 1;
+    EXPECT_FALSE(RayTracer::SdfMarcher(settings).march(ray, 0.0, 100.0, unitSphere).has_value());
+}
+
+TEST_F(SdfMarcherTest, LipschitzAndFootprintTest) {
+    // Twice the distance, a bound of 2 brings it back to a true distance
+    auto scaled = [](const Math::Point3D &p) { return 2.0 * unitSphere(p); };
+    RayTracer::SdfMarchSettings settings;
+    settings.epsilon = 1e-6;
+    settings.lipschitz = 2.0;
+    auto exact = RayTracer::SdfMarcher(settings).march(ray, 0.0, 100.0, scaled);
+    ASSERT_TRUE(exact.has_value());
+    EXPECT_NEAR(9.0, exact->t, 1e-5);
+
+    RayTracer::Ray grazing(Math::Point3D(Math::Coords{-10, 0.99, 0}), Math::Vector3D({1, 0, 0}));
+    auto fine = RayTracer::SdfMarcher(settings).march(grazing, 0.0, 20.0, scaled);
+    // A camera ray stops once the bound is below half its cone
+    RayTracer::Ray camera = grazing;
+    camera.spread = 0.002;
+    auto coarse = RayTracer::SdfMarcher(settings).march(camera, 0.0, 20.0, scaled);
+    ASSERT_TRUE(fine.has_value());
+    ASSERT_TRUE(coarse.has_value());
+    EXPECT_NEAR(fine->t, coarse->t, 0.1);
+    EXPECT_LT(coarse->steps, fine->steps);
+}
+
+TEST_F(SdfMarcherTest, ConeMarchIsConservativeTest) {
+    RayTracer::SdfMarchSettings settings;
+    settings.epsilon = 1e-6;
+    RayTracer::SdfMarcher marcher(settings);
+    double slope = 0.05;
+    double start = marcher.coneMarch(ray, 0.0, 100.0, slope, unitSphere);
+
+    // The cone stops before the sphere, and before every ray it contains does
+    EXPECT_GT(start, 8.0);
+    EXPECT_LT(start, 9.0);
+    for (double offset : {-slope, -slope / 2, slope / 2, slope}) {
+        RayTracer::Ray side(ray.origin, Math::Vector3D({1, offset, 0}).normalize());
+        auto hit = marcher.march(side, 0.0, 100.0, unitSphere);
+        ASSERT_TRUE(hit.has_value());
+        EXPECT_LE(start, hit->t);
+    }
+    EXPECT_DOUBLE_EQ(3.0, marcher.coneMarch(ray, 3.0, 100.0, 10.0, unitSphere));
+}
+
+TEST_F(SdfMarcherTest, PrepassStartDistanceTest) {
+    RayTracer::PrimaryView view;
+    view.eye = Math::Point3D(Math::Coords{-10, 0, 0});
+    view.screenOrigin = Math::Point3D(Math::Coords{-9, -0.5, -0.5});
+    view.screenU = Math::Vector3D({0, 0, 1});
+    view.screenV = Math::Vector3D({0, 1, 0});
+    view.width = 32;
+    view.height = 32;
+
+    double px;
+    double py;
+    RayTracer::Ray through = view.pixelRay(5.25, 20.5);
+    ASSERT_TRUE(view.pixelOf(through, px, py));
+    EXPECT_NEAR(5.25, px, 1e-9);
+    EXPECT_NEAR(20.5, py, 1e-9);
+
+    RayTracer::SdfMarchSettings settings;
+    settings.epsilon = 1e-6;
+    RayTracer::SdfMarcher marcher(settings);
+    RayTracer::ConeMarchPrepass prepass;
+    EXPECT_DOUBLE_EQ(0.0, prepass.getStartDistance(through));
+    prepass.build(view, [&marcher](const RayTracer::Ray &center, double slope) {
+        return marcher.coneMarch(center, 0.0, 100.0, slope, unitSphere);
+    });
+    ASSERT_TRUE(prepass.isBuiltFor(view));
+
+    for (int y = 0; y < view.height; y += 3) {
+        for (int x = 0; x < view.width; x += 3) {
+            RayTracer::Ray pixel = view.pixelRay(x + 0.4, y - 0.4);
+            double start = prepass.getStartDistance(pixel);
+            auto hit = marcher.march(pixel, 0.0, 100.0, unitSphere);
+            if (hit) {
+                EXPECT_LE(start, hit->t);
+            }
+        }
+    }
+    EXPECT_GT(prepass.getStartDistance(view.pixelRay(15.5, 15.5)), 8.0);
+
+    // Secondary rays do not start at the eye and get no shortcut
+    RayTracer::Ray secondary(Math::Point3D(Math::Coords{-10, 0, 0.1}), through.direction);
+    EXPECT_DOUBLE_EQ(0.0, prepass.getStartDistance(secondary));
+    prepass.invalidate();
+    EXPECT_FALSE(prepass.isBuiltFor(view));
+}
+
+TEST_F(SdfMarcherTest, DistanceCacheTest) {
+    RayTracer::DistanceCache cache;
+    int sampled = 0;
+    auto sample = [&sampled](const Math::Point3D *points, int count, double *distances) {
+        sampled += count;
+        for (int i = 0; i < count; i++)
+            distances[i] = unitSphere(points[i]);
+    };
+    double distance;
+    Math::Point3D far(Math::Coords{1.9, 0.3, -0.2});
+
+    EXPECT_FALSE(cache.lookup(far, sample, distance));
+    cache.configure(2.0, 0.01);
+    EXPECT_TRUE(cache.isConfiguredFor(2.0, 0.01));
+    ASSERT_TRUE(cache.lookup(far, sample, distance));
+    // The smallest corner of a cell 1/16 wide
+    EXPECT_LE(distance, unitSphere(far));
+    EXPECT_GT(distance, unitSphere(far) - 0.0625 * std::sqrt(3.0));
+    int filled = sampled;
+    EXPECT_GT(filled, 0);
+    ASSERT_TRUE(cache.lookup(Math::Point3D(Math::Coords{1.91, 0.31, -0.21}), sample, distance));
+    EXPECT_EQ(filled, sampled);
+
+    // Near the surface and outside the cube the caller evaluates itself
+    EXPECT_FALSE(cache.lookup(Math::Point3D(Math::Coords{1.0, 0.0, 0.0}), sample, distance));
+    EXPECT_FALSE(cache.lookup(Math::Point3D(Math::Coords{2.5, 0.0, 0.0}), sample, distance));
+
+    RayTracer::SdfMarcher marcher;
+    auto exact = marcher.march(ray, 0.0, 100.0, unitSphere);
+    auto cached = marcher.march(ray, 8.0, 100.0, [&](const Math::Point3D &p) {
+        double bound;
+        return cache.lookup(p, sample, bound) ? bound : unitSphere(p);
+    });
+    ASSERT_TRUE(exact.has_value());
+    ASSERT_TRUE(cached.has_value());
+    EXPECT_NEAR(exact->t, cached->t, 1e-4);
+    cache.invalidate();
+    EXPECT_FALSE(cache.isConfiguredFor(2.0, 0.01));
+}
+
+TEST_F(SdfMarcherTest, DistanceCacheSubCellFeatureTest) {
+    // A sphere far smaller than a cell, centered between its eight corners
+    const double cellSize = 4.0 / RayTracer::DistanceCache::RESOLUTION;
+    const double middle = 40.5 * cellSize - 2.0;
+    const Math::Point3D center(Math::Coords{middle, middle, middle});
+    auto tinySphere = [&center](const Math::Point3D &p) {
+        return Math::Vector3D(Math::Coords{p.X - center.X, p.Y - center.Y, p.Z - center.Z}).length()
+            - 0.01;
+    };
+    auto sample = [&tinySphere](const Math::Point3D *points, int count, double *distances) {
+        for (int i = 0; i < count; i++)
+            distances[i] = tinySphere(points[i]);
+    };
+    RayTracer::DistanceCache cache;
+    cache.configure(2.0, 1e-4);
+
+    // Every corner reads about 0.044 away, the cache must not report more than the truth
+    for (double offset : {0.0, 0.011, 0.02, 0.03}) {
+        Math::Point3D point(Math::Coords{middle + offset, middle, middle});
+        double distance;
+        if (cache.lookup(point, sample, distance)) {
+            EXPECT_LE(distance, tinySphere(point)) << "offset " << offset;
+        }
+    }
+
+    RayTracer::Ray towards(Math::Point3D(Math::Coords{middle - 1.5, middle, middle}),
+        Math::Vector3D({1, 0, 0}));
+    // Plain steps, so only a distance above the truth could skip the sphere
+    RayTracer::SdfMarchSettings settings;
+    settings.relaxation = 1.0;
+    RayTracer::SdfMarcher marcher(settings);
+    auto exact = marcher.march(towards, 0.0, 3.0, tinySphere);
+    auto cached = marcher.march(towards, 0.0, 3.0, [&](const Math::Point3D &p) {
+        double bound;
+        return cache.lookup(p, sample, bound) ? bound : tinySphere(p);
+    });
+    ASSERT_TRUE(exact.has_value());
+    ASSERT_TRUE(cached.has_value());
+    EXPECT_NEAR(exact->t, cached->t, 1e-3);
+}
+
+}  // namespace RayTracerTest
@@ -0,0 +1,104 @@
+/*
+** EPITECH PROJECT, 2025
+** B-OOP-400 Raytracer
+** File description:
+** Test file for TextureCache class
+*/
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Texture/TextureCache/TextureCache.hpp"
+#include "Texture/SpecularMap/SpecularMap.hpp"
+
+namespace RayTracerTest {
+
+class TextureCacheTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        RayTracer::TextureCache::getInstance().clear();
+        RayTracer::TextureCache::getInstance().setMemoryBudget(
+            RayTracer::TextureCache::DEFAULT_MEMORY_BUDGET);
+    }
+
+    void TearDown() override {
+        for (const auto& path : paths)
+            std::filesystem::remove(path);
+        RayTracer::TextureCache::getInstance().clear();
+        RayTracer::TextureCache::getInstance().setMemoryBudget(
+            RayTracer::TextureCache::DEFAULT_MEMORY_BUDGET);
+    }
+
+    // Binary PPM of size x size pixels, all of the given gray
+    std::string writeImage(const std::string& name, int size, unsigned char gray) {
+        std::string path = (std::filesystem::temp_directory_path() / name).string();
+        std::ofstream file(path, std::ios::binary);
+        file << "P6\n" << size << " " << size << "\n255\n";
+        std::vector<char> pixels(size * size * 3, static_cast<char>(gray));
+        file.write(pixels.data(), pixels.size());
+        paths.push_back(path);
+        return path;
+    }
+
+    std::vector<std::string> paths;
+};
+
+TEST_F(TextureCacheTest, SharesDecodedImagesTest) {
+    std::string path = writeImage("raytracer_cache_shared.ppm", 4, 51);
+    auto& cache = RayTracer::TextureCache::getInstance();
+
+    auto first = cache.load(path, 1);
+    ASSERT_NE(nullptr, first);
+    EXPECT_EQ(first, cache.load(path, 1));
+    // Other load options are another entry
+    auto colors = cache.load(path, 4);
+    ASSERT_NE(nullptr, colors);
+    EXPECT_NE(first, colors);
+    EXPECT_NEAR(0.2, first->texel(0, 1, 1).X, 1e-6);
+    EXPECT_EQ(nullptr, cache.load("nonexistent_path.ppm", 1));
+
+    // Maps built from the same file share its texels
+    RayTracer::SpecularMap specular(path);
+    RayTracer::SpecularMap other(path);
+    EXPECT_DOUBLE_EQ(specular.getSpecularAt(Math::Vector2D(0.5, 0.5)),
+        other.getSpecularAt(Math::Vector2D(0.5, 0.5)));
+    EXPECT_EQ(first->getMemorySize() + colors->getMemorySize(), cache.getRetainedBytes());
+}
+
+TEST_F(TextureCacheTest, EvictsLeastRecentlyUsedTest) {
+    auto& cache = RayTracer::TextureCache::getInstance();
+    std::string firstPath = writeImage("raytracer_cache_first.ppm", 16, 0);
+    std::string secondPath = writeImage("raytracer_cache_second.ppm", 16, 255);
+    std::weak_ptr<const RayTracer::TextureStorage> first = cache.load(firstPath, 4);
+    auto used = cache.load(firstPath, 1);
+    size_t size = first.lock()->getMemorySize();
+
+    // Room for one image of 4 components only
+    cache.setMemoryBudget(size + used->getMemorySize());
+    auto second = cache.load(secondPath, 4);
+    EXPECT_TRUE(first.expired());
+    EXPECT_LE(cache.getRetainedBytes(), cache.getMemoryBudget());
+    // Evicted entries still used elsewhere are found again
+    EXPECT_EQ(used, cache.load(firstPath, 1));
+}
+
+TEST_F(TextureCacheTest, PreloadTest) {
+    std::vector<std::pair<std::string, int>> requests;
+    for (int i = 0; i < 6; i++)
+        requests.emplace_back(writeImage("raytracer_cache_" + std::to_string(i) + ".ppm", 8, i * 40), 1);
+    requests.push_back(requests.front());
+
+    auto storages = RayTracer::TextureCache::getInstance().preload(requests);
+    ASSERT_EQ(requests.size(), storages.size());
+    for (size_t i = 0; i + 1 < storages.size(); i++) {
+        ASSERT_NE(nullptr, storages[i]);
+        EXPECT_NEAR(i * 40 / 255.0, storages[i]->texel(0, 0, 0).X, 1e-6);
+    }
+    EXPECT_EQ(storages.front(), storages.back());
+}
+
+}  // namespace RayTracerTest
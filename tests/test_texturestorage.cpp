@@ -0,0 +1,93 @@
+/*
+** EPITECH PROJECT, 2025
+** B-OOP-400 Raytracer
+** File description:
+** Test file for TextureStorage class
+*/
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "Math/Vector2D/Vector2D.hpp"
+#include "Texture/TextureStorage/TextureStorage.hpp"
+
+namespace RayTracerTest {
+
+class TextureStorageTest : public ::testing::Test {
+ protected:
+    // One pixel wide black and white checker, an RGB image of width x height
+    static std::vector<unsigned char> checker(int width, int height) {
+        std::vector<unsigned char> data(width * height * 3);
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                unsigned char value = (x + y) % 2 == 0 ? 255 : 0;
+                for (int c = 0; c < 3; c++)
+                    data[(y * width + x) * 3 + c] = value;
+            }
+        }
+        return data;
+    }
+};
+
+TEST_F(TextureStorageTest, TilesKeepEveryTexelTest) {
+    // Sizes that are not multiples of the tile size
+    const int width = 13;
+    const int height = 5;
+    std::vector<unsigned char> data(width * height * 3);
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = static_cast<unsigned char>(i % 251);
+    RayTracer::TextureStorage storage(data.data(), width, height, 3, 4);
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            Math::Vector3D texel = storage.texel(0, x, y);
+            size_t index = (y * width + x) * 3;
+            EXPECT_FLOAT_EQ(data[index] / 255.0f, texel.X);
+            EXPECT_FLOAT_EQ(data[index + 1] / 255.0f, texel.Y);
+            EXPECT_FLOAT_EQ(data[index + 2] / 255.0f, texel.Z);
+        }
+    }
+}
+
+TEST_F(TextureStorageTest, MipChainTest) {
+    std::vector<unsigned char> data = checker(16, 4);
+    RayTracer::TextureStorage storage(data.data(), 16, 4, 3, 1);
+
+    // 16x4, 8x2, 4x1, 2x1, 1x1
+    EXPECT_EQ(5, storage.getLevelCount());
+    for (int level = 1; level < storage.getLevelCount(); level++)
+        EXPECT_NEAR(0.5, storage.texel(level, 0, 0).X, 1e-6);
+}
+
+TEST_F(TextureStorageTest, PointSamplingTest) {
+    // 2x2 image, top row red and green, bottom row blue and white
+    const unsigned char data[] = {255, 0, 0, 0, 255, 0, 0, 0, 255, 255, 255, 255};
+    RayTracer::TextureStorage storage(data, 2, 2, 3, 4);
+
+    // v points up, the bottom left texel is at uv (0, 0)
+    Math::Vector3D bottomLeft = storage.sample(Math::Vector2D(0.1, 0.1), 0.0, false);
+    EXPECT_DOUBLE_EQ(0.0, bottomLeft.X);
+    EXPECT_DOUBLE_EQ(1.0, bottomLeft.Z);
+    Math::Vector3D wrapped = storage.sample(Math::Vector2D(1.1, -0.9), 0.0, false);
+    EXPECT_DOUBLE_EQ(bottomLeft.Z, wrapped.Z);
+    Math::Vector3D center = storage.sample(Math::Vector2D(0.5, 0.5), 0.0, true);
+    EXPECT_NEAR(0.5, center.X, 1e-6);
+    EXPECT_NEAR(0.5, center.Y, 1e-6);
+    EXPECT_NEAR(0.5, center.Z, 1e-6);
+}
+
+TEST_F(TextureStorageTest, FootprintAveragesTest) {
+    std::vector<unsigned char> data = checker(64, 64);
+    RayTracer::TextureStorage storage(data.data(), 64, 64, 3, 4);
+    Math::Vector2D uv(0.3, 0.7);
+
+    // A texel wide footprint still sees the checker, a wider one its average
+    double sharp = storage.sample(uv, 1.0 / 64, true).X;
+    EXPECT_GT(std::abs(sharp - 0.5), 0.1);
+    for (double footprint : {4.0 / 64, 0.5, 10.0})
+        EXPECT_NEAR(0.5, storage.sample(uv, footprint, true).X, 1e-6);
+    // Without bilinear filtering the nearest level is used
+    EXPECT_NEAR(0.5, storage.sample(uv, 0.5, false).X, 1e-6);
+}
+
+}  // namespace RayTracerTest
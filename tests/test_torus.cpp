@@ -236,4 +236,31 @@ TEST_F(TorusTest, DifferentSizeTest) {
     }
 }
 
-} // namespace RayTracerTest
\ No newline at end of file
+TEST_F(TorusTest, ExactDistanceTest) {
+    RayTracer::Ray ray(Math::Point3D(Math::Coords{-5, 0, 0}), Math::Vector3D(Math::Coords{1, 0, 0}));
+    auto outer = torusDefault->hit(ray, 0, 10);
+    ASSERT_TRUE(outer.has_value());
+    EXPECT_NEAR(outer->distance, 2.5, 1e-9);
+    EXPECT_NEAR(outer->normal.X, -1.0, 1e-9);
+
+    // Leaving the tube on the inside side lands on the far side of the hole
+    auto inner = torusDefault->hit(ray, 4.0, 10);
+    ASSERT_TRUE(inner.has_value());
+    EXPECT_NEAR(inner->distance, 6.5, 1e-9);
+}
+
+TEST_F(TorusTest, GrazingHitTest) {
+    // Skims the top of the tube, which fixed-step marching used to step over
+    RayTracer::Ray grazing(Math::Point3D(Math::Coords{-50, 0.4999, 0}),
+        Math::Vector3D(Math::Coords{1, 0, 0}));
+    auto hit = torusDefault->hit(grazing, 0, 100);
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_NEAR(hit->hitPoint.Y, 0.4999, 1e-9);
+    EXPECT_NEAR(hit->hitPoint.X, -2.0 - std::sqrt(0.25 - 0.4999 * 0.4999), 1e-6);
+
+    RayTracer::Ray above(Math::Point3D(Math::Coords{-50, 0.5001, 0}),
+        Math::Vector3D(Math::Coords{1, 0, 0}));
+    EXPECT_FALSE(torusDefault->hit(above, 0, 100).has_value());
+}
+
+}  // namespace RayTracerTest
@@ -0,0 +1,333 @@
+/*
+** EPITECH PROJECT, 2025
+** B-OOP-400 Raytracer
+** File description:
+** Test file for TriangleMesh primitive
+*/
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+#include "../src/Primitive/TriangleMesh/TriangleMesh.hpp"
+#include "../src/Primitive/ObjModelLoader.hpp"
+#include "../src/Ray/Ray.hpp"
+
+namespace RayTracerTest {
+
+class TriangleMeshTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        // Unit quad in the z = 0 plane made of two triangles
+        RayTracer::MeshData data;
+        data.positionsX = {-1.0f, 1.0f, 1.0f, -1.0f};
+        data.positionsY = {-1.0f, -1.0f, 1.0f, 1.0f};
+        data.positionsZ = {0.0f, 0.0f, 0.0f, 0.0f};
+        data.indices = {0, 1, 2, 0, 2, 3};
+        mesh = std::make_shared<RayTracer::TriangleMesh>(std::move(data),
+            std::make_shared<RayTracer::Material>());
+    }
+
+    std::shared_ptr<RayTracer::TriangleMesh> mesh;
+};
+
+TEST_F(TriangleMeshTest, CreationTest) {
+    EXPECT_EQ("meshes", mesh->getTypeName());
+    EXPECT_EQ(2u, mesh->getTriangleCount());
+    EXPECT_EQ(4u, mesh->getData().getVertexCount());
+
+    Math::AABB bounds = mesh->getBoundingBox();
+    EXPECT_NEAR(-1.0, bounds.min.X, 1e-5);
+    EXPECT_NEAR(1.0, bounds.max.Y, 1e-5);
+}
+
+TEST_F(TriangleMeshTest, HitTest) {
+    RayTracer::Ray ray(Math::Point3D(Math::Coords{0.5, 0.5, 5.0}),
+        Math::Vector3D(Math::Coords{0, 0, -1}));
+    auto hit = mesh->hit(ray, 0.001, 100.0);
+
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_NEAR(5.0, hit->distance, 1e-9);
+    EXPECT_NEAR(1.0, hit->normal.Z, 1e-9);
+    EXPECT_EQ(mesh.get(), hit->primitive);
+
+    RayTracer::Ray miss(Math::Point3D(Math::Coords{2.0, 0.0, 5.0}),
+        Math::Vector3D(Math::Coords{0, 0, -1}));
+    EXPECT_FALSE(mesh->hit(miss, 0.001, 100.0).has_value());
+    EXPECT_FALSE(mesh->hit(ray, 0.001, 4.0).has_value());
+}
+
+TEST_F(TriangleMeshTest, UVDensityTest) {
+    // Barycentric UVs: two half unit squares over an area of 4
+    RayTracer::HitInfo hit{};
+    EXPECT_NEAR(0.5, mesh->getUVDensity(hit), 1e-9);
+
+    RayTracer::MeshData data;
+    data.positionsX = {0.0f, 4.0f, 0.0f};
+    data.positionsY = {0.0f, 0.0f, 4.0f};
+    data.positionsZ = {0.0f, 0.0f, 0.0f};
+    data.texCoordsU = {0.0f, 1.0f, 0.0f};
+    data.texCoordsV = {0.0f, 0.0f, 1.0f};
+    data.indices = {0, 1, 2};
+    RayTracer::TriangleMesh textured(std::move(data), std::make_shared<RayTracer::Material>());
+    EXPECT_NEAR(0.25, textured.getUVDensity(hit), 1e-9);
+}
+
+TEST_F(TriangleMeshTest, OccludedTest) {
+    RayTracer::Ray ray(Math::Point3D(Math::Coords{-0.5, 0.5, 5.0}),
+        Math::Vector3D(Math::Coords{0, 0, -1}));
+
+    EXPECT_TRUE(mesh->occluded(ray, 0.001, 100.0));
+    EXPECT_FALSE(mesh->occluded(ray, 0.001, 4.0));
+    ASSERT_TRUE(mesh->intersect(ray, 0.001, 100.0).has_value());
+    EXPECT_NEAR(5.0, *mesh->intersect(ray, 0.001, 100.0), 1e-9);
+}
+
+TEST_F(TriangleMeshTest, BackFaceNormalTest) {
+    RayTracer::Ray ray(Math::Point3D(Math::Coords{-0.5, 0.5, -5.0}),
+        Math::Vector3D(Math::Coords{0, 0, 1}));
+    auto hit = mesh->hit(ray, 0.001, 100.0);
+
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_NEAR(-1.0, hit->normal.Z, 1e-9);
+}
+
+TEST_F(TriangleMeshTest, VertexAttributesTest) {
+    RayTracer::MeshData data;
+    data.positionsX = {0.0f, 1.0f, 0.0f};
+    data.positionsY = {0.0f, 0.0f, 1.0f};
+    data.positionsZ = {0.0f, 0.0f, 0.0f};
+    data.normalsX = {0.0f, 1.0f, 0.0f};
+    data.normalsY = {0.0f, 0.0f, 0.0f};
+    data.normalsZ = {1.0f, 1.0f, 1.0f};
+    data.texCoordsU = {0.0f, 1.0f, 0.0f};
+    data.texCoordsV = {0.0f, 0.0f, 0.5f};
+    data.indices = {0, 1, 2};
+    auto smooth = std::make_shared<RayTracer::TriangleMesh>(std::move(data),
+        std::make_shared<RayTracer::Material>());
+
+    RayTracer::Ray ray(Math::Point3D(Math::Coords{0.5, 0.5, 1.0}),
+        Math::Vector3D(Math::Coords{0, 0, -1}));
+    auto hit = smooth->hit(ray, 0.001, 100.0);
+
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_NEAR(0.5, hit->uv.U, 1e-6);
+    EXPECT_NEAR(0.25, hit->uv.V, 1e-6);
+    EXPECT_GT(hit->normal.X, 0.0);
+    EXPECT_NEAR(1.0, hit->normal.length(), 1e-9);
+}
+
+TEST_F(TriangleMeshTest, TransformTest) {
+    mesh->translate(Math::Vector3D(Math::Coords{0, 0, 2}));
+    RayTracer::Ray ray(Math::Point3D(Math::Coords{0.0, 0.2, 5.0}),
+        Math::Vector3D(Math::Coords{0, 0, -1}));
+    auto hit = mesh->hit(ray, 0.001, 100.0);
+
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_NEAR(3.0, hit->distance, 1e-6);
+
+    mesh->rotateY(90.0);
+    RayTracer::Ray side(Math::Point3D(Math::Coords{5.0, 0.2, 0.0}),
+        Math::Vector3D(Math::Coords{-1, 0, 0}));
+    hit = mesh->hit(side, 0.001, 100.0);
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_NEAR(3.0, hit->distance, 1e-6);
+    EXPECT_NEAR(1.0, hit->normal.X, 1e-6);
+
+    Math::AABB bounds = mesh->getBoundingBox();
+    EXPECT_NEAR(2.0, bounds.max.X, 1e-5);
+}
+
+TEST_F(TriangleMeshTest, CloneTest) {
+    auto clone = mesh->clone();
+
+    ASSERT_NE(nullptr, clone);
+    EXPECT_EQ("meshes", clone->getTypeName());
+    RayTracer::Ray ray(Math::Point3D(Math::Coords{0.5, 0.5, 5.0}),
+        Math::Vector3D(Math::Coords{0, 0, -1}));
+    EXPECT_TRUE(clone->hit(ray, 0.001, 100.0).has_value());
+}
+
+TEST_F(TriangleMeshTest, ObjLoaderTest) {
+    std::string path = "test_trianglemesh_cube.obj";
+    {
+        std::ofstream file(path);
+        file << "v -1 -1 -1\nv -1 -1 1\nv -1 1 -1\nv -1 1 1\n"
+             << "v 1 -1 -1\nv 1 -1 1\nv 1 1 -1\nv 1 1 1\n"
+             << "f 1 3 4 2\nf 5 7 8 6\nf 1 2 6 5\nf 3 7 8 4\n"
+             << "f -8 -4 -2 -6\nf 2 6 8 4\n";
+    }
+    auto primitive = RayTracer::ObjModelLoader::loadObjModel(path,
+        std::make_shared<RayTracer::Material>());
+    std::remove(path.c_str());
+    std::remove(RayTracer::ObjModelLoader::getCachePath(path).c_str());
+    auto cube = std::dynamic_pointer_cast<RayTracer::TriangleMesh>(primitive);
+
+    ASSERT_NE(nullptr, cube);
+    EXPECT_EQ(12u, cube->getTriangleCount());
+    RayTracer::Ray ray(Math::Point3D(Math::Coords{0.3, 0.1, 5.0}),
+        Math::Vector3D(Math::Coords{0, 0, -1}));
+    auto hit = cube->hit(ray, 0.001, 100.0);
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_NEAR(4.0, hit->distance, 1e-6);
+}
+
+TEST_F(TriangleMeshTest, ObjLoaderAttributesTest) {
+    std::string path = "test_trianglemesh_attributes.obj";
+    {
+        std::ofstream file(path);
+        file << "# quad with texture coordinates and normals\n"
+             << "v -1 -1 0\nv 1 -1 0\nv 1 1 0\nv -1 1 0\n"
+             << "vt 0 0\nvt 1 0\nvt 1 1\nvt 0 1\n"
+             << "vn 0 0 1\n"
+             << "f 1/1/1 2/2/1 3/3/1\nf -4/-4/-1 -2/-2/-1 -1/-1/-1\n";
+    }
+    RayTracer::MeshData data;
+    ASSERT_TRUE(RayTracer::ObjModelLoader::parseObjFile(path, data));
+    std::remove(path.c_str());
+
+    EXPECT_EQ(4u, data.getVertexCount());
+    EXPECT_EQ(2u, data.getTriangleCount());
+    EXPECT_TRUE(data.hasNormals());
+    EXPECT_TRUE(data.hasTexCoords());
+    auto quad = std::make_shared<RayTracer::TriangleMesh>(std::move(data),
+        std::make_shared<RayTracer::Material>());
+    RayTracer::Ray ray(Math::Point3D(Math::Coords{0.5, -0.5, 5.0}),
+        Math::Vector3D(Math::Coords{0, 0, -1}));
+    auto hit = quad->hit(ray, 0.001, 100.0);
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_NEAR(0.75, hit->uv.U, 1e-6);
+    EXPECT_NEAR(0.25, hit->uv.V, 1e-6);
+    EXPECT_NEAR(1.0, hit->normal.Z, 1e-6);
+}
+
+TEST_F(TriangleMeshTest, ObjLoaderMissingFileTest) {
+    RayTracer::MeshData data;
+    EXPECT_FALSE(RayTracer::ObjModelLoader::parseObjFile("missing_model.obj", data));
+}
+
+TEST_F(TriangleMeshTest, MeshCacheRoundTripTest) {
+    std::string path = "test_trianglemesh_cache.obj";
+    std::string cachePath = RayTracer::ObjModelLoader::getCachePath(path);
+    EXPECT_EQ("test_trianglemesh_cache.rtmesh", cachePath);
+    {
+        std::ofstream file(path);
+        file << "v 0 0 0\nv 1 0 0\nv 0 1 0\nvt 0 0\nvt 1 0\nvt 0 1\n"
+             << "f 1/1 2/2 3/3\n";
+    }
+    RayTracer::MeshData data;
+    ASSERT_TRUE(RayTracer::ObjModelLoader::parseObjFile(path, data));
+    ASSERT_TRUE(RayTracer::ObjModelLoader::writeMeshCache(cachePath, path, data));
+
+    RayTracer::MeshData cached;
+    EXPECT_TRUE(RayTracer::ObjModelLoader::readMeshCache(cachePath, path, cached));
+    EXPECT_EQ(data.positionsX, cached.positionsX);
+    EXPECT_EQ(data.positionsY, cached.positionsY);
+    EXPECT_EQ(data.texCoordsV, cached.texCoordsV);
+    EXPECT_EQ(data.indices, cached.indices);
+    EXPECT_FALSE(cached.hasNormals());
+
+    // A modified source invalidates the cache
+    {
+        std::ofstream file(path, std::ios::app);
+        file << "v 1 1 0\n";
+    }
+    EXPECT_FALSE(RayTracer::ObjModelLoader::readMeshCache(cachePath, path, cached));
+    std::remove(path.c_str());
+    std::remove(cachePath.c_str());
+}
+
+TEST_F(TriangleMeshTest, DisplacementTessellationTest) {
+    // White map: the quad moves up by strength * 2, Material::displacePoint's scale
+    std::string path = "test_trianglemesh_displacement.ppm";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "P6\n2 2\n255\n";
+        std::string pixels(2 * 2 * 3, static_cast<char>(255));
+        file.write(pixels.data(), pixels.size());
+    }
+    mesh->getMaterial()->setDisplacementMap(
+        std::make_shared<RayTracer::DisplacementMap>(path, 0.25));
+    std::remove(path.c_str());
+    EXPECT_FALSE(mesh->hasDisplacedGeometry());
+
+    mesh->tessellateDisplacement();
+    ASSERT_TRUE(mesh->hasDisplacedGeometry());
+    EXPECT_EQ(2u * RayTracer::TriangleMesh::MAX_SUBDIVISIONS * RayTracer::TriangleMesh::MAX_SUBDIVISIONS,
+        mesh->getTriangleCount());
+    EXPECT_NEAR(0.5, mesh->getBoundingBox().max.Z, 1e-5);
+
+    RayTracer::Ray ray(Math::Point3D(Math::Coords{0.3, -0.2, 5.0}),
+        Math::Vector3D(Math::Coords{0, 0, -1}));
+    auto hit = mesh->hit(ray, 0.001, 100.0);
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_NEAR(4.5, hit->distance, 1e-5);
+    EXPECT_NEAR(1.0, hit->normal.Z, 1e-5);
+
+    // Already displaced, a second call keeps the mesh
+    mesh->tessellateDisplacement();
+    EXPECT_EQ(2u * RayTracer::TriangleMesh::MAX_SUBDIVISIONS * RayTracer::TriangleMesh::MAX_SUBDIVISIONS,
+        mesh->getTriangleCount());
+}
+
+TEST_F(TriangleMeshTest, DisplacedClosedMeshIsWatertightTest) {
+    // Uneven map so neighbouring faces move their shared edges by varying amounts
+    std::string path = "test_trianglemesh_watertight.ppm";
+    {
+        std::ofstream file(path, std::ios::binary);
+        const unsigned char pixels[] = {0, 0, 0, 80, 80, 80, 160, 160, 160, 255, 255, 255};
+        file << "P6\n2 2\n255\n";
+        file.write(reinterpret_cast<const char *>(pixels), sizeof(pixels));
+    }
+    auto material = std::make_shared<RayTracer::Material>();
+    material->setDisplacementMap(std::make_shared<RayTracer::DisplacementMap>(path, 0.2));
+    std::remove(path.c_str());
+
+    // Octahedron sharing its six vertices between the eight faces
+    RayTracer::MeshData data;
+    data.positionsX = {1.0f, -1.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+    data.positionsY = {0.0f, 0.0f, 1.0f, -1.0f, 0.0f, 0.0f};
+    data.positionsZ = {0.0f, 0.0f, 0.0f, 0.0f, 1.0f, -1.0f};
+    for (size_t vertex = 0; vertex < data.positionsX.size(); vertex++) {
+        data.texCoordsU.push_back(0.5f + 0.3f * data.positionsX[vertex]);
+        data.texCoordsV.push_back(0.5f + 0.3f * data.positionsY[vertex] + 0.1f * data.positionsZ[vertex]);
+    }
+    for (uint32_t x : {0u, 1u}) {
+        for (uint32_t y : {2u, 3u}) {
+            for (uint32_t z : {4u, 5u}) {
+                // Outward winding flips with every negative axis
+                if ((x + y + z) % 2 == 0)
+                    data.indices.insert(data.indices.end(), {x, y, z});
+                else
+                    data.indices.insert(data.indices.end(), {x, z, y});
+            }
+        }
+    }
+    RayTracer::TriangleMesh octahedron(std::move(data), material);
+    octahedron.tessellateDisplacement();
+    ASSERT_TRUE(octahedron.hasDisplacedGeometry());
+    size_t faceVertices = (RayTracer::TriangleMesh::MAX_SUBDIVISIONS + 1)
+        * (RayTracer::TriangleMesh::MAX_SUBDIVISIONS + 2) / 2;
+    EXPECT_LT(octahedron.getData().getVertexCount(), 8 * faceVertices);
+
+    // Rays from inside leave through the surface whatever their direction,
+    // including right along the original edges
+    const double golden = M_PI * (3.0 - std::sqrt(5.0));
+    for (int i = 0; i < 2000; i++) {
+        double y = 1.0 - 2.0 * (i + 0.5) / 2000;
+        double radius = std::sqrt(1.0 - y * y);
+        Math::Vector3D direction(Math::Coords{radius * std::cos(golden * i), y,
+            radius * std::sin(golden * i)});
+        RayTracer::Ray ray(Math::Point3D(Math::Coords{0.0, 0.0, 0.0}), direction);
+        EXPECT_TRUE(octahedron.hit(ray, 0.001, 100.0).has_value()) << "direction " << i;
+    }
+    for (const auto &edge : {Math::Coords{1, 1, 0}, Math::Coords{0, -1, 1}, Math::Coords{-1, 0, -1}}) {
+        RayTracer::Ray ray(Math::Point3D(Math::Coords{0.0, 0.0, 0.0}), Math::Vector3D(edge));
+        EXPECT_TRUE(octahedron.hit(ray, 0.001, 100.0).has_value());
+    }
+}
+
+}  // namespace RayTracerTest